@@ -0,0 +1,233 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "flint.h"
+
+/*
+   Each thread owns a list of chunks obtained from flint_malloc. Memory is
+   handed out by bumping an offset into the current chunk and given back
+   all at once by returning to a mark. Chunks beyond the current one are
+   kept for reuse, except that at most one spare chunk, of size at most
+   FLINT_ARENA_MAX_RETAIN, survives a release.
+*/
+
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(x) (((x) + ARENA_ALIGN - 1) & ~((size_t) ARENA_ALIGN - 1))
+
+typedef struct arena_chunk_struct
+{
+    struct arena_chunk_struct * next;
+    size_t size;
+}
+arena_chunk_struct;
+
+#define ARENA_HEADER ARENA_ROUND(sizeof(arena_chunk_struct))
+#define ARENA_DATA(c) ((char *) (c) + ARENA_HEADER)
+
+static FLINT_TLS_PREFIX arena_chunk_struct * arena_head = NULL;
+static FLINT_TLS_PREFIX arena_chunk_struct * arena_cur = NULL;
+static FLINT_TLS_PREFIX size_t arena_used = 0;
+static FLINT_TLS_PREFIX int arena_registered = 0;
+static FLINT_TLS_PREFIX flint_arena_stats_struct arena_stats;
+
+/* totals over all threads, only touched when chunks come and go */
+static size_t arena_global_reserved = 0;
+static size_t arena_global_peak = 0;
+static ulong arena_global_chunks = 0;
+
+#if defined(__GNUC__)
+#define GLOBAL_ADD(x, v) __atomic_add_fetch(&(x), (v), __ATOMIC_RELAXED)
+#define GLOBAL_SUB(x, v) __atomic_sub_fetch(&(x), (v), __ATOMIC_RELAXED)
+#define GLOBAL_LOAD(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#else
+#define GLOBAL_ADD(x, v) ((x) += (v))
+#define GLOBAL_SUB(x, v) ((x) -= (v))
+#define GLOBAL_LOAD(x) (x)
+#endif
+
+static void _arena_global_peak(size_t reserved)
+{
+#if defined(__GNUC__)
+    size_t peak = __atomic_load_n(&arena_global_peak, __ATOMIC_RELAXED);
+
+    while (reserved > peak &&
+           !__atomic_compare_exchange_n(&arena_global_peak, &peak, reserved,
+                                 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+#else
+    if (reserved > arena_global_peak)
+        arena_global_peak = reserved;
+#endif
+}
+
+/* free the chunk c and all chunks after it */
+static void _arena_free_chain(arena_chunk_struct * c)
+{
+    while (c != NULL)
+    {
+        arena_chunk_struct * next = c->next;
+
+        arena_stats.reserved -= c->size;
+        GLOBAL_SUB(arena_global_reserved, c->size);
+        flint_free(c);
+
+        c = next;
+    }
+}
+
+void _flint_arena_cleanup(void)
+{
+    _arena_free_chain(arena_head);
+
+    arena_head = NULL;
+    arena_cur = NULL;
+    arena_used = 0;
+    arena_stats.in_use = 0;
+    arena_registered = 0;
+}
+
+static arena_chunk_struct * _arena_new_chunk(size_t size)
+{
+    arena_chunk_struct * c;
+    size_t chunk_size = FLINT_ARENA_MIN_CHUNK;
+
+    /* grow geometrically so that deep nests need few chunks */
+    if (arena_cur != NULL)
+        chunk_size = FLINT_MAX(chunk_size,
+                               FLINT_MIN(2*arena_cur->size, FLINT_ARENA_MAX_RETAIN));
+
+    chunk_size = FLINT_MAX(chunk_size, size);
+
+    c = (arena_chunk_struct *) flint_malloc(ARENA_HEADER + chunk_size);
+    c->next = NULL;
+    c->size = chunk_size;
+
+    if (!arena_registered)
+    {
+        flint_register_cleanup_function(_flint_arena_cleanup);
+        arena_registered = 1;
+    }
+
+    arena_stats.reserved += chunk_size;
+    arena_stats.num_chunks++;
+    _arena_global_peak(GLOBAL_ADD(arena_global_reserved, chunk_size));
+    GLOBAL_ADD(arena_global_chunks, 1);
+
+    return c;
+}
+
+void * flint_arena_alloc(size_t size)
+{
+    arena_chunk_struct * next;
+    void * ptr;
+
+    size = ARENA_ROUND(FLINT_MAX(size, 1));
+
+    if (arena_cur != NULL && size <= arena_cur->size - arena_used)
+    {
+        ptr = ARENA_DATA(arena_cur) + arena_used;
+        arena_used += size;
+    }
+    else
+    {
+        next = (arena_cur != NULL) ? arena_cur->next : arena_head;
+
+        if (next == NULL || next->size < size)
+        {
+            _arena_free_chain(next);
+
+            next = _arena_new_chunk(size);
+
+            if (arena_cur != NULL)
+                arena_cur->next = next;
+            else
+                arena_head = next;
+        }
+
+        arena_cur = next;
+        arena_used = size;
+        ptr = ARENA_DATA(arena_cur);
+    }
+
+    arena_stats.in_use += size;
+    if (arena_stats.in_use > arena_stats.peak)
+        arena_stats.peak = arena_stats.in_use;
+    arena_stats.num_allocs++;
+
+    return ptr;
+}
+
+void flint_arena_mark(flint_arena_mark_t mark)
+{
+    mark->chunk = arena_cur;
+    mark->used = arena_used;
+    mark->in_use = arena_stats.in_use;
+    mark->active = 1;
+}
+
+void flint_arena_release(const flint_arena_mark_t mark)
+{
+    arena_chunk_struct * spare;
+
+    arena_cur = (arena_chunk_struct *) mark->chunk;
+    arena_used = mark->used;
+    arena_stats.in_use = mark->in_use;
+
+    spare = (arena_cur != NULL) ? arena_cur->next : arena_head;
+
+    if (spare == NULL)
+        return;
+
+    if (spare->size > FLINT_ARENA_MAX_RETAIN)
+    {
+        if (arena_cur != NULL)
+            arena_cur->next = NULL;
+        else
+            arena_head = NULL;
+
+        _arena_free_chain(spare);
+    }
+    else if (spare->next != NULL)
+    {
+        _arena_free_chain(spare->next);
+        spare->next = NULL;
+    }
+}
+
+void * flint_arena_tmp_alloc(flint_arena_mark_t mark, size_t size)
+{
+    if (!mark->active)
+        flint_arena_mark(mark);
+
+    return flint_arena_alloc(size);
+}
+
+void flint_arena_get_stats(flint_arena_stats_t stats)
+{
+    *stats = arena_stats;
+}
+
+void flint_arena_get_global_stats(flint_arena_stats_t stats)
+{
+    stats->in_use = 0;
+    stats->peak = GLOBAL_LOAD(arena_global_peak);
+    stats->reserved = GLOBAL_LOAD(arena_global_reserved);
+    stats->num_allocs = 0;
+    stats->num_chunks = GLOBAL_LOAD(arena_global_chunks);
+}
+
+void flint_arena_reset_stats(void)
+{
+    arena_stats.peak = arena_stats.in_use;
+    arena_stats.num_allocs = 0;
+    arena_stats.num_chunks = 0;
+}
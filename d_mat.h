@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2010 Fredrik Johansson
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -29,6 +30,7 @@
 #define ulong mp_limb_t
 #include "flint.h"
 #include "d_vec.h"
+#include "thread_support.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -135,6 +137,14 @@ FLINT_DLL void d_mat_transpose(d_mat_t B, const d_mat_t A);
 
 FLINT_DLL void d_mat_mul_classical(d_mat_t C, const d_mat_t A, const d_mat_t B);
 
+FLINT_DLL void _d_mat_mul_blocked_threaded_pool_op(double ** D,
+              double * const * A, double * const * B, slong m, slong k,
+              slong n, int op, thread_pool_handle * threads, slong num_threads);
+
+FLINT_DLL void d_mat_mul_blocked(d_mat_t C, const d_mat_t A, const d_mat_t B);
+
+FLINT_DLL void d_mat_mul(d_mat_t C, const d_mat_t A, const d_mat_t B);
+
 /* Permutations */
 
 D_MAT_INLINE
@@ -156,6 +166,20 @@ FLINT_DLL void d_mat_gso(d_mat_t B, const d_mat_t A);
 
 FLINT_DLL void d_mat_qr(d_mat_t Q, d_mat_t R, const d_mat_t A);
 
+FLINT_DLL void d_mat_qr_householder(d_mat_t Q, d_mat_t R, const d_mat_t A);
+
+/* Tuning  *******************************************************************/
+
+/* Tile of the blocked multiplication kernel */
+#define D_MAT_BLOCKED_MR 4
+#define D_MAT_BLOCKED_NR 8
+
+/* Dimension from which blocked multiplication beats the classical one */
+#define D_MAT_MUL_BLOCKED_CUTOFF 16
+
+/* Panel width of the blocked Householder QR decomposition */
+#define D_MAT_QR_BLOCK 32
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "d_mat.h"
+
+void
+d_mat_mul(d_mat_t C, const d_mat_t A, const d_mat_t B)
+{
+    slong dim = FLINT_MIN(FLINT_MIN(A->r, A->c), B->c);
+
+    if (dim < D_MAT_MUL_BLOCKED_CUTOFF)
+        d_mat_mul_classical(C, A, B);
+    else
+        d_mat_mul_blocked(C, A, B);
+}
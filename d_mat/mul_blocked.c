@@ -0,0 +1,356 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "d_mat.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+#include <immintrin.h>
+#endif
+
+/*
+   Blocking in the style of Goto and van de Geijn, as for nmod_mat: B is
+   packed kc x nc at a time into panels of NR columns, then mc x kc blocks
+   of A are packed into panels of MR rows and a register tiled kernel
+   computes each MR x NR tile, which is added to D once per kc block.
+   Tasks are pairs of a block of rows and a slab of columns of D, so that
+   all threads have work when D has few rows.
+*/
+
+#define MR D_MAT_BLOCKED_MR
+#define NR D_MAT_BLOCKED_NR
+#define KC 256
+#define MC 64
+#define NC 1024
+
+#if MR != 4 || NR != 8
+#error "the kernels are written for 4 x 8 tiles"
+#endif
+
+typedef struct
+{
+    double ** D;
+    double * const * A;
+    slong m;
+    slong pc;
+    slong kc;
+    slong jc;
+    slong nc;
+    slong slab;
+    slong num_slabs;
+    const double * Bp;
+    int op;
+    int simd;
+    slong start;
+    slong stop;
+}
+_blocked_arg_struct;
+
+static void
+_pack_B(double * Bp, double * const * B, slong pc, slong kc, slong jc,
+                                                                     slong nc)
+{
+    slong jp, p, j, nr;
+
+    for (jp = 0; jp < nc; jp += NR)
+    {
+        nr = FLINT_MIN(NR, nc - jp);
+
+        for (p = 0; p < kc; p++, Bp += NR)
+        {
+            const double * b = B[pc + p] + jc + jp;
+
+            for (j = 0; j < nr; j++)
+                Bp[j] = b[j];
+            for ( ; j < NR; j++)
+                Bp[j] = 0.0;
+        }
+    }
+}
+
+static void
+_pack_A(double * Ap, double * const * A, slong ic, slong mc, slong pc,
+                                                                     slong kc)
+{
+    slong ip, p, i, mr;
+
+    for (ip = 0; ip < mc; ip += MR)
+    {
+        mr = FLINT_MIN(MR, mc - ip);
+
+        for (p = 0; p < kc; p++, Ap += MR)
+        {
+            for (i = 0; i < mr; i++)
+                Ap[i] = A[ic + ip + i][pc + p];
+            for ( ; i < MR; i++)
+                Ap[i] = 0.0;
+        }
+    }
+}
+
+/* two rows at a time in local sums, which the compiler keeps in registers */
+static void
+_d_mat_blocked_kernel(slong kc, const double * Ap, const double * Bp,
+                                                                  double * T)
+{
+    double s0, s1, s2, s3, s4, s5, s6, s7;
+    double t0, t1, t2, t3, t4, t5, t6, t7;
+    const double * a, * b;
+    slong p, i;
+
+    for (i = 0; i < MR; i += 2)
+    {
+        s0 = s1 = s2 = s3 = s4 = s5 = s6 = s7 = 0.0;
+        t0 = t1 = t2 = t3 = t4 = t5 = t6 = t7 = 0.0;
+
+        for (p = 0, a = Ap + i, b = Bp; p < kc; p++, a += MR, b += NR)
+        {
+            s0 += a[0]*b[0]; s1 += a[0]*b[1]; s2 += a[0]*b[2];
+            s3 += a[0]*b[3]; s4 += a[0]*b[4]; s5 += a[0]*b[5];
+            s6 += a[0]*b[6]; s7 += a[0]*b[7];
+            t0 += a[1]*b[0]; t1 += a[1]*b[1]; t2 += a[1]*b[2];
+            t3 += a[1]*b[3]; t4 += a[1]*b[4]; t5 += a[1]*b[5];
+            t6 += a[1]*b[6]; t7 += a[1]*b[7];
+        }
+
+        T[i*NR + 0] = s0; T[i*NR + 1] = s1; T[i*NR + 2] = s2;
+        T[i*NR + 3] = s3; T[i*NR + 4] = s4; T[i*NR + 5] = s5;
+        T[i*NR + 6] = s6; T[i*NR + 7] = s7;
+        T[i*NR + 8] = t0; T[i*NR + 9] = t1; T[i*NR + 10] = t2;
+        T[i*NR + 11] = t3; T[i*NR + 12] = t4; T[i*NR + 13] = t5;
+        T[i*NR + 14] = t6; T[i*NR + 15] = t7;
+    }
+}
+
+#if NMOD_VEC_HAVE_SIMD
+
+/* 4 x 8 tile in eight accumulators, one broadcast and two loads per step */
+__attribute__((target("avx2,fma")))
+static void
+_d_mat_blocked_kernel_avx2(slong kc, const double * Ap, const double * Bp,
+                                                                  double * T)
+{
+    __m256d c00, c01, c10, c11, c20, c21, c30, c31, a, b0, b1;
+    slong p;
+
+    c00 = c01 = c10 = c11 = _mm256_setzero_pd();
+    c20 = c21 = c30 = c31 = _mm256_setzero_pd();
+
+    for (p = 0; p < kc; p++, Ap += 4, Bp += 8)
+    {
+        b0 = _mm256_loadu_pd(Bp);
+        b1 = _mm256_loadu_pd(Bp + 4);
+
+        a = _mm256_broadcast_sd(Ap + 0);
+        c00 = _mm256_fmadd_pd(a, b0, c00);
+        c01 = _mm256_fmadd_pd(a, b1, c01);
+
+        a = _mm256_broadcast_sd(Ap + 1);
+        c10 = _mm256_fmadd_pd(a, b0, c10);
+        c11 = _mm256_fmadd_pd(a, b1, c11);
+
+        a = _mm256_broadcast_sd(Ap + 2);
+        c20 = _mm256_fmadd_pd(a, b0, c20);
+        c21 = _mm256_fmadd_pd(a, b1, c21);
+
+        a = _mm256_broadcast_sd(Ap + 3);
+        c30 = _mm256_fmadd_pd(a, b0, c30);
+        c31 = _mm256_fmadd_pd(a, b1, c31);
+    }
+
+    _mm256_storeu_pd(T + 0, c00);
+    _mm256_storeu_pd(T + 4, c01);
+    _mm256_storeu_pd(T + 8, c10);
+    _mm256_storeu_pd(T + 12, c11);
+    _mm256_storeu_pd(T + 16, c20);
+    _mm256_storeu_pd(T + 20, c21);
+    _mm256_storeu_pd(T + 24, c30);
+    _mm256_storeu_pd(T + 28, c31);
+}
+
+#endif
+
+static void
+_blocked_worker(void * varg)
+{
+    _blocked_arg_struct * arg = (_blocked_arg_struct *) varg;
+    double ** D = arg->D;
+    slong kc = arg->kc, jc = arg->jc, nc = arg->nc;
+    slong t, ic, mc, j0, j1, ip, jp, mr, nr, i, j;
+    int set = (arg->op == 0 && arg->pc == 0);
+    double T[MR*NR];
+    double * Ap;
+
+    if (arg->start >= arg->stop)
+        return;
+
+    Ap = flint_malloc(MC*kc*sizeof(double));
+
+    for (t = arg->start; t < arg->stop; t++)
+    {
+        ic = (t / arg->num_slabs)*MC;
+        mc = FLINT_MIN(MC, arg->m - ic);
+        j0 = (t % arg->num_slabs)*arg->slab;
+        j1 = FLINT_MIN(j0 + arg->slab, nc);
+
+        /* consecutive tasks of a thread share the block of A */
+        if (t == arg->start || j0 == 0)
+            _pack_A(Ap, arg->A, ic, mc, arg->pc, kc);
+
+        for (jp = j0; jp < j1; jp += NR)
+        {
+            nr = FLINT_MIN(NR, nc - jp);
+
+            for (ip = 0; ip < mc; ip += MR)
+            {
+                mr = FLINT_MIN(MR, mc - ip);
+
+#if NMOD_VEC_HAVE_SIMD
+                if (arg->simd)
+                    _d_mat_blocked_kernel_avx2(kc, Ap + ip*kc,
+                                                       arg->Bp + jp*kc, T);
+                else
+#endif
+                    _d_mat_blocked_kernel(kc, Ap + ip*kc, arg->Bp + jp*kc, T);
+
+                for (i = 0; i < mr; i++)
+                {
+                    double * d = D[ic + ip + i] + jc + jp;
+
+                    if (set)
+                        for (j = 0; j < nr; j++)
+                            d[j] = T[i*NR + j];
+                    else if (arg->op >= 0)
+                        for (j = 0; j < nr; j++)
+                            d[j] += T[i*NR + j];
+                    else
+                        for (j = 0; j < nr; j++)
+                            d[j] -= T[i*NR + j];
+                }
+            }
+        }
+    }
+
+    flint_free(Ap);
+}
+
+void
+_d_mat_mul_blocked_threaded_pool_op(double ** D, double * const * A,
+              double * const * B, slong m, slong k, slong n, int op,
+                               thread_pool_handle * threads, slong num_threads)
+{
+    _blocked_arg_struct * args;
+    slong jc, pc, kc, nc, i, num_blocks, num_tasks;
+    double * Bp;
+    int simd;
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (k == 0)
+    {
+        if (op == 0)
+            for (i = 0; i < m; i++)
+                _d_vec_zero(D[i], n);
+        return;
+    }
+
+#if NMOD_VEC_HAVE_SIMD
+    simd = (_nmod_vec_simd_level() >= NMOD_VEC_SIMD_AVX2);
+#else
+    simd = 0;
+#endif
+
+    Bp = flint_malloc(FLINT_MIN(KC, k)*(FLINT_MIN(NC, n) + NR)*sizeof(double));
+    args = flint_malloc((num_threads + 1)*sizeof(_blocked_arg_struct));
+
+    num_blocks = (m + MC - 1)/MC;
+
+    for (jc = 0; jc < n; jc += NC)
+    {
+        nc = FLINT_MIN(NC, n - jc);
+
+        for (pc = 0; pc < k; pc += kc)
+        {
+            kc = FLINT_MIN(KC, k - pc);
+
+            _pack_B(Bp, B, pc, kc, jc, nc);
+
+            args[0].D = D;
+            args[0].A = A;
+            args[0].m = m;
+            args[0].pc = pc;
+            args[0].kc = kc;
+            args[0].jc = jc;
+            args[0].nc = nc;
+            args[0].Bp = Bp;
+            args[0].op = op;
+            args[0].simd = simd;
+
+            /* split the columns when there are not enough blocks of rows */
+            args[0].num_slabs = FLINT_MIN((num_threads + num_blocks)/num_blocks,
+                                                          (nc + NR - 1)/NR);
+            args[0].slab = (nc + args[0].num_slabs - 1)/args[0].num_slabs;
+            args[0].slab = ((args[0].slab + NR - 1)/NR)*NR;
+            args[0].num_slabs = (nc + args[0].slab - 1)/args[0].slab;
+
+            num_tasks = num_blocks*args[0].num_slabs;
+
+            for (i = 0; i <= num_threads; i++)
+            {
+                args[i] = args[0];
+                args[i].start = (num_tasks*i)/(num_threads + 1);
+                args[i].stop = (num_tasks*(i + 1))/(num_threads + 1);
+            }
+
+            for (i = 0; i < num_threads; i++)
+                thread_pool_wake(global_thread_pool, threads[i], 0,
+                                                   _blocked_worker, &args[i]);
+            _blocked_worker(&args[num_threads]);
+            for (i = 0; i < num_threads; i++)
+                thread_pool_wait(global_thread_pool, threads[i]);
+        }
+    }
+
+    flint_free(args);
+    flint_free(Bp);
+}
+
+void
+d_mat_mul_blocked(d_mat_t C, const d_mat_t A, const d_mat_t B)
+{
+    thread_pool_handle * threads;
+    slong num_threads;
+
+    if (C == A || C == B)
+    {
+        d_mat_t T;
+        d_mat_init(T, A->r, B->c);
+        d_mat_mul_blocked(T, A, B);
+        d_mat_swap_entrywise(C, T);
+        d_mat_clear(T);
+        return;
+    }
+
+    if (C->r != A->r || C->c != B->c || A->c != B->r)
+    {
+        flint_printf
+            ("Exception (d_mat_mul_blocked). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    num_threads = flint_request_threads(&threads, flint_get_num_threads());
+
+    _d_mat_mul_blocked_threaded_pool_op(C->rows, A->rows, B->rows,
+                                A->r, A->c, B->c, 0, threads, num_threads);
+
+    flint_give_back_threads(threads, num_threads);
+}
@@ -0,0 +1,286 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "d_mat.h"
+
+/*
+   Blocked Householder QR as in LAPACK's dgeqrf. Panels of D_MAT_QR_BLOCK
+   columns are factored one column at a time, leaving the reflectors
+   I - tau v v^T, with v[0] = 1 implicit, below the diagonal of W. The
+   product of the reflectors of a panel is I - V T V^T with T upper
+   triangular, which is applied to the rest of W and, in reverse order,
+   to the first columns of the identity to form Q, using multiplications
+   on row windows.
+*/
+
+/* factors columns j0, ..., j0 + nb - 1 of W, rows j0, ..., m - 1 */
+static void
+_qr_panel(d_mat_t W, double * tau, slong j0, slong nb)
+{
+    slong m = W->r, i, j, c;
+    double alpha, beta, sigma, s, w;
+
+    for (j = j0; j < j0 + nb; j++)
+    {
+        alpha = d_mat_entry(W, j, j);
+
+        sigma = 0.0;
+        for (i = j + 1; i < m; i++)
+            sigma += d_mat_entry(W, i, j) * d_mat_entry(W, i, j);
+
+        if (sigma == 0.0)
+        {
+            tau[j] = 0.0;
+            continue;
+        }
+
+        beta = -copysign(sqrt(alpha * alpha + sigma), alpha);
+        tau[j] = (beta - alpha) / beta;
+        s = 1.0 / (alpha - beta);
+
+        for (i = j + 1; i < m; i++)
+            d_mat_entry(W, i, j) *= s;
+        d_mat_entry(W, j, j) = beta;
+
+        for (c = j + 1; c < j0 + nb; c++)
+        {
+            w = d_mat_entry(W, j, c);
+            for (i = j + 1; i < m; i++)
+                w += d_mat_entry(W, i, j) * d_mat_entry(W, i, c);
+            w *= tau[j];
+
+            d_mat_entry(W, j, c) -= w;
+            for (i = j + 1; i < m; i++)
+                d_mat_entry(W, i, c) -= w * d_mat_entry(W, i, j);
+        }
+    }
+}
+
+/*
+   Sets V (mm x nb) and Vt to the reflectors of the panel at j0 and T to
+   the triangular factor, with T[i][i] = tau[j0 + i] and column i above
+   the diagonal given by -tau[j0 + i] T V^T v_i.
+*/
+static void
+_qr_panel_factor(d_mat_t V, d_mat_t Vt, d_mat_t T, const d_mat_t W,
+                                        const double * tau, slong j0, slong nb)
+{
+    slong mm = W->r - j0, i, l, r;
+    double * z = _d_vec_init(nb);
+    double s;
+
+    for (r = 0; r < mm; r++)
+    {
+        for (l = 0; l < nb; l++)
+        {
+            if (r > l)
+                s = d_mat_entry(W, j0 + r, j0 + l);
+            else
+                s = (r == l) ? 1.0 : 0.0;
+
+            d_mat_entry(V, r, l) = s;
+            d_mat_entry(Vt, l, r) = s;
+        }
+    }
+
+    d_mat_zero(T);
+
+    for (i = 0; i < nb; i++)
+    {
+        /* z = V[:, 0:i]^T v_i, kept below the diagonal of T */
+        for (l = 0; l < i; l++)
+        {
+            s = 0.0;
+            for (r = i; r < mm; r++)
+                s += d_mat_entry(Vt, l, r) * d_mat_entry(Vt, i, r);
+            d_mat_entry(T, i, l) = s;
+        }
+
+        for (l = 0; l < i; l++)
+        {
+            s = 0.0;
+            for (r = l; r < i; r++)
+                s += d_mat_entry(T, l, r) * d_mat_entry(T, i, r);
+            z[l] = s;
+        }
+
+        for (l = 0; l < i; l++)
+        {
+            d_mat_entry(T, l, i) = -tau[j0 + i] * z[l];
+            d_mat_entry(T, i, l) = 0.0;
+        }
+
+        d_mat_entry(T, i, i) = tau[j0 + i];
+    }
+
+    _d_vec_clear(z);
+}
+
+/*
+   Sets X = (I - V T V^T) X if trans is zero and X = (I - V T^T V^T) X
+   otherwise, where X has mm rows given by pointers and nc columns.
+*/
+static void
+_qr_apply(double ** X, slong nc, const d_mat_t V, const d_mat_t Vt,
+                   const d_mat_t T, int trans, d_mat_t Y,
+                   thread_pool_handle * threads, slong num_threads)
+{
+    slong mm = V->r, nb = V->c, i, l, j;
+    double t;
+
+    _d_mat_mul_blocked_threaded_pool_op(Y->rows, Vt->rows, X, nb, mm, nc, 0,
+                                                        threads, num_threads);
+
+    if (trans)
+    {
+        for (i = nb - 1; i >= 0; i--)
+        {
+            t = d_mat_entry(T, i, i);
+            for (j = 0; j < nc; j++)
+                d_mat_entry(Y, i, j) *= t;
+
+            for (l = 0; l < i; l++)
+            {
+                t = d_mat_entry(T, l, i);
+                for (j = 0; j < nc; j++)
+                    d_mat_entry(Y, i, j) += t * d_mat_entry(Y, l, j);
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < nb; i++)
+        {
+            t = d_mat_entry(T, i, i);
+            for (j = 0; j < nc; j++)
+                d_mat_entry(Y, i, j) *= t;
+
+            for (l = i + 1; l < nb; l++)
+            {
+                t = d_mat_entry(T, i, l);
+                for (j = 0; j < nc; j++)
+                    d_mat_entry(Y, i, j) += t * d_mat_entry(Y, l, j);
+            }
+        }
+    }
+
+    _d_mat_mul_blocked_threaded_pool_op(X, V->rows, Y->rows, mm, nb, nc, -1,
+                                                        threads, num_threads);
+}
+
+void
+d_mat_qr_householder(d_mat_t Q, d_mat_t R, const d_mat_t A)
+{
+    slong m = A->r, n = A->c, p = FLINT_MIN(m, n);
+    slong j0, nb, i, j, num_threads;
+    thread_pool_handle * threads;
+    d_mat_t W, V, Vt, T, Y, Qw;
+    double * tau;
+    double ** X;
+
+    if (Q->r != A->r || Q->c != A->c || R->r != A->c || R->c != A->c)
+    {
+        flint_printf
+            ("Exception (d_mat_qr_householder). Incompatible dimensions.\n");
+        flint_abort();
+    }
+
+    d_mat_zero(R);
+
+    if (m == 0 || n == 0)
+        return;
+
+    d_mat_init(W, m, n);
+    d_mat_set(W, A);
+    d_mat_init(Qw, m, p);
+    tau = _d_vec_init(p);
+    X = flint_malloc(m * sizeof(double *));
+
+    num_threads = flint_request_threads(&threads, flint_get_num_threads());
+
+    for (j0 = 0; j0 < p; j0 += nb)
+    {
+        nb = FLINT_MIN(D_MAT_QR_BLOCK, p - j0);
+
+        _qr_panel(W, tau, j0, nb);
+
+        if (j0 + nb < n)
+        {
+            d_mat_init(V, m - j0, nb);
+            d_mat_init(Vt, nb, m - j0);
+            d_mat_init(T, nb, nb);
+            d_mat_init(Y, nb, n - j0 - nb);
+
+            _qr_panel_factor(V, Vt, T, W, tau, j0, nb);
+
+            for (i = j0; i < m; i++)
+                X[i - j0] = W->rows[i] + j0 + nb;
+
+            _qr_apply(X, n - j0 - nb, V, Vt, T, 1, Y, threads, num_threads);
+
+            d_mat_clear(V);
+            d_mat_clear(Vt);
+            d_mat_clear(T);
+            d_mat_clear(Y);
+        }
+    }
+
+    /* Q is the product of the reflectors applied to the first columns of I */
+    for (i = 0; i < p; i++)
+        d_mat_entry(Qw, i, i) = 1.0;
+
+    for (j0 = ((p - 1) / D_MAT_QR_BLOCK) * D_MAT_QR_BLOCK; j0 >= 0;
+                                                          j0 -= D_MAT_QR_BLOCK)
+    {
+        nb = FLINT_MIN(D_MAT_QR_BLOCK, p - j0);
+
+        d_mat_init(V, m - j0, nb);
+        d_mat_init(Vt, nb, m - j0);
+        d_mat_init(T, nb, nb);
+        d_mat_init(Y, nb, p - j0);
+
+        _qr_panel_factor(V, Vt, T, W, tau, j0, nb);
+
+        for (i = j0; i < m; i++)
+            X[i - j0] = Qw->rows[i] + j0;
+
+        _qr_apply(X, p - j0, V, Vt, T, 0, Y, threads, num_threads);
+
+        d_mat_clear(V);
+        d_mat_clear(Vt);
+        d_mat_clear(T);
+        d_mat_clear(Y);
+    }
+
+    flint_give_back_threads(threads, num_threads);
+
+    /* make the diagonal of R nonnegative */
+    for (i = 0; i < p; i++)
+    {
+        double s = (d_mat_entry(W, i, i) < 0.0) ? -1.0 : 1.0;
+
+        for (j = i; j < n; j++)
+            d_mat_entry(R, i, j) = s * d_mat_entry(W, i, j);
+
+        for (j = 0; j < m; j++)
+            d_mat_entry(Q, j, i) = s * d_mat_entry(Qw, j, i);
+    }
+
+    for (j = 0; j < m; j++)
+        for (i = p; i < n; i++)
+            d_mat_entry(Q, j, i) = 0.0;
+
+    flint_free(X);
+    _d_vec_clear(tau);
+    d_mat_clear(Qw);
+    d_mat_clear(W);
+}
@@ -0,0 +1,168 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "d_mat.h"
+#include "ulong_extras.h"
+
+/* small integers, so that all the products are exact */
+static void
+_randint(d_mat_t A, flint_rand_t state)
+{
+    slong i, j;
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            d_mat_entry(A, i, j) = (double) n_randint(state, 201) - 100.0;
+}
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_blocked....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        d_mat_t A, B, C, D, E;
+        slong m, k, n, r0, c0, i1, j1, num_threads;
+        thread_pool_handle * threads;
+        double ** rows;
+        int op;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 150);
+            k = n_randint(state, 600);
+            n = n_randint(state, 150);
+        }
+        else
+        {
+            m = n_randint(state, 50);
+            k = n_randint(state, 50);
+            n = n_randint(state, 50);
+        }
+
+        d_mat_init(A, m, k);
+        d_mat_init(B, k, n);
+        d_mat_init(C, m, n);
+        d_mat_init(D, m, n);
+
+        _randint(A, state);
+        _randint(B, state);
+        _randint(C, state);
+
+        if (n_randint(state, 2))
+        {
+            d_mat_mul_blocked(C, A, B);
+        }
+        else
+        {
+            /* aliasing */
+            d_mat_t T;
+            d_mat_init(T, m, k);
+            d_mat_set(T, A);
+            if (k == n)
+            {
+                d_mat_mul_blocked(T, T, B);
+                d_mat_swap(T, C);
+            }
+            else
+                d_mat_mul_blocked(C, T, B);
+            d_mat_clear(T);
+        }
+
+        d_mat_mul_classical(D, A, B);
+
+        if (!d_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        d_mat_mul(C, A, B);
+
+        if (!d_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal (mul)\n");
+            flint_printf("m = %wd, k = %wd, n = %wd\n", m, k, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* add or subtract a product into a window */
+        op = (int) n_randint(state, 3) - 1;
+        r0 = n_randint(state, 5);
+        c0 = n_randint(state, 5);
+
+        d_mat_init(E, m + r0, n + c0);
+        _randint(E, state);
+        d_mat_set(D, C);
+
+        for (i1 = 0; i1 < m; i1++)
+            for (j1 = 0; j1 < n; j1++)
+                d_mat_entry(D, i1, j1) = d_mat_entry(E, r0 + i1, c0 + j1);
+
+        rows = flint_malloc((m + 1) * sizeof(double *));
+        for (i1 = 0; i1 < m; i1++)
+            rows[i1] = E->rows[r0 + i1] + c0;
+
+        num_threads = flint_request_threads(&threads, flint_get_num_threads());
+        _d_mat_mul_blocked_threaded_pool_op(rows, A->rows, B->rows, m, k, n,
+                                                  op, threads, num_threads);
+        flint_give_back_threads(threads, num_threads);
+
+        for (i1 = 0; i1 < m; i1++)
+        {
+            for (j1 = 0; j1 < n; j1++)
+            {
+                double x = d_mat_entry(D, i1, j1), y = d_mat_entry(C, i1, j1);
+
+                if (op == 0)
+                    x = y;
+                else if (op > 0)
+                    x += y;
+                else
+                    x -= y;
+
+                if (x != d_mat_entry(E, r0 + i1, c0 + j1))
+                {
+                    flint_printf("FAIL: results not equal (op)\n");
+                    flint_printf("m = %wd, k = %wd, n = %wd, op = %d\n",
+                                                                 m, k, n, op);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        flint_free(rows);
+
+        d_mat_clear(A);
+        d_mat_clear(B);
+        d_mat_clear(C);
+        d_mat_clear(D);
+        d_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "d_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("qr_householder....");
+    fflush(stdout);
+
+    /* check QR = A, R is upper triangular with nonnegative diagonal and
+       the first min(m, n) columns of Q are orthonormal */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        d_mat_t A, Q, R, B;
+        slong m, n, p, j, k, l;
+        double eps, dot;
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 120);
+            n = n_randint(state, 120);
+        }
+        else
+        {
+            m = n_randint(state, 20);
+            n = n_randint(state, 20);
+        }
+
+        p = FLINT_MIN(m, n);
+        eps = (m + n + 1) * D_EPS;
+
+        d_mat_init(A, m, n);
+        d_mat_init(Q, m, n);
+        d_mat_init(R, n, n);
+        d_mat_init(B, m, n);
+
+        d_mat_randtest(A, state, 0, 0);
+
+        /* rank deficient */
+        if (n_randint(state, 4) == 0 && n > 1)
+            for (j = 0; j < m; j++)
+                d_mat_entry(A, j, n - 1) = d_mat_entry(A, j, 0);
+
+        d_mat_randtest(Q, state, 0, 0);
+        d_mat_randtest(R, state, 0, 0);
+
+        d_mat_qr_householder(Q, R, A);
+
+        d_mat_mul_classical(B, Q, R);
+
+        if (!d_mat_approx_equal(A, B, eps))
+        {
+            flint_printf("FAIL: QR != A\n");
+            flint_printf("m = %wd, n = %wd\n", m, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            for (k = 0; k < j && k < n; k++)
+            {
+                if (d_mat_entry(R, j, k) != 0.0)
+                {
+                    flint_printf("FAIL: R not upper triangular\n");
+                    flint_printf("m = %wd, n = %wd\n", m, n);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+
+            if (j < p && d_mat_entry(R, j, j) < 0.0)
+            {
+                flint_printf("FAIL: negative diagonal\n");
+                flint_printf("m = %wd, n = %wd\n", m, n);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        for (j = 0; j < p; j++)
+        {
+            for (k = j; k < p; k++)
+            {
+                dot = 0.0;
+                for (l = 0; l < m; l++)
+                    dot += d_mat_entry(Q, l, j) * d_mat_entry(Q, l, k);
+
+                if (fabs(dot - (j == k)) > eps)
+                {
+                    flint_printf("FAIL: Q not orthonormal\n");
+                    flint_printf("m = %wd, n = %wd, j = %wd, k = %wd, "
+                                             "dot = %g\n", m, n, j, k, dot);
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        d_mat_clear(A);
+        d_mat_clear(Q);
+        d_mat_clear(R);
+        d_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
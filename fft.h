@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009, 2011 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -27,6 +28,35 @@
 #include <gmp.h>
 #define ulong mp_limb_t
 #include "flint.h"
+
+/*
+   An FFT plan owns the transform of a fixed operand together with the
+   space for the transform of the other operand and all scratch space,
+   so that repeated multiplications by the fixed operand cost one forward
+   and one inverse transform each and do no memory allocation.
+
+   This is defined before mpn_extras.h is included, as fmpz_poly.h (which
+   that header includes) embeds a plan in its precache structure.
+*/
+typedef struct
+{
+   mp_limb_t ** ii;   /* coefficients of the variable operand */
+   mp_limb_t ** jj;   /* transform of the fixed operand */
+   mp_limb_t ** t1;   /* scratch, one entry per thread */
+   mp_limb_t ** t2;
+   mp_limb_t ** s1;
+   mp_limb_t ** tt;
+   slong num_threads; /* number of entries in each scratch array */
+   slong depth;
+   slong limbs;
+   slong trunc;       /* length to which jj has been transformed */
+   flint_bitcnt_t bits; /* bits per coefficient, for integer plans */
+   mp_size_t n2;      /* limbs of the fixed integer */
+   mp_size_t j2;      /* coefficients of the fixed integer */
+} fft_plan_struct;
+
+typedef fft_plan_struct fft_plan_t[1];
+
 #include "mpn_extras.h"
 
 #if HAVE_OPENMP
@@ -197,6 +227,20 @@ FLINT_DLL void ifft_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t
 FLINT_DLL void mul_truncate_sqrt2(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
                         mp_srcptr i2, mp_size_t n2, flint_bitcnt_t depth, flint_bitcnt_t w);
 
+/* 
+   Below this many limbs of coefficient data per layer, the threaded
+   transforms switch to the serial ones.
+*/
+#define FFT_PARALLEL_CUTOFF 4096
+
+FLINT_DLL void fft_truncate_sqrt2_threaded(mp_limb_t ** ii, mp_size_t n,
+                       flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2,
+                                          mp_limb_t ** temp, mp_size_t trunc);
+
+FLINT_DLL void ifft_truncate_sqrt2_threaded(mp_limb_t ** ii, mp_size_t n,
+                       flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2,
+                                          mp_limb_t ** temp, mp_size_t trunc);
+
 FLINT_DLL void fft_butterfly_twiddle(mp_limb_t * u, mp_limb_t * v, 
    mp_limb_t * s, mp_limb_t * t, mp_size_t limbs, flint_bitcnt_t b1, flint_bitcnt_t b2);
 
@@ -279,6 +323,27 @@ FLINT_DLL void fft_convolution_precache(mp_limb_t ** ii, mp_limb_t ** jj,
                slong depth, slong limbs, slong trunc, mp_limb_t ** t1,
 	                    mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt);
 
+/***** FFT Plans *****/
+
+FLINT_DLL void fft_plan_init(fft_plan_t P, slong depth, slong limbs);
+
+FLINT_DLL void fft_plan_clear(fft_plan_t P);
+
+FLINT_DLL void fft_plan_fit_threads(fft_plan_t P);
+
+FLINT_DLL void fft_plan_precache(fft_plan_t P, slong trunc);
+
+FLINT_DLL void fft_plan_convolution(fft_plan_t P, slong trunc);
+
+FLINT_DLL int flint_mpn_mul_fft_params(flint_bitcnt_t * depth,
+                   flint_bitcnt_t * w, mp_size_t n1, mp_size_t n2);
+
+FLINT_DLL void fft_plan_init_mpn(fft_plan_t P, mp_srcptr i2, mp_size_t n2,
+                                                              mp_size_t n1);
+
+FLINT_DLL void flint_mpn_mul_fft_plan(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
+                                                              fft_plan_t P);
+
 #ifdef __cplusplus
 }
 #endif
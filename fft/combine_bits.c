@@ -1,5 +1,6 @@
 /* 
     Copyright (C) 2009, 2011 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -12,7 +13,9 @@
 #include "stdlib.h"
 #include "gmp.h"
 #include "flint.h"
+#include "ulong_extras.h"
 #include "fft.h"
+#include "thread_support.h"
 
 void fft_combine_limbs(mp_limb_t * res, mp_limb_t ** poly, slong length, 
             mp_size_t coeff_limbs, mp_size_t output_limbs, mp_size_t total_limbs)
@@ -32,7 +35,8 @@ void fft_combine_limbs(mp_limb_t * res, mp_limb_t ** poly, slong length,
    }  
 }
 
-void fft_combine_bits(mp_limb_t * res, mp_limb_t ** poly, slong length, 
+static void
+_fft_combine_bits(mp_limb_t * res, mp_limb_t ** poly, slong length, 
                   flint_bitcnt_t bits, mp_size_t output_limbs, mp_size_t total_limbs)
 {
    flint_bitcnt_t shift_bits, top_bits = ((FLINT_BITS - 1) & bits);
@@ -93,3 +97,112 @@ void fft_combine_bits(mp_limb_t * res, mp_limb_t ** poly, slong length,
    
    flint_free(temp);     
 }
+
+typedef struct
+{
+   mp_limb_t ** poly;
+   slong length;
+   slong chunk;
+   flint_bitcnt_t bits;
+   mp_size_t output_limbs;
+   mp_limb_t ** sums;
+   mp_size_t * offs;
+   mp_size_t * lens;
+}
+combine_bits_arg_t;
+
+static void
+_combine_bits_worker(slong start, slong stop, void * arg_ptr)
+{
+   combine_bits_arg_t arg = *((combine_bits_arg_t *) arg_ptr);
+   slong k, a;
+
+   for (k = start; k < stop; k++)
+   {
+      a = k*arg.chunk;
+
+      flint_mpn_zero(arg.sums[k], arg.lens[k]);
+      _fft_combine_bits(arg.sums[k], arg.poly + a,
+                        FLINT_MIN(arg.chunk, arg.length - a), arg.bits,
+                        arg.output_limbs, arg.lens[k]);
+   }
+}
+
+/*
+   Each chunk of coefficients starting on a limb boundary is evaluated into
+   its own zeroed buffer in parallel, then the overlapping buffers are added
+   into res, which costs a single pass over the output.
+*/
+void fft_combine_bits(mp_limb_t * res, mp_limb_t ** poly, slong length, 
+                  flint_bitcnt_t bits, mp_size_t output_limbs, mp_size_t total_limbs)
+{
+   combine_bits_arg_t arg;
+   slong num_threads, align, chunk, num, k;
+   mp_size_t off, len, alloc;
+   mp_limb_t cy, * buf;
+
+   num_threads = thread_pool_in_team() ?
+                 thread_pool_team_size() : flint_get_num_threads();
+
+   /* chunks must start at a multiple of FLINT_BITS bits */
+   align = FLINT_BITS/n_gcd(bits, FLINT_BITS);
+   chunk = (length + 4*num_threads - 1)/(4*num_threads);
+   chunk = ((chunk + align - 1)/align)*align;
+
+   if (num_threads == 1 || chunk >= length ||
+       length*output_limbs < 8*FFT_PARALLEL_CUTOFF)
+   {
+      _fft_combine_bits(res, poly, length, bits, output_limbs, total_limbs);
+      return;
+   }
+
+   num = (length + chunk - 1)/chunk;
+
+   arg.poly = poly;
+   arg.length = length;
+   arg.chunk = chunk;
+   arg.bits = bits;
+   arg.output_limbs = output_limbs;
+   arg.sums = flint_malloc(num*sizeof(mp_limb_t *));
+   arg.offs = flint_malloc(2*num*sizeof(mp_size_t));
+   arg.lens = arg.offs + num;
+
+   for (k = 0, alloc = 0; k < num; k++)
+   {
+      off = (k*chunk*bits)/FLINT_BITS;
+      len = ((FLINT_MIN(chunk, length - k*chunk) - 1)*bits)/FLINT_BITS
+                                                           + output_limbs + 2;
+      if (off >= total_limbs)
+         break;
+
+      arg.offs[k] = off;
+      arg.lens[k] = FLINT_MIN(len, total_limbs - off);
+      alloc += arg.lens[k];
+   }
+
+   num = k;
+   buf = flint_malloc(alloc*sizeof(mp_limb_t));
+
+   for (k = 0, alloc = 0; k < num; k++)
+   {
+      arg.sums[k] = buf + alloc;
+      alloc += arg.lens[k];
+   }
+
+   flint_parallel_for(0, num, 1, _combine_bits_worker, &arg, num_threads);
+
+   for (k = 0; k < num; k++)
+   {
+      off = arg.offs[k];
+      len = arg.lens[k];
+
+      cy = mpn_add_n(res + off, res + off, arg.sums[k], len);
+      if (cy && off + len < total_limbs)
+         mpn_add_1(res + off + len, res + off + len,
+                                                total_limbs - off - len, cy);
+   }
+
+   flint_free(buf);
+   flint_free(arg.offs);
+   flint_free(arg.sums);
+}
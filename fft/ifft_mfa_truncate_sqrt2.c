@@ -1,5 +1,6 @@
 /* 
     Copyright (C) 2009, 2011, 2020 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -13,6 +14,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "thread_support.h"
 
 void ifft_butterfly_twiddle(mp_limb_t * u, mp_limb_t * v, 
    mp_limb_t * s, mp_limb_t * t, mp_size_t limbs, flint_bitcnt_t b1, flint_bitcnt_t b2)
@@ -247,7 +249,6 @@ void ifft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t w,
 
 typedef struct
 {
-    volatile mp_size_t * i;
     mp_size_t n1;
     mp_size_t n2;
     mp_size_t n;
@@ -260,61 +261,45 @@ typedef struct
     mp_limb_t ** ii;
     mp_limb_t ** t1;
     mp_limb_t ** t2;
-    mp_limb_t * temp;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_t * mutex;
-#endif
+    mp_limb_t ** temp;
 }
 ifft_outer_arg_t;
 
 void
-_ifft_outer1_worker(void * arg_ptr)
+_ifft_outer1_worker(slong start, slong stop, void * arg_ptr)
 {
     ifft_outer_arg_t arg = *((ifft_outer_arg_t *) arg_ptr);
+    slong k = thread_pool_team_index();
     mp_size_t n1 = arg.n1;
     mp_size_t n2 = arg.n2;
     flint_bitcnt_t depth = arg.depth;
     flint_bitcnt_t w = arg.w;
     mp_limb_t ** ii = arg.ii;
-    mp_limb_t ** t1 = arg.t1;
-    mp_limb_t ** t2 = arg.t2;
-    mp_size_t i, j, end;
+    mp_limb_t ** t1 = arg.t1 + k;
+    mp_limb_t ** t2 = arg.t2 + k;
+    mp_size_t i, j;
 
-    while (1)
+    for (i = start; i < stop; i++)
     {
-#if FLINT_USES_PTHREAD
-        pthread_mutex_lock(arg.mutex);
-#endif
-        i = *arg.i;
-        end = *arg.i = FLINT_MIN(i + 16, n1);
-#if FLINT_USES_PTHREAD
-        pthread_mutex_unlock(arg.mutex);
-#endif
-
-        if (i >= n1)
-            return;
-
-        for ( ; i < end; i++)
+        for (j = 0; j < n2; j++)
         {
-            for (j = 0; j < n2; j++)
-            {
-                mp_size_t s = n_revbin(j, depth);
-                if (j < s) SWAP_PTRS(ii[i + j*n1], ii[i + s*n1]);
-            }
-      
-            /*
-                IFFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
-                of 1 starting at row 0, where z => w bits
-            */
-            ifft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1);
+            mp_size_t s = n_revbin(j, depth);
+            if (j < s) SWAP_PTRS(ii[i + j*n1], ii[i + s*n1]);
         }
+  
+        /*
+            IFFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
+            of 1 starting at row 0, where z => w bits
+        */
+        ifft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1);
     }
 }
 
 void
-_ifft_outer2_worker(void * arg_ptr)
+_ifft_outer2_worker(slong start, slong stop, void * arg_ptr)
 {
     ifft_outer_arg_t arg = *((ifft_outer_arg_t *) arg_ptr);
+    slong k = thread_pool_team_index();
     mp_size_t n1 = arg.n1;
     mp_size_t n2 = arg.n2;
     mp_size_t n = arg.n;
@@ -325,92 +310,77 @@ _ifft_outer2_worker(void * arg_ptr)
     flint_bitcnt_t depth2 = arg.depth2;
     flint_bitcnt_t w = arg.w;
     mp_limb_t ** ii = arg.ii;
-    mp_limb_t ** t1 = arg.t1;
-    mp_limb_t ** t2 = arg.t2;
-    mp_limb_t * temp = arg.temp;
-    mp_size_t i, j, end;
+    mp_limb_t ** t1 = arg.t1 + k;
+    mp_limb_t ** t2 = arg.t2 + k;
+    mp_limb_t * temp = arg.temp[k];
+    mp_size_t i, j;
 
-    while (1)
+    for (i = start; i < stop; i++)
     {
-#if FLINT_USES_PTHREAD
-        pthread_mutex_lock(arg.mutex);
-#endif
-	i = *arg.i;
-        end = *arg.i = FLINT_MIN(i + 16, n1);
-#if FLINT_USES_PTHREAD
-        pthread_mutex_unlock(arg.mutex);
-#endif
-
-        if (i >= n1)
-            return;
-
-        for ( ; i < end; i++)
+        for (j = 0; j < trunc2; j++)
         {
-            for (j = 0; j < trunc2; j++)
-            {
-                mp_size_t s = n_revbin(j, depth);
-                if (j < s) SWAP_PTRS(ii[i + j*n1], ii[i + s*n1]);
-            }
-
-            for ( ; j < n2; j++)
-            {
-                mp_size_t u = i + j*n1;
-                if (w & 1)
-                {
-                    if (i & 1)
-                        fft_adjust_sqrt2(ii[i + j*n1], ii[u - 2*n], u, limbs, w, temp); 
-                    else
-                        fft_adjust(ii[i + j*n1], ii[u - 2*n], u/2, limbs, w); 
-                } else
-                    fft_adjust(ii[i + j*n1], ii[u - 2*n], u, limbs, w/2);
-            }
+            mp_size_t s = n_revbin(j, depth);
+            if (j < s) SWAP_PTRS(ii[i + j*n1], ii[i + s*n1]);
+        }
 
-            /* 
-                IFFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
-                of 1 starting at row 0, where z => w bits
-            */
-            ifft_truncate1_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1, trunc2);
-      
-            /* relevant components of final sqrt2 layer of IFFT */
+        for ( ; j < n2; j++)
+        {
+            mp_size_t u = i + j*n1;
             if (w & 1)
             {
-                for (j = i; j < trunc - 2*n; j+=n1) 
-                {   
-                    if (j & 1)
-                        ifft_butterfly_sqrt2(*t1, *t2, ii[j - 2*n], ii[j], j, limbs, w, temp); 
-                    else
-                        ifft_butterfly(*t1, *t2, ii[j - 2*n], ii[j], j/2, limbs, w);
-
-                    SWAP_PTRS(ii[j - 2*n], *t1);
-                    SWAP_PTRS(ii[j],       *t2);
-                }
+                if (i & 1)
+                    fft_adjust_sqrt2(ii[i + j*n1], ii[u - 2*n], u, limbs, w, temp); 
+                else
+                    fft_adjust(ii[i + j*n1], ii[u - 2*n], u/2, limbs, w); 
             } else
-            {
-                for (j = i; j < trunc - 2*n; j+=n1) 
-                {   
-                    ifft_butterfly(*t1, *t2, ii[j - 2*n], ii[j], j, limbs, w/2);
+                fft_adjust(ii[i + j*n1], ii[u - 2*n], u, limbs, w/2);
+        }
+
+        /* 
+            IFFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
+            of 1 starting at row 0, where z => w bits
+        */
+        ifft_truncate1_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1, trunc2);
+  
+        /* relevant components of final sqrt2 layer of IFFT */
+        if (w & 1)
+        {
+            for (j = i; j < trunc - 2*n; j+=n1) 
+            {   
+                if (j & 1)
+                    ifft_butterfly_sqrt2(*t1, *t2, ii[j - 2*n], ii[j], j, limbs, w, temp); 
+                else
+                    ifft_butterfly(*t1, *t2, ii[j - 2*n], ii[j], j/2, limbs, w);
+
+                SWAP_PTRS(ii[j - 2*n], *t1);
+                SWAP_PTRS(ii[j],       *t2);
+            }
+        } else
+        {
+            for (j = i; j < trunc - 2*n; j+=n1) 
+            {   
+                ifft_butterfly(*t1, *t2, ii[j - 2*n], ii[j], j, limbs, w/2);
    
-                    SWAP_PTRS(ii[j - 2*n], *t1);
-                    SWAP_PTRS(ii[j],       *t2);
-                }
+                SWAP_PTRS(ii[j - 2*n], *t1);
+                SWAP_PTRS(ii[j],       *t2);
             }
+        }
 
-            for (j = trunc + i - 2*n; j < 2*n; j+=n1)
-                mpn_add_n(ii[j - 2*n], ii[j - 2*n], ii[j - 2*n], limbs + 1);
+        for (j = trunc + i - 2*n; j < 2*n; j+=n1)
+            mpn_add_n(ii[j - 2*n], ii[j - 2*n], ii[j - 2*n], limbs + 1);
 
-            for (j = 0; j < trunc2; j++)
-            {
-                mp_size_t t = j*n1 + i;
-                mpn_div_2expmod_2expp1(ii[t], ii[t], limbs, depth + depth2 + 1);
-                mpn_normmod_2expp1(ii[t], limbs);
-            }
+        for (j = 0; j < trunc2; j++)
+        {
+            mp_size_t t = j*n1 + i;
+            mpn_div_2expmod_2expp1(ii[t], ii[t], limbs, depth + depth2 + 1);
+            mpn_normmod_2expp1(ii[t], limbs);
+        }
 
-            for (j = 0; j < n2; j++)
-            {
-                mp_size_t t = j*n1 + i - 2*n;
-                mpn_div_2expmod_2expp1(ii[t], ii[t], limbs, depth + depth2 + 1);
-                mpn_normmod_2expp1(ii[t], limbs);
-            }
+        for (j = 0; j < n2; j++)
+        {
+            mp_size_t t = j*n1 + i - 2*n;
+            mpn_div_2expmod_2expp1(ii[t], ii[t], limbs, depth + depth2 + 1);
+            mpn_normmod_2expp1(ii[t], limbs);
         }
     }
 }
@@ -418,92 +388,43 @@ _ifft_outer2_worker(void * arg_ptr)
 void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, flint_bitcnt_t w, 
    mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
 {
-    mp_size_t i, shared_i = 0;
     mp_size_t n2 = (2*n)/n1;
     mp_size_t trunc2 = (trunc - 2*n)/n1;
     flint_bitcnt_t depth = 0;
     flint_bitcnt_t depth2 = 0;
     flint_bitcnt_t limbs = (w*n)/FLINT_BITS;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_t mutex;
-#endif
-    slong num_threads;
-    thread_pool_handle * threads;
-    ifft_outer_arg_t * args;
+    ifft_outer_arg_t arg;
   
     while ((UWORD(1)<<depth) < n2) depth++;
     while ((UWORD(1)<<depth2) < n1) depth2++;
 
-#if FLINT_USES_PTHREAD
-    pthread_mutex_init(&mutex, NULL);
-#endif
-
-   /* first half mfa IFFT : n2 rows, n1 cols */
+    arg.n1 = n1;
+    arg.n2 = n2;
+    arg.n = n;
+    arg.trunc = trunc;
+    arg.trunc2 = trunc2;
+    arg.limbs = limbs;
+    arg.depth = depth;
+    arg.depth2 = depth2;
+    arg.w = w;
+    arg.ii = ii;
+    arg.t1 = t1;
+    arg.t2 = t2;
+    arg.temp = temp;
+
+    /* first half mfa IFFT : n2 rows, n1 cols */
    
-   /* column IFFTs */
+    /* column IFFTs */
 
-    num_threads = flint_request_threads(&threads,
-                             FLINT_MIN(flint_get_num_threads(), (n1 + 15)/16));
-
-    args = (ifft_outer_arg_t *)
-                      flint_malloc(sizeof(ifft_outer_arg_t)*(num_threads + 1));
-
-    for (i = 0; i < num_threads + 1; i++)
-    {
-       args[i].i = &shared_i;
-       args[i].n1 = n1;
-       args[i].n2 = n2;
-       args[i].n = n;
-       args[i].trunc = trunc;
-       args[i].trunc2 = trunc2;
-       args[i].limbs = limbs;
-       args[i].depth = depth;
-       args[i].depth2 = depth2;
-       args[i].w = w;
-       args[i].ii = ii;
-       args[i].t1 = t1 + i;
-       args[i].t2 = t2 + i;
-       args[i].temp = temp[i];
-#if FLINT_USES_PTHREAD
-       args[i].mutex = &mutex;       
-#endif
-    }
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wake(global_thread_pool, threads[i], 0,
-                                                _ifft_outer1_worker, &args[i]);
-
-    _ifft_outer1_worker(&args[num_threads]);
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wait(global_thread_pool, threads[i]);
+    flint_parallel_for(0, n1, 0, _ifft_outer1_worker, &arg,
+                                                    flint_get_num_threads());
    
     /* second half IFFT : n2 rows, n1 cols */
-    ii += 2*n;
 
     /* column IFFTs with relevant sqrt2 layer butterflies combined */
 
-    shared_i = 0;
-
-    for (i = 0; i < num_threads + 1; i++)
-    {
-       args[i].ii = ii;
-    }
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wake(global_thread_pool, threads[i], 0,
-                                                _ifft_outer2_worker, &args[i]);
-
-    _ifft_outer2_worker(&args[num_threads]);
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wait(global_thread_pool, threads[i]);
+    arg.ii = ii + 2*n;
 
-    flint_give_back_threads(threads, num_threads);
-
-    flint_free(args);
-
-#if FLINT_USES_PTHREAD
-    pthread_mutex_destroy(&mutex);
-#endif
+    flint_parallel_for(0, n1, 0, _ifft_outer2_worker, &arg,
+                                                    flint_get_num_threads());
 }
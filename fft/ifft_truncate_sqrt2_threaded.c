@@ -0,0 +1,346 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+#include "thread_support.h"
+
+/*
+    As for fft_truncate_sqrt2_threaded. Only the two halves of a full radix 2
+    IFFT are independent, the truncated IFFTs need the first half before the
+    second, so there the parallelism comes from the layers alone.
+*/
+
+#define FFT_USE_THREADS(n, limbs) \
+    (thread_pool_team_size() > 1 && (n)*((limbs) + 1) >= FFT_PARALLEL_CUTOFF)
+
+#define LAYER_BUTTERFLY       0 /* inverse butterfly on ii[i], ii[n + i] */
+#define LAYER_ADJUST          1 /* ii[n + i] = ii[i]*z^i */
+#define LAYER_DOUBLE          2 /* ii[i] = 2*ii[i] */
+#define LAYER_ADD_HALVE       3 /* ii[i] = (ii[i] + ii[n + i])/2 */
+#define LAYER_ADDSUB          4 /* ii[i] = 2*ii[i] - ii[n + i] */
+#define LAYER_SUB_ADJUST      5 /* inverse butterfly given only ii[i] */
+#define LAYER_BUTTERFLY_SQRT2 6 /* as above on pairs, with sqrt2 twiddles */
+#define LAYER_ADJUST_SQRT2    7
+
+typedef struct
+{
+    int op;
+    mp_limb_t ** ii;
+    mp_size_t n;
+    mp_size_t limbs;
+    flint_bitcnt_t w;
+    mp_limb_t ** t1;
+    mp_limb_t ** t2;
+    mp_limb_t ** temp;
+}
+ifft_layer_arg_t;
+
+static void
+_ifft_layer_worker(slong start, slong stop, void * arg_ptr)
+{
+    ifft_layer_arg_t arg = *((ifft_layer_arg_t *) arg_ptr);
+    slong k = thread_pool_team_index();
+    mp_limb_t ** ii = arg.ii;
+    mp_size_t n = arg.n;
+    mp_size_t limbs = arg.limbs;
+    flint_bitcnt_t w = arg.w;
+    mp_limb_t ** t1 = arg.t1 + k;
+    mp_limb_t ** t2 = arg.t2 + k;
+    mp_size_t i;
+
+    switch (arg.op)
+    {
+        case LAYER_BUTTERFLY:
+            for (i = start; i < stop; i++)
+            {
+                ifft_butterfly(*t1, *t2, ii[i], ii[n + i], i, limbs, w);
+
+                SWAP_PTRS(ii[i],     *t1);
+                SWAP_PTRS(ii[n + i], *t2);
+            }
+            break;
+
+        case LAYER_ADJUST:
+            for (i = start; i < stop; i++)
+                fft_adjust(ii[n + i], ii[i], i, limbs, w);
+            break;
+
+        case LAYER_DOUBLE:
+            for (i = start; i < stop; i++)
+                mpn_add_n(ii[i], ii[i], ii[i], limbs + 1);
+            break;
+
+        case LAYER_ADD_HALVE:
+            for (i = start; i < stop; i++)
+            {
+                mpn_add_n(ii[i], ii[i], ii[n + i], limbs + 1);
+                mpn_div_2expmod_2expp1(ii[i], ii[i], limbs, 1);
+            }
+            break;
+
+        case LAYER_ADDSUB:
+            for (i = start; i < stop; i++)
+            {
+#if HAVE_ADDSUB_N
+                mpn_addsub_n(ii[i], ii[i], ii[i], ii[n + i], limbs + 1);
+#else
+                mpn_add_n(ii[i], ii[i], ii[i], limbs + 1);
+                mpn_sub_n(ii[i], ii[i], ii[n + i], limbs + 1);
+#endif
+            }
+            break;
+
+        case LAYER_SUB_ADJUST:
+            for (i = start; i < stop; i++)
+            {
+                mpn_sub_n(ii[n + i], ii[i], ii[n + i], limbs + 1);
+                fft_adjust(*t1, ii[n + i], i, limbs, w);
+                mpn_add_n(ii[i], ii[i], ii[n + i], limbs + 1);
+                SWAP_PTRS(ii[n + i], *t1);
+            }
+            break;
+
+        case LAYER_BUTTERFLY_SQRT2:
+            for (i = 2*start; i < 2*stop; i += 2)
+            {
+                ifft_butterfly(*t1, *t2, ii[i], ii[n + i], i/2, limbs, w);
+
+                SWAP_PTRS(ii[i],     *t1);
+                SWAP_PTRS(ii[n + i], *t2);
+
+                ifft_butterfly_sqrt2(*t1, *t2, ii[i + 1], ii[n + i + 1],
+                                               i + 1, limbs, w, arg.temp[k]);
+
+                SWAP_PTRS(ii[i + 1],     *t1);
+                SWAP_PTRS(ii[n + i + 1], *t2);
+            }
+            break;
+
+        case LAYER_ADJUST_SQRT2:
+            for (i = 2*start; i < 2*stop; i += 2)
+            {
+                fft_adjust(ii[n + i], ii[i], i/2, limbs, w);
+                fft_adjust_sqrt2(ii[n + i + 1], ii[i + 1],
+                                               i + 1, limbs, w, arg.temp[k]);
+            }
+            break;
+    }
+}
+
+static void
+_ifft_layer(int op, mp_limb_t ** ii, mp_size_t n, mp_size_t limbs,
+           flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2,
+                             mp_limb_t ** temp, mp_size_t start, mp_size_t stop)
+{
+    ifft_layer_arg_t arg;
+    slong grain;
+
+    arg.op = op;
+    arg.ii = ii;
+    arg.n = n;
+    arg.limbs = limbs;
+    arg.w = w;
+    arg.t1 = t1;
+    arg.t2 = t2;
+    arg.temp = temp;
+
+    grain = (stop - start)/(8*thread_pool_team_size());
+    grain = FLINT_MAX(grain, FFT_PARALLEL_CUTOFF/(8*(limbs + 1)));
+    grain = FLINT_MAX(grain, 1);
+
+    flint_parallel_for(start, stop, grain, _ifft_layer_worker, &arg,
+                                                     flint_get_num_threads());
+}
+
+typedef struct
+{
+    mp_limb_t ** ii;
+    mp_size_t n;
+    flint_bitcnt_t w;
+    mp_limb_t ** t1;
+    mp_limb_t ** t2;
+    mp_limb_t ** temp;
+    mp_size_t trunc;
+}
+ifft_threaded_arg_t;
+
+static void _ifft_radix2_threaded(mp_limb_t ** ii, mp_size_t n,
+                       flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2);
+
+static void
+_ifft_radix2_worker(void * arg_ptr)
+{
+    ifft_threaded_arg_t * arg = (ifft_threaded_arg_t *) arg_ptr;
+
+    _ifft_radix2_threaded(arg->ii, arg->n, arg->w, arg->t1, arg->t2);
+}
+
+static void
+_ifft_radix2_threaded(mp_limb_t ** ii, mp_size_t n,
+                       flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2)
+{
+    mp_size_t limbs = (w*n)/FLINT_BITS;
+    ifft_threaded_arg_t arg;
+    thread_pool_task_group_t G;
+    slong k;
+
+    if (n == 1 || !FFT_USE_THREADS(n, limbs))
+    {
+        k = thread_pool_team_index();
+        ifft_radix2(ii, n, w, t1 + k, t2 + k);
+        return;
+    }
+
+    arg.ii = ii;
+    arg.n = n/2;
+    arg.w = 2*w;
+    arg.t1 = t1;
+    arg.t2 = t2;
+
+    thread_pool_task_group_init(G);
+    thread_pool_spawn(G, _ifft_radix2_worker, &arg);
+
+    _ifft_radix2_threaded(ii + n, n/2, 2*w, t1, t2);
+
+    thread_pool_sync(G);
+    thread_pool_task_group_clear(G);
+
+    _ifft_layer(LAYER_BUTTERFLY, ii, n, limbs, w, t1, t2, NULL, 0, n);
+}
+
+static void
+_ifft_truncate1_threaded(mp_limb_t ** ii, mp_size_t n,
+       flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, mp_size_t trunc)
+{
+    mp_size_t limbs = (w*n)/FLINT_BITS;
+    slong k;
+
+    if (trunc == 2*n)
+        _ifft_radix2_threaded(ii, n, w, t1, t2);
+    else if (n == 1 || !FFT_USE_THREADS(n, limbs))
+    {
+        k = thread_pool_team_index();
+        ifft_truncate1(ii, n, w, t1 + k, t2 + k, trunc);
+    } else if (trunc <= n)
+    {
+        _ifft_layer(LAYER_ADD_HALVE, ii, n, limbs, w, t1, t2, NULL,
+                                                                   trunc, n);
+
+        _ifft_truncate1_threaded(ii, n/2, 2*w, t1, t2, trunc);
+
+        _ifft_layer(LAYER_ADDSUB, ii, n, limbs, w, t1, t2, NULL, 0, trunc);
+    } else
+    {
+        _ifft_radix2_threaded(ii, n/2, 2*w, t1, t2);
+
+        _ifft_layer(LAYER_SUB_ADJUST, ii, n, limbs, w, t1, t2, NULL,
+                                                               trunc - n, n);
+
+        _ifft_truncate1_threaded(ii + n, n/2, 2*w, t1, t2, trunc - n);
+
+        _ifft_layer(LAYER_BUTTERFLY, ii, n, limbs, w, t1, t2, NULL,
+                                                               0, trunc - n);
+    }
+}
+
+static void
+_ifft_truncate_threaded(mp_limb_t ** ii, mp_size_t n,
+       flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, mp_size_t trunc)
+{
+    mp_size_t limbs = (w*n)/FLINT_BITS;
+    slong k;
+
+    if (trunc == 2*n)
+        _ifft_radix2_threaded(ii, n, w, t1, t2);
+    else if (n == 1 || !FFT_USE_THREADS(n, limbs))
+    {
+        k = thread_pool_team_index();
+        ifft_truncate(ii, n, w, t1 + k, t2 + k, trunc);
+    } else if (trunc <= n)
+    {
+        _ifft_truncate_threaded(ii, n/2, 2*w, t1, t2, trunc);
+
+        _ifft_layer(LAYER_DOUBLE, ii, n, limbs, w, t1, t2, NULL, 0, trunc);
+    } else
+    {
+        _ifft_radix2_threaded(ii, n/2, 2*w, t1, t2);
+
+        _ifft_layer(LAYER_ADJUST, ii, n, limbs, w, t1, t2, NULL,
+                                                               trunc - n, n);
+
+        _ifft_truncate1_threaded(ii + n, n/2, 2*w, t1, t2, trunc - n);
+
+        _ifft_layer(LAYER_BUTTERFLY, ii, n, limbs, w, t1, t2, NULL,
+                                                               0, trunc - n);
+        _ifft_layer(LAYER_DOUBLE, ii, n, limbs, w, t1, t2, NULL,
+                                                               trunc - n, n);
+    }
+}
+
+static void
+_ifft_truncate_sqrt2_worker(void * arg_ptr)
+{
+    ifft_threaded_arg_t * arg = (ifft_threaded_arg_t *) arg_ptr;
+    mp_limb_t ** ii = arg->ii;
+    mp_size_t n = arg->n;
+    flint_bitcnt_t w = arg->w;
+    mp_limb_t ** t1 = arg->t1;
+    mp_limb_t ** t2 = arg->t2;
+    mp_limb_t ** temp = arg->temp;
+    mp_size_t trunc = arg->trunc;
+    mp_size_t limbs = (w*n)/FLINT_BITS;
+    slong k;
+
+    if ((w & 1) == 0)
+    {
+        _ifft_truncate_threaded(ii, 2*n, w/2, t1, t2, trunc);
+        return;
+    }
+
+    if (!FFT_USE_THREADS(2*n, limbs))
+    {
+        k = thread_pool_team_index();
+        ifft_truncate_sqrt2(ii, n, w, t1 + k, t2 + k, temp + k, trunc);
+        return;
+    }
+
+    _ifft_radix2_threaded(ii, n, w, t1, t2);
+
+    _ifft_layer(LAYER_ADJUST_SQRT2, ii, 2*n, limbs, w, t1, t2, temp,
+                                                      (trunc - 2*n)/2, n);
+
+    _ifft_truncate1_threaded(ii + 2*n, n, w, t1, t2, trunc - 2*n);
+
+    _ifft_layer(LAYER_BUTTERFLY_SQRT2, ii, 2*n, limbs, w, t1, t2, temp,
+                                                      0, (trunc - 2*n)/2);
+    _ifft_layer(LAYER_DOUBLE, ii, 2*n, limbs, w, t1, t2, temp,
+                                                      trunc - 2*n, 2*n);
+}
+
+void ifft_truncate_sqrt2_threaded(mp_limb_t ** ii, mp_size_t n,
+                       flint_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2,
+                                           mp_limb_t ** temp, mp_size_t trunc)
+{
+    ifft_threaded_arg_t arg;
+
+    arg.ii = ii;
+    arg.n = n;
+    arg.w = w;
+    arg.t1 = t1;
+    arg.t2 = t2;
+    arg.temp = temp;
+    arg.trunc = trunc;
+
+    flint_parallel_run(_ifft_truncate_sqrt2_worker, &arg,
+                                                     flint_get_num_threads());
+}
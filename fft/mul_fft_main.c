@@ -1,5 +1,6 @@
 /* 
     Copyright (C) 2009, 2011 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,8 +18,13 @@
 
 static int fft_tuning_table[5][2] = FFT_TAB;
 
-void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1, 
-                        mp_srcptr i2, mp_size_t n2)
+/*
+   Choose the parameters depth and w of the FFT for a product of integers
+   of n1 and n2 limbs. Returns 1 if the matrix Fourier algorithm should
+   be used, otherwise 0.
+*/
+int flint_mpn_mul_fft_params(flint_bitcnt_t * depth_out, flint_bitcnt_t * w_out,
+                                                  mp_size_t n1, mp_size_t n2)
 {
    mp_size_t off, depth = 6;
    mp_size_t w = 1;
@@ -33,7 +39,6 @@ void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
 
    FLINT_ASSERT(n1 > 0);
    FLINT_ASSERT(n2 > 0);
-   FLINT_ASSERT(j1 + j2 - 1 > 2*n);
 
    while (j1 + j2 - 1 > 4*n) /* find initial n, w */
    {
@@ -72,7 +77,10 @@ void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
          w += wadj;
       }
 
-      mul_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+      *depth_out = depth;
+      *w_out = w;
+
+      return 0;
    } else
    {
       if (j1 + j2 - 1 <= 3*n)
@@ -80,7 +88,21 @@ void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
          depth--;
          w *= 3;
       }
-      mul_mfa_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+
+      *depth_out = depth;
+      *w_out = w;
+
+      return 1;
    }
 }
 
+void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1, 
+                        mp_srcptr i2, mp_size_t n2)
+{
+   flint_bitcnt_t depth, w;
+
+   if (flint_mpn_mul_fft_params(&depth, &w, n1, n2))
+      mul_mfa_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+   else
+      mul_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+}
@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+
+void fft_plan_init_mpn(fft_plan_t P, mp_srcptr i2, mp_size_t n2, mp_size_t n1)
+{
+   flint_bitcnt_t depth, w, bits;
+   mp_size_t n, limbs, j, j1;
+
+   flint_mpn_mul_fft_params(&depth, &w, n1, n2);
+
+   n = (WORD(1) << depth);
+   limbs = (n*w)/FLINT_BITS;
+   bits = (n*w - (depth + 1))/2;
+
+   fft_plan_init(P, depth, limbs);
+
+   P->bits = bits;
+   P->n2 = n2;
+   P->j2 = fft_split_bits(P->jj, i2, n2, bits, limbs);
+   for (j = P->j2; j < 4*n; j++)
+      flint_mpn_zero(P->jj[j], limbs + 1);
+
+   j1 = (n1*FLINT_BITS - 1)/bits + 1;
+
+   fft_plan_precache(P, j1 + P->j2 - 1);
+}
+
+void flint_mpn_mul_fft_plan(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
+                                                              fft_plan_t P)
+{
+   mp_size_t n = (WORD(1) << P->depth);
+   mp_size_t r_limbs = n1 + P->n2;
+   mp_size_t j, j1;
+
+   j1 = fft_split_bits(P->ii, i1, n1, P->bits, P->limbs);
+   for (j = j1; j < 4*n; j++)
+      flint_mpn_zero(P->ii[j], P->limbs + 1);
+
+   fft_plan_convolution(P, j1 + P->j2 - 1);
+
+   flint_mpn_zero(r1, r_limbs);
+   fft_combine_bits(r1, P->ii, j1 + P->j2 - 1, P->bits, P->limbs, r_limbs);
+}
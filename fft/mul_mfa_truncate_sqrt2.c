@@ -13,6 +13,7 @@
 #include "flint.h"
 #include "fft.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
 
 void mul_mfa_truncate_sqrt2(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
                         mp_srcptr i2, mp_size_t n2, flint_bitcnt_t depth, flint_bitcnt_t w)
@@ -39,7 +40,8 @@ void mul_mfa_truncate_sqrt2(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
 
    TMP_START;
 
-   N = flint_get_num_threads();
+   /* one set of scratch space for each thread which may run a worker */
+   N = FLINT_MAX(flint_get_num_threads(), thread_pool_team_size());
    ii = flint_malloc((4*(n + n*size) + 5*size*N)*sizeof(mp_limb_t));
    for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size) 
    {
@@ -1,5 +1,6 @@
-/* 
+/*
     Copyright (C) 2009, 2011 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -13,82 +14,159 @@
 #include "flint.h"
 #include "fft.h"
 #include "mpn_extras.h"
+#include "thread_support.h"
 
-void mul_truncate_sqrt2(mp_ptr r1, mp_srcptr i1, mp_size_t n1, 
+typedef struct
+{
+    mp_limb_t ** ii;
+    mp_limb_t ** jj;
+    mp_limb_t ** tt;
+    mp_size_t n;
+    mp_size_t limbs;
+    flint_bitcnt_t w;
+    flint_bitcnt_t depth;
+}
+mul_truncate_sqrt2_arg_t;
+
+static void
+_pointwise_worker(slong start, slong stop, void * arg_ptr)
+{
+    mul_truncate_sqrt2_arg_t arg = *((mul_truncate_sqrt2_arg_t *) arg_ptr);
+    mp_limb_t ** ii = arg.ii;
+    mp_limb_t ** jj = arg.jj;
+    mp_limb_t * tt = arg.tt[thread_pool_team_index()];
+    mp_size_t limbs = arg.limbs;
+    mp_size_t j;
+    mp_limb_t c;
+
+    for (j = start; j < stop; j++)
+    {
+        mpn_normmod_2expp1(ii[j], limbs);
+        if (ii != jj) mpn_normmod_2expp1(jj[j], limbs);
+        c = 2*ii[j][limbs] + jj[j][limbs];
+        ii[j][limbs] = flint_mpn_mulmod_2expp1_basecase(ii[j], ii[j], jj[j],
+                                                       c, arg.n*arg.w, tt);
+    }
+}
+
+static void
+_normalise_worker(slong start, slong stop, void * arg_ptr)
+{
+    mul_truncate_sqrt2_arg_t arg = *((mul_truncate_sqrt2_arg_t *) arg_ptr);
+    mp_limb_t ** ii = arg.ii;
+    mp_size_t limbs = arg.limbs;
+    mp_size_t j;
+
+    for (j = start; j < stop; j++)
+    {
+        mpn_div_2expmod_2expp1(ii[j], ii[j], limbs, arg.depth + 2);
+        mpn_normmod_2expp1(ii[j], limbs);
+    }
+}
+
+void mul_truncate_sqrt2(mp_ptr r1, mp_srcptr i1, mp_size_t n1,
                         mp_srcptr i2, mp_size_t n2, flint_bitcnt_t depth, flint_bitcnt_t w)
 {
    mp_size_t n = (UWORD(1)<<depth);
-   flint_bitcnt_t bits1 = (n*w - (depth+1))/2; 
-   
+   flint_bitcnt_t bits1 = (n*w - (depth+1))/2;
+
    mp_size_t r_limbs = n1 + n2;
    mp_size_t limbs = (n*w)/FLINT_BITS;
    mp_size_t size = limbs + 1;
 
    mp_size_t j1 = (n1*FLINT_BITS - 1)/bits1 + 1;
    mp_size_t j2 = (n2*FLINT_BITS - 1)/bits1 + 1;
-   
+
    mp_size_t i, j, trunc;
 
-   mp_limb_t ** ii, ** jj, * t1, * t2, * s1, * tt, * ptr;
-   mp_limb_t c;
-   
-   ii = flint_malloc((4*(n + n*size) + 5*size)*sizeof(mp_limb_t));
-   for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size) 
+   mp_limb_t ** ii, ** jj, ** t1, ** t2, ** s1, ** tt, * ptr;
+   mul_truncate_sqrt2_arg_t arg;
+   slong N;
+
+   /* one set of scratch space for each thread which may take part */
+   N = FLINT_MAX(flint_get_num_threads(), thread_pool_team_size());
+   if (r_limbs < FFT_PARALLEL_CUTOFF)
+      N = 1;
+
+   ii = flint_malloc((4*(n + n*size) + 4*N + 5*size*N)*sizeof(mp_limb_t));
+   for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size)
    {
       ii[i] = ptr;
    }
-   t1 = ptr;
-   t2 = t1 + size;
-   s1 = t2 + size;
-   tt = s1 + size;
-   
+   t1 = (mp_limb_t **) ptr;
+   t2 = t1 + N;
+   s1 = t2 + N;
+   tt = s1 + N;
+   ptr += 4*N;
+   for (i = 0; i < N; i++, ptr += 5*size)
+   {
+      t1[i] = ptr;
+      t2[i] = t1[i] + size;
+      s1[i] = t2[i] + size;
+      tt[i] = s1[i] + size;
+   }
+
    if (i1 != i2)
    {
       jj = flint_malloc(4*(n + n*size)*sizeof(mp_limb_t));
-      for (i = 0, ptr = (mp_limb_t *) jj + 4*n; i < 4*n; i++, ptr += size) 
+      for (i = 0, ptr = (mp_limb_t *) jj + 4*n; i < 4*n; i++, ptr += size)
       {
          jj[i] = ptr;
       }
    } else
       jj = ii;
-   
+
    trunc = j1 + j2 - 1;
    if (trunc <= 2*n) trunc = 2*n + 1; /* trunc must be greater than 2n */
    trunc = 2*((trunc + 1)/2); /* trunc must be divisible by 2 */
 
+   arg.ii = ii;
+   arg.jj = jj;
+   arg.tt = tt;
+   arg.n = n;
+   arg.limbs = limbs;
+   arg.w = w;
+   arg.depth = depth;
+
    j1 = fft_split_bits(ii, i1, n1, bits1, limbs);
    for (j = j1 ; j < 4*n; j++)
       flint_mpn_zero(ii[j], limbs + 1);
-   
-   fft_truncate_sqrt2(ii, n, w, &t1, &t2, &s1, trunc);
-    
+
+   if (N > 1)
+      fft_truncate_sqrt2_threaded(ii, n, w, t1, t2, s1, trunc);
+   else
+      fft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+
    if (i1 != i2)
    {
       j2 = fft_split_bits(jj, i2, n2, bits1, limbs);
       for (j = j2 ; j < 4*n; j++)
          flint_mpn_zero(jj[j], limbs + 1);
-      fft_truncate_sqrt2(jj, n, w, &t1, &t2, &s1, trunc);      
+
+      if (N > 1)
+         fft_truncate_sqrt2_threaded(jj, n, w, t1, t2, s1, trunc);
+      else
+         fft_truncate_sqrt2(jj, n, w, t1, t2, s1, trunc);
    } else j2 = j1;
 
-   for (j = 0; j < trunc; j++)
-   {
-      mpn_normmod_2expp1(ii[j], limbs);
-      if (i1 != i2) mpn_normmod_2expp1(jj[j], limbs);
-      c = 2*ii[j][limbs] + jj[j][limbs];
-      ii[j][limbs] = flint_mpn_mulmod_2expp1_basecase(ii[j], ii[j], jj[j], c, n*w, tt);
-   }
+   if (N > 1)
+      flint_parallel_for(0, trunc, 0, _pointwise_worker, &arg, N);
+   else
+      _pointwise_worker(0, trunc, &arg);
 
-   ifft_truncate_sqrt2(ii, n, w, &t1, &t2, &s1, trunc);
-   for (j = 0; j < trunc; j++)
+   if (N > 1)
+   {
+      ifft_truncate_sqrt2_threaded(ii, n, w, t1, t2, s1, trunc);
+      flint_parallel_for(0, trunc, 0, _normalise_worker, &arg, N);
+   } else
    {
-      mpn_div_2expmod_2expp1(ii[j], ii[j], limbs, depth + 2);
-      mpn_normmod_2expp1(ii[j], limbs);
+      ifft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+      _normalise_worker(0, trunc, &arg);
    }
-   
+
    flint_mpn_zero(r1, r_limbs);
    fft_combine_bits(r1, ii, j1 + j2 - 1, bits1, limbs, r_limbs);
-     
+
    flint_free(ii);
    if (i1 != i2) flint_free(jj);
 }
-
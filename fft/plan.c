@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+#include "thread_support.h"
+
+/*
+   Everything lives in a single block, as the transforms swap the pointers
+   of the coefficients with those of the scratch space.
+*/
+static void _fft_plan_alloc(fft_plan_t P, slong N)
+{
+   slong n = (WORD(1) << P->depth), size = P->limbs + 1, i;
+   mp_limb_t ** block, * ptr;
+
+   block = (mp_limb_t **) flint_malloc((8*n + 4*N
+                                + 8*n*size + 5*N*size)*sizeof(mp_limb_t));
+
+   P->ii = block;
+   P->jj = P->ii + 4*n;
+   P->t1 = P->jj + 4*n;
+   P->t2 = P->t1 + N;
+   P->s1 = P->t2 + N;
+   P->tt = P->s1 + N;
+   P->num_threads = N;
+
+   ptr = (mp_limb_t *) (P->tt + N);
+   for (i = 0; i < 4*n; i++, ptr += size)
+      P->ii[i] = ptr;
+   for (i = 0; i < 4*n; i++, ptr += size)
+      P->jj[i] = ptr;
+   for (i = 0; i < N; i++, ptr += 5*size)
+   {
+      P->t1[i] = ptr;
+      P->t2[i] = ptr + size;
+      P->s1[i] = ptr + 2*size;
+      P->tt[i] = ptr + 3*size;
+   }
+}
+
+void fft_plan_init(fft_plan_t P, slong depth, slong limbs)
+{
+   P->depth = depth;
+   P->limbs = limbs;
+   P->trunc = 0;
+   P->bits = 0;
+   P->n2 = 0;
+   P->j2 = 0;
+
+   _fft_plan_alloc(P, FLINT_MAX(flint_get_num_threads(),
+                                             thread_pool_team_size()));
+}
+
+void fft_plan_clear(fft_plan_t P)
+{
+   flint_free(P->ii);
+}
+
+/*
+   Make sure there is one set of scratch space for each thread which
+   may take part in a transform, keeping the coefficients of both
+   operands.
+*/
+void fft_plan_fit_threads(fft_plan_t P)
+{
+   slong N = FLINT_MAX(flint_get_num_threads(), thread_pool_team_size());
+   slong n = (WORD(1) << P->depth), i;
+   mp_limb_t ** ii, ** jj;
+
+   if (N <= P->num_threads)
+      return;
+
+   ii = P->ii;
+   jj = P->jj;
+
+   _fft_plan_alloc(P, N);
+
+   for (i = 0; i < 4*n; i++)
+   {
+      flint_mpn_copyi(P->ii[i], ii[i], P->limbs + 1);
+      flint_mpn_copyi(P->jj[i], jj[i], P->limbs + 1);
+   }
+
+   flint_free(ii);
+}
+
+void fft_plan_precache(fft_plan_t P, slong trunc)
+{
+   slong n = (WORD(1) << P->depth);
+
+   fft_plan_fit_threads(P);
+
+   P->trunc = FLINT_MAX(trunc, 2*n + 1);
+
+   fft_precache(P->jj, P->depth, P->limbs, P->trunc, P->t1, P->t2, P->s1);
+}
+
+void fft_plan_convolution(fft_plan_t P, slong trunc)
+{
+   slong n = (WORD(1) << P->depth);
+
+   FLINT_ASSERT(trunc <= P->trunc);
+
+   fft_plan_fit_threads(P);
+
+   trunc = FLINT_MAX(trunc, 2*n + 1);
+
+   fft_convolution_precache(P->ii, P->jj, P->depth, P->limbs, trunc,
+                                             P->t1, P->t2, P->s1, P->tt);
+}
@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+#include "profiler.h"
+#include "thread_support.h"
+
+/*
+    Wall time of flint_mpn_mul_fft_main as the number of threads grows,
+    with the speedup over a single thread.
+*/
+
+int
+main(void)
+{
+    mp_size_t int_limbs;
+    slong threads, reps, j;
+    double t1;
+    timeit_t timer;
+
+    FLINT_TEST_INIT(state);
+
+    _flint_rand_init_gmp(state);
+
+    for (int_limbs = 10000; int_limbs <= 10000000; int_limbs *= 10)
+    {
+        mp_limb_t * i1, * i2, * r1;
+
+        i1 = flint_malloc(4*int_limbs*sizeof(mp_limb_t));
+        i2 = i1 + int_limbs;
+        r1 = i2 + int_limbs;
+
+        flint_mpn_urandomb(i1, state->gmp_state, int_limbs*FLINT_BITS);
+        flint_mpn_urandomb(i2, state->gmp_state, int_limbs*FLINT_BITS);
+
+        reps = FLINT_MAX(1, 10000000/int_limbs/10);
+        t1 = 0;
+
+        for (threads = 1; threads <= 16; threads *= 2)
+        {
+            double t;
+
+            flint_set_num_threads(threads);
+
+            timeit_start(timer);
+            for (j = 0; j < reps; j++)
+                flint_mpn_mul_fft_main(r1, i1, int_limbs, i2, int_limbs);
+            timeit_stop(timer);
+
+            t = ((double) timer->wall)/reps;
+            if (threads == 1)
+                t1 = t;
+
+            flint_printf("limbs = %wd, threads = %wd: %.3f ms, speedup %.2f\n",
+                           int_limbs, threads, t, t > 0 ? t1/t : 0.0);
+        }
+
+        flint_free(i1);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    return 0;
+}
@@ -1,5 +1,6 @@
 /* 
     Copyright (C) 2009, 2011, 2020 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -16,105 +17,46 @@
 
 typedef struct
 {
-    volatile mp_size_t * i;
-    slong num;
     mp_size_t coeff_limbs;
     mp_size_t output_limbs;
     mp_srcptr limbs;
     mp_limb_t ** poly;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_t * mutex;
-#endif
 }
 split_limbs_arg_t;
 
 void
-_split_limbs_worker(void * arg_ptr)
+_split_limbs_worker(slong start, slong stop, void * arg_ptr)
 {
     split_limbs_arg_t arg = *((split_limbs_arg_t *) arg_ptr);
-    slong num = arg.num;
-    mp_size_t skip;
     mp_size_t coeff_limbs = arg.coeff_limbs;
     mp_size_t output_limbs = arg.output_limbs;
     mp_srcptr limbs = arg.limbs;
     mp_limb_t ** poly = arg.poly;
-    mp_size_t i, end;
+    mp_size_t i, skip;
 
-    while (1)
+    for (i = start; i < stop; i++)
     {
-#if FLINT_USES_PTHREAD
-        pthread_mutex_lock(arg.mutex);
-#endif
-	i = *arg.i;
-        end = *arg.i = FLINT_MIN(i + 16, num);
-#if FLINT_USES_PTHREAD
-        pthread_mutex_unlock(arg.mutex);
-#endif
+        skip = i*coeff_limbs;
 
-        if (i >= num)
-            return;
-
-        for ( ; i < end; i++)
-        {
-           skip = i*coeff_limbs;
-
-           flint_mpn_zero(poly[i], output_limbs + 1);
-           flint_mpn_copyi(poly[i], limbs + skip, coeff_limbs);
-        }
+        flint_mpn_zero(poly[i], output_limbs + 1);
+        flint_mpn_copyi(poly[i], limbs + skip, coeff_limbs);
     }
 }
 
 mp_size_t fft_split_limbs(mp_limb_t ** poly, mp_srcptr limbs, 
           mp_size_t total_limbs, mp_size_t coeff_limbs, mp_size_t output_limbs)
 {
-    mp_size_t i, shared_i = 0, skip, length = (total_limbs - 1)/coeff_limbs + 1;
+    mp_size_t i, skip, length = (total_limbs - 1)/coeff_limbs + 1;
     mp_size_t num = total_limbs/coeff_limbs;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_t mutex;
-#endif
-    slong num_threads;
-    thread_pool_handle * threads;
-    split_limbs_arg_t * args;
-    
-#if FLINT_USES_PTHREAD
-    pthread_mutex_init(&mutex, NULL);
-#endif
-
-    num_threads = flint_request_threads(&threads,
-                            FLINT_MIN(flint_get_num_threads(), (num + 15)/16));
-
-    args = (split_limbs_arg_t *)
-                     flint_malloc(sizeof(split_limbs_arg_t)*(num_threads + 1));
-
-    for (i = 0; i < num_threads + 1; i++)
-    {
-       args[i].i = &shared_i;
-       args[i].num = num;
-       args[i].coeff_limbs = coeff_limbs;
-       args[i].output_limbs = output_limbs;
-       args[i].limbs = limbs;
-       args[i].poly = poly;
-#if FLINT_USES_PTHREAD
-       args[i].mutex = &mutex;       
-#endif
-    }
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wake(global_thread_pool, threads[i], 0,
-                                                _split_limbs_worker, &args[i]);
-
-    _split_limbs_worker(&args[num_threads]);
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wait(global_thread_pool, threads[i]);
-
-    flint_give_back_threads(threads, num_threads);
+    split_limbs_arg_t arg;
 
-    flint_free(args);
+    arg.coeff_limbs = coeff_limbs;
+    arg.output_limbs = output_limbs;
+    arg.limbs = limbs;
+    arg.poly = poly;
 
-#if FLINT_USES_PTHREAD
-    pthread_mutex_destroy(&mutex);
-#endif
+    flint_parallel_for(0, num, 0, _split_limbs_worker, &arg,
+                            FLINT_MIN(flint_get_num_threads(), (num + 15)/16));
 
     i = num;
     skip = i*coeff_limbs;
@@ -130,25 +72,19 @@ mp_size_t fft_split_limbs(mp_limb_t ** poly, mp_srcptr limbs,
 
 typedef struct
 {
-    volatile mp_size_t * i;
-    slong length;
     mp_size_t coeff_limbs;
     mp_size_t output_limbs;
     mp_srcptr limbs;
     flint_bitcnt_t top_bits;
     mp_limb_t mask;
     mp_limb_t ** poly;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_t * mutex;
-#endif
 }
 split_bits_arg_t;
 
 void
-_split_bits_worker(void * arg_ptr)
+_split_bits_worker(slong start, slong stop, void * arg_ptr)
 {
     split_bits_arg_t arg = *((split_bits_arg_t *) arg_ptr);
-    slong length = arg.length;
     mp_size_t coeff_limbs = arg.coeff_limbs;
     mp_size_t output_limbs = arg.output_limbs;
     mp_srcptr limbs = arg.limbs;
@@ -157,119 +93,63 @@ _split_bits_worker(void * arg_ptr)
     mp_limb_t ** poly = arg.poly;
     flint_bitcnt_t shift_bits;
     mp_srcptr limb_ptr;
-    mp_size_t i, end;
+    mp_size_t i;
 
-    while (1)
+    for (i = start; i < stop; i++)
     {
-#if FLINT_USES_PTHREAD
-        pthread_mutex_lock(arg.mutex);
-#endif
-	i = *arg.i;
-        end = *arg.i = FLINT_MIN(i + 16, length - 1);
-#if FLINT_USES_PTHREAD
-        pthread_mutex_unlock(arg.mutex);
-#endif
-
-        if (i >= length - 1)
-            return;
+        flint_mpn_zero(poly[i], output_limbs + 1);
+      
+        limb_ptr = limbs + i*(coeff_limbs - 1) + (i*top_bits)/FLINT_BITS;
+        shift_bits = (i*top_bits) % FLINT_BITS;
 
-        for ( ; i < end; i++)
+        if (!shift_bits)
         {
-            flint_mpn_zero(poly[i], output_limbs + 1);
-      
-            limb_ptr = limbs + i*(coeff_limbs - 1) + (i*top_bits)/FLINT_BITS;
-            shift_bits = (i*top_bits) % FLINT_BITS;
+            flint_mpn_copyi(poly[i], limb_ptr, coeff_limbs);
+            poly[i][coeff_limbs - 1] &= mask;
+            limb_ptr += (coeff_limbs - 1);
+            shift_bits += top_bits;
+        } else
+        {
+            mpn_rshift(poly[i], limb_ptr, coeff_limbs, shift_bits);
+            limb_ptr += (coeff_limbs - 1);
+            shift_bits += top_bits;
 
-            if (!shift_bits)
-            {
-                flint_mpn_copyi(poly[i], limb_ptr, coeff_limbs);
-                poly[i][coeff_limbs - 1] &= mask;
-                limb_ptr += (coeff_limbs - 1);
-                shift_bits += top_bits;
-            } else
+            if (shift_bits >= FLINT_BITS)
             {
-                mpn_rshift(poly[i], limb_ptr, coeff_limbs, shift_bits);
-                limb_ptr += (coeff_limbs - 1);
-                shift_bits += top_bits;
-
-                if (shift_bits >= FLINT_BITS)
-                {
-                   limb_ptr++;
-                   poly[i][coeff_limbs - 1] +=
-                       (limb_ptr[0] << (FLINT_BITS - (shift_bits - top_bits)));
-                   shift_bits -= FLINT_BITS; 
-                }
-         
-                poly[i][coeff_limbs - 1] &= mask;
-            } 
-        }
+               limb_ptr++;
+               poly[i][coeff_limbs - 1] +=
+                   (limb_ptr[0] << (FLINT_BITS - (shift_bits - top_bits)));
+               shift_bits -= FLINT_BITS; 
+            }
+     
+            poly[i][coeff_limbs - 1] &= mask;
+        } 
     }
 }
 
 mp_size_t fft_split_bits(mp_limb_t ** poly, mp_srcptr limbs, 
                mp_size_t total_limbs, flint_bitcnt_t bits, mp_size_t output_limbs)
 {
-    mp_size_t i, shared_i = 0, coeff_limbs, limbs_left;
+    mp_size_t i, coeff_limbs, limbs_left;
     mp_size_t length = (FLINT_BITS*total_limbs - 1)/bits + 1;
     flint_bitcnt_t shift_bits, top_bits = ((FLINT_BITS - 1) & bits);
     mp_srcptr limb_ptr;
-    mp_limb_t mask;
-#if FLINT_USES_PTHREAD
-    pthread_mutex_t mutex;
-#endif
-    slong num_threads;
-    thread_pool_handle * threads;
-    split_bits_arg_t * args;
+    split_bits_arg_t arg;
    
     if (top_bits == 0)
         return fft_split_limbs(poly, limbs, total_limbs, bits/FLINT_BITS, output_limbs);
 
     coeff_limbs = (bits/FLINT_BITS) + 1;
-    mask = (WORD(1)<<top_bits) - WORD(1);
-    shift_bits = WORD(0);
-    limb_ptr = limbs;                      
-    
-#if FLINT_USES_PTHREAD
-    pthread_mutex_init(&mutex, NULL);
-#endif
-
-    num_threads = flint_request_threads(&threads,
-                     FLINT_MIN(flint_get_num_threads(), (length - 1 + 15)/16));
-
-    args = (split_bits_arg_t *)
-                      flint_malloc(sizeof(split_bits_arg_t)*(num_threads + 1));
 
-    for (i = 0; i < num_threads + 1; i++)
-    {
-       args[i].i = &shared_i;
-       args[i].length = length;
-       args[i].coeff_limbs = coeff_limbs;
-       args[i].output_limbs = output_limbs;
-       args[i].limbs = limbs;
-       args[i].top_bits = top_bits;
-       args[i].mask = mask;
-       args[i].poly = poly;
-#if FLINT_USES_PTHREAD
-       args[i].mutex = &mutex;       
-#endif
-    }
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wake(global_thread_pool, threads[i], 0,
-                                                 _split_bits_worker, &args[i]);
-
-    _split_bits_worker(&args[num_threads]);
-
-    for (i = 0; i < num_threads; i++)
-        thread_pool_wait(global_thread_pool, threads[i]);
+    arg.coeff_limbs = coeff_limbs;
+    arg.output_limbs = output_limbs;
+    arg.limbs = limbs;
+    arg.top_bits = top_bits;
+    arg.mask = (WORD(1)<<top_bits) - WORD(1);
+    arg.poly = poly;
 
-    flint_give_back_threads(threads, num_threads);
-
-    flint_free(args);
-
-#if FLINT_USES_PTHREAD
-    pthread_mutex_destroy(&mutex);
-#endif
+    flint_parallel_for(0, length - 1, 0, _split_bits_worker, &arg,
+                     FLINT_MIN(flint_get_num_threads(), (length - 1 + 15)/16));
 
     i = length - 1;
     limb_ptr = limbs + i*(coeff_limbs - 1) + (i*top_bits)/FLINT_BITS;
@@ -286,4 +166,3 @@ mp_size_t fft_split_bits(mp_limb_t ** poly, mp_srcptr limbs,
      
     return length;
 }
-
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_fft_plan....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    for (iter = 0; iter < 40 * flint_test_multiplier(); iter++)
+    {
+        mp_size_t max_n1, n1, n2, j;
+        mp_limb_t * i1, * i2, * r1, * r2;
+        fft_plan_t P;
+        slong k;
+
+        n2 = 1 + n_randint(state, 1 + n_randint(state, 40000));
+        max_n1 = 1 + n_randint(state, 1 + n_randint(state, 40000));
+
+        /* the fft is only used for reasonably large products */
+        if (n2 + max_n1 < 1000)
+            n2 += 1000;
+
+        i1 = flint_malloc((max_n1 + n2 + 2*(max_n1 + n2))*sizeof(mp_limb_t));
+        i2 = i1 + max_n1;
+        r1 = i2 + n2;
+        r2 = r1 + max_n1 + n2;
+
+        flint_mpn_urandomb(i2, state->gmp_state, n2*FLINT_BITS);
+        if (n_randint(state, 2))
+            i2[n2 - 1] |= (UWORD(1) << (FLINT_BITS - 1));
+
+        fft_plan_init_mpn(P, i2, n2, max_n1);
+
+        for (k = 0; k < 3; k++)
+        {
+            n1 = k == 0 ? max_n1 : 1 + n_randint(state, max_n1);
+
+            flint_set_num_threads(1 + n_randint(state, 4));
+
+            flint_mpn_urandomb(i1, state->gmp_state, n1*FLINT_BITS);
+            if (n_randint(state, 2))
+                i1[n1 - 1] |= (UWORD(1) << (FLINT_BITS - 1));
+
+            if (n1 >= n2)
+                mpn_mul(r2, i1, n1, i2, n2);
+            else
+                mpn_mul(r2, i2, n2, i1, n1);
+
+            flint_mpn_mul_fft_plan(r1, i1, n1, P);
+
+            for (j = 0; j < n1 + n2; j++)
+            {
+                if (r1[j] != r2[j])
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("error in limb %wd, %wx != %wx\n",
+                                                          j, r1[j], r2[j]);
+                    flint_printf("n1 = %wd, n2 = %wd, max_n1 = %wd\n",
+                                                          n1, n2, max_n1);
+                    abort();
+                }
+            }
+        }
+
+        fft_plan_clear(P);
+        flint_free(i1);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+#include "thread_support.h"
+
+#define NUM_SCRATCH 8
+
+int
+main(void)
+{
+    flint_bitcnt_t depth, w;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_truncate_sqrt2_threaded....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    /* threaded transforms agree with the serial ones */
+    for (depth = 8; depth <= 11; depth++)
+    {
+        for (w = 1; w <= 3; w++)
+        {
+            mp_size_t n = (UWORD(1)<<depth);
+            mp_size_t trunc = 2*n + 2*n_randint(state, n) + 2;
+            mp_size_t limbs = (n*w)/FLINT_BITS;
+            mp_size_t size = limbs + 1;
+            mp_size_t i;
+            mp_limb_t ** ii, ** jj, * t1[NUM_SCRATCH], * t2[NUM_SCRATCH];
+            mp_limb_t * s1[NUM_SCRATCH], * ptr;
+
+            flint_set_num_threads(1 + n_randint(state, NUM_SCRATCH));
+
+            ii = flint_malloc((8*(n + n*size) + 3*NUM_SCRATCH*size)*sizeof(mp_limb_t));
+            jj = ii + 4*n;
+            for (i = 0, ptr = (mp_limb_t *) ii + 8*n; i < 4*n; i++, ptr += size)
+            {
+                ii[i] = ptr;
+                random_fermat(ii[i], state, limbs);
+            }
+            for (i = 0; i < 4*n; i++, ptr += size)
+            {
+                jj[i] = ptr;
+                flint_mpn_copyi(jj[i], ii[i], size);
+            }
+            for (i = 0; i < NUM_SCRATCH; i++, ptr += 3*size)
+            {
+                t1[i] = ptr;
+                t2[i] = t1[i] + size;
+                s1[i] = t2[i] + size;
+            }
+
+            fft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+            fft_truncate_sqrt2_threaded(jj, n, w, t1, t2, s1, trunc);
+
+            for (i = 0; i < trunc; i++)
+            {
+                mpn_normmod_2expp1(ii[i], limbs);
+                mpn_normmod_2expp1(jj[i], limbs);
+
+                if (mpn_cmp(ii[i], jj[i], size) != 0)
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("fft error in entry %wd, depth = %wu, w = %wu, "
+                           "trunc = %wd\n", i, depth, w, trunc);
+                    abort();
+                }
+            }
+
+            ifft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+            ifft_truncate_sqrt2_threaded(jj, n, w, t1, t2, s1, trunc);
+
+            for (i = 0; i < trunc; i++)
+            {
+                mpn_normmod_2expp1(ii[i], limbs);
+                mpn_normmod_2expp1(jj[i], limbs);
+
+                if (mpn_cmp(ii[i], jj[i], size) != 0)
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("ifft error in entry %wd, depth = %wu, w = %wu, "
+                           "trunc = %wd\n", i, depth, w, trunc);
+                    abort();
+                }
+            }
+
+            flint_free(ii);
+        }
+    }
+
+    /* multiplication and squaring */
+    for (depth = 6; depth <= 12; depth++)
+    {
+        for (w = 1; w <= 5; w++)
+        {
+            mp_size_t n = (UWORD(1)<<depth);
+            flint_bitcnt_t bits1 = (n*w - (depth + 1))/2;
+            mp_size_t trunc = 2*n + 2*n_randint(state, n) + 2; /* trunc is even */
+            flint_bitcnt_t bits = (trunc/2)*bits1;
+            mp_size_t int_limbs = (bits - 1)/FLINT_BITS + 1;
+            mp_size_t j;
+            mp_limb_t * i1, *i2, *r1, *r2;
+            int square = n_randint(state, 2);
+
+            flint_set_num_threads(1 + n_randint(state, NUM_SCRATCH));
+
+            i1 = flint_malloc(6*int_limbs*sizeof(mp_limb_t));
+            i2 = square ? i1 : i1 + int_limbs;
+            r1 = i1 + 2*int_limbs;
+            r2 = r1 + 2*int_limbs;
+
+            random_fermat(i1, state, int_limbs);
+            random_fermat(i2, state, int_limbs);
+
+            mpn_mul(r2, i1, int_limbs, i2, int_limbs);
+
+            if (n_randint(state, 2) || depth < 10 || (w & (w - 1)) != 0)
+                mul_truncate_sqrt2(r1, i1, int_limbs, i2, int_limbs, depth, w);
+            else
+                mul_mfa_truncate_sqrt2(r1, i1, int_limbs, i2, int_limbs,
+                                                                 depth, w);
+
+            for (j = 0; j < 2*int_limbs; j++)
+            {
+                if (r1[j] != r2[j])
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("error in limb %wd, %wx != %wx\n", j, r1[j], r2[j]);
+                    flint_printf("depth = %wu, w = %wu, threads = %d\n",
+                                          depth, w, flint_get_num_threads());
+                    abort();
+                }
+            }
+
+            flint_free(i1);
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
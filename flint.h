@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -386,7 +387,54 @@ mp_limb_t FLINT_BIT_COUNT(mp_limb_t x)
 #define FLINT_ARRAY_ALLOC(n, T) (T *) flint_malloc((n)*sizeof(T))
 #define FLINT_ARRAY_REALLOC(p, n, T) (T *) flint_realloc(p, (n)*sizeof(T))
 
+/* arena allocation */
+#define FLINT_ARENA_MIN_CHUNK 65536            /* bytes in the first chunk */
+#define FLINT_ARENA_MAX_RETAIN (WORD(1) << 22) /* largest spare chunk kept */
+
+/*
+   The arena is thread local, so it is only used by TMP_ALLOC when FLINT is
+   either built with TLS or is not required to be thread safe.
+*/
+#if !FLINT_USES_GC && (FLINT_USES_TLS || !FLINT_REENTRANT)
+#define FLINT_USES_ARENA 1
+#else
+#define FLINT_USES_ARENA 0
+#endif
+
+typedef struct
+{
+    void * chunk;
+    size_t used;
+    size_t in_use;
+    int active;
+} flint_arena_mark_struct;
+
+typedef flint_arena_mark_struct flint_arena_mark_t[1];
+
+typedef struct
+{
+    size_t in_use;      /* bytes handed out and not yet released */
+    size_t peak;        /* largest value of in_use */
+    size_t reserved;    /* bytes held in chunks */
+    ulong num_allocs;   /* number of calls to flint_arena_alloc */
+    ulong num_chunks;   /* number of chunks obtained from flint_malloc */
+} flint_arena_stats_struct;
+
+typedef flint_arena_stats_struct flint_arena_stats_t[1];
+
+FLINT_DLL void * flint_arena_alloc(size_t size);
+FLINT_DLL void flint_arena_mark(flint_arena_mark_t mark);
+FLINT_DLL void flint_arena_release(const flint_arena_mark_t mark);
+FLINT_DLL void * flint_arena_tmp_alloc(flint_arena_mark_t mark, size_t size);
+FLINT_DLL void flint_arena_get_stats(flint_arena_stats_t stats);
+FLINT_DLL void flint_arena_get_global_stats(flint_arena_stats_t stats);
+FLINT_DLL void flint_arena_reset_stats(void);
+
+#define FLINT_ARENA_ARRAY_ALLOC(n, T) (T *) flint_arena_alloc((n)*sizeof(T))
+
 /* temporary allocation */
+#if FLINT_WANT_ASSERT || !FLINT_USES_ARENA
+
 #define TMP_INIT \
    typedef struct __tmp_struct { \
       void * block; \
@@ -414,14 +462,34 @@ mp_limb_t FLINT_BIT_COUNT(mp_limb_t x)
       alloca(size))
 #endif
 
-#define TMP_ARRAY_ALLOC(n, T) (T *) TMP_ALLOC((n)*sizeof(T))
-
 #define TMP_END \
    while (__tmp_root) { \
       flint_free(__tmp_root->block); \
       __tmp_root = __tmp_root->next; \
    }
 
+#else
+
+/* large blocks come from the arena, which is only marked if it is used */
+#define TMP_INIT \
+   flint_arena_mark_t __tmp_mark
+
+#define TMP_START \
+   __tmp_mark->active = 0
+
+#define TMP_ALLOC(size) \
+   (((size) > 8192) ? flint_arena_tmp_alloc(__tmp_mark, (size)) : alloca(size))
+
+#define TMP_END \
+   do { \
+      if (__tmp_mark->active) \
+         flint_arena_release(__tmp_mark); \
+   } while (0)
+
+#endif
+
+#define TMP_ARRAY_ALLOC(n, T) (T *) TMP_ALLOC((n)*sizeof(T))
+
 /* compatibility between gmp and mpir */
 #ifndef mpn_com_n
 #define mpn_com_n mpn_com
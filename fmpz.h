@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -101,6 +102,16 @@ void _fmpz_demote(fmpz_t f)
 
 FLINT_DLL void _fmpz_demote_val(fmpz_t f);
 
+/* operands of at most this many limbs are combined on the stack */
+#define FMPZ_MPN_INLINE_LIMBS 32
+
+FLINT_DLL void _fmpz_set_mpn(fmpz_t f, mp_srcptr x, mp_size_t n, int neg);
+
+FLINT_DLL void _fmpz_add_mpn(fmpz_t f, mp_srcptr x, mp_size_t xn, int neg);
+
+FLINT_DLL void _fmpz_addmul_mpz(fmpz_t f, const __mpz_struct * g,
+                                           const __mpz_struct * h, int sub);
+
 FLINT_DLL void _fmpz_init_readonly_mpz(fmpz_t f, const mpz_t z);
 
 FLINT_DLL void _fmpz_clear_readonly_mpz(mpz_t);
@@ -782,6 +793,9 @@ FLINT_DLL void _fmpz_CRT_ui_precomp(fmpz_t out, const fmpz_t r1, const fmpz_t m1
 FLINT_DLL void fmpz_CRT_ui(fmpz_t out, const fmpz_t r1, const fmpz_t m1,
     ulong r2, ulong m2, int sign);
 
+FLINT_DLL void _fmpz_CRT(fmpz_t out, const fmpz_t r1, const fmpz_t m1,
+    fmpz_t r2, fmpz_t m2, const fmpz_t m1m2, fmpz_t c, int sign);
+
 FLINT_DLL void fmpz_CRT(fmpz_t out, const fmpz_t r1, const fmpz_t m1,
                                                fmpz_t r2, fmpz_t m2, int sign);
 
@@ -0,0 +1,74 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void _fmpz_add_mpn(fmpz_t f, mp_srcptr x, mp_size_t xn, int neg)
+{
+    __mpz_struct * z = _fmpz_promote_val(f);
+    mp_size_t zn = z->_mp_size, n;
+    mp_ptr d;
+    int zneg = (zn < 0);
+
+    zn = FLINT_ABS(zn);
+
+    if (zn == 0 || zneg == neg)
+    {
+        mp_limb_t cy;
+
+        n = FLINT_MAX(zn, xn);
+
+        if (z->_mp_alloc <= n)
+            _mpz_realloc(z, n + 1);
+
+        d = z->_mp_d;
+
+        if (zn >= xn)
+            cy = mpn_add(d, d, zn, x, xn);
+        else
+            cy = mpn_add(d, x, xn, d, zn);
+
+        d[n] = cy;
+        n += (cy != 0);
+
+        z->_mp_size = neg ? -n : n;
+    }
+    else
+    {
+        int cmp = (zn != xn) ? (zn > xn ? 1 : -1) : mpn_cmp(z->_mp_d, x, xn);
+
+        if (cmp >= 0)
+        {
+            d = z->_mp_d;
+            mpn_sub(d, d, zn, x, xn);
+            n = zn;
+        }
+        else
+        {
+            if (z->_mp_alloc < xn)
+                _mpz_realloc(z, xn);
+
+            d = z->_mp_d;
+            mpn_sub(d, x, xn, d, zn);
+            n = xn;
+            zneg = neg;
+        }
+
+        while (n > 0 && d[n - 1] == 0)
+            n--;
+
+        z->_mp_size = zneg ? -n : n;
+    }
+
+    _fmpz_demote_val(f);
+}
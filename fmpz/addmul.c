@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,7 +18,6 @@
 void fmpz_addmul(fmpz_t f, const fmpz_t g, const fmpz_t h)
 {
     fmpz c1, c2;
-    __mpz_struct * mpz_ptr;
 	
     c1 = *g;
 	
@@ -38,7 +38,5 @@ void fmpz_addmul(fmpz_t f, const fmpz_t g, const fmpz_t h)
 	} 
 
 	/* both g and h are large */
-    mpz_ptr = _fmpz_promote_val(f);
-    mpz_addmul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
-    _fmpz_demote_val(f);  /* cancellation may have occurred	*/
+    _fmpz_addmul_mpz(f, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2), 0);
 }
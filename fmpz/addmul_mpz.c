@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void _fmpz_addmul_mpz(fmpz_t f, const __mpz_struct * g,
+                                          const __mpz_struct * h, int sub)
+{
+    mp_size_t gn = g->_mp_size, hn = h->_mp_size, n;
+    int neg = ((gn ^ hn) < 0) ^ sub;
+
+    gn = FLINT_ABS(gn);
+    hn = FLINT_ABS(hn);
+    n = gn + hn;
+
+    if (n <= FMPZ_MPN_INLINE_LIMBS)
+    {
+        /* form the product on the stack, then add it directly to f */
+        mp_limb_t t[FMPZ_MPN_INLINE_LIMBS];
+
+        if (gn >= hn)
+            mpn_mul(t, g->_mp_d, gn, h->_mp_d, hn);
+        else
+            mpn_mul(t, h->_mp_d, hn, g->_mp_d, gn);
+
+        n -= (t[n - 1] == 0);
+
+        _fmpz_add_mpn(f, t, n, neg);
+    }
+    else
+    {
+        __mpz_struct * z = _fmpz_promote_val(f);
+
+        if (sub)
+            mpz_submul(z, g, h);
+        else
+            mpz_addmul(z, g, h);
+
+        _fmpz_demote_val(f);  /* cancellation may have occurred */
+    }
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -15,6 +16,47 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
+
+/*
+    Floor division of large operands of at most FMPZ_MPN_INLINE_LIMBS limbs,
+    working on the limbs directly so that the quotient is adjusted without
+    any temporary integers. Returns 0 if the operands are not suitable.
+*/
+static int
+_fmpz_fdiv_qr_mpn(fmpz_t f, fmpz_t s, const __mpz_struct * g,
+                                           const __mpz_struct * h)
+{
+    mp_limb_t q[FMPZ_MPN_INLINE_LIMBS + 1], r[FMPZ_MPN_INLINE_LIMBS];
+    mp_size_t gn = FLINT_ABS(g->_mp_size), hn = FLINT_ABS(h->_mp_size);
+    mp_size_t qn, rn;
+    int neg = ((g->_mp_size ^ h->_mp_size) < 0), hneg = (h->_mp_size < 0);
+
+    if (gn < hn || gn > FMPZ_MPN_INLINE_LIMBS)
+        return 0;
+
+    mpn_tdiv_qr(q, r, 0, g->_mp_d, gn, h->_mp_d, hn);
+
+    qn = gn - hn + 1;
+    rn = hn;
+    MPN_NORM(r, rn);
+
+    if (neg && rn != 0)         /* round the quotient towards -infinity */
+    {
+        q[qn] = mpn_add_1(q, q, qn, 1);
+        qn++;
+        mpn_sub(r, h->_mp_d, hn, r, rn);
+        rn = hn;
+        MPN_NORM(r, rn);
+    }
+
+    MPN_NORM(q, qn);
+
+    _fmpz_set_mpn(f, q, qn, neg);
+    _fmpz_set_mpn(s, r, rn, hneg);
+
+    return 1;
+}
 
 void
 fmpz_fdiv_qr(fmpz_t f, fmpz_t s, const fmpz_t g, const fmpz_t h)
@@ -63,6 +105,11 @@ fmpz_fdiv_qr(fmpz_t f, fmpz_t s, const fmpz_t g, const fmpz_t h)
             }
         }
     }
+    else if (COEFF_IS_MPZ(c2) && _fmpz_fdiv_qr_mpn(f, s, COEFF_TO_PTR(c1),
+                                                          COEFF_TO_PTR(c2)))
+    {
+        return;                 /* both are large, but fit on the stack */
+    }
     else                        /* g is large */
     {
         __mpz_struct *mpz_ptr, *mpz_ptr2;
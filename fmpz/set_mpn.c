@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void _fmpz_set_mpn(fmpz_t f, mp_srcptr x, mp_size_t n, int neg)
+{
+    if (n <= 1)
+    {
+        ulong v = (n == 0) ? UWORD(0) : x[0];
+
+        if (neg)
+            fmpz_neg_ui(f, v);
+        else
+            fmpz_set_ui(f, v);
+    }
+    else
+    {
+        __mpz_struct * z = _fmpz_promote(f);
+
+        if (z->_mp_alloc < n)
+            _mpz_realloc(z, n);
+
+        flint_mpn_copyi(z->_mp_d, x, n);
+        z->_mp_size = neg ? -n : n;
+    }
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -37,9 +38,7 @@ fmpz_submul(fmpz_t f, const fmpz_t g, const fmpz_t h)
         }
         else                    /* both g and h are large */
         {
-            __mpz_struct *mpz_ptr = _fmpz_promote_val(f);
-            mpz_submul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
-            _fmpz_demote_val(f);    /* cancellation may have occurred */
+            _fmpz_addmul_mpz(f, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2), 1);
         }
     }
 }
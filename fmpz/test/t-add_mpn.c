@@ -0,0 +1,162 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "mpn_extras.h"
+
+/* large values must not fit in a small fmpz */
+static int
+canonical(const fmpz_t f)
+{
+    __mpz_struct * z;
+
+    if (!COEFF_IS_MPZ(*f))
+        return 1;
+
+    z = COEFF_TO_PTR(*f);
+
+    return !(z->_mp_size == 0 || ((z->_mp_size == 1 || z->_mp_size == -1)
+                                  && z->_mp_d[0] <= COEFF_MAX));
+}
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("add_mpn....");
+    fflush(stdout);
+
+    _flint_rand_init_gmp(state);
+
+    /* check _fmpz_add_mpn and _fmpz_set_mpn against mpz */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b;
+        mpz_t c, d, e;
+        mp_limb_t x[40];
+        mp_size_t xn;
+        int neg;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        mpz_init(c);
+        mpz_init(e);
+
+        xn = 1 + n_randint(state, 40);
+        flint_mpn_rrandom(x, state->gmp_state, xn);
+        if (n_randint(state, 4) == 0)
+            x[xn - 1] = 1;
+        if (x[xn - 1] == 0)
+            x[xn - 1] = 1;
+        neg = n_randint(state, 2);
+
+        fmpz_randtest(a, state, 1 + n_randint(state, 3000));
+        if (n_randint(state, 4) == 0)
+        {
+            /* make a agree with the high limbs of -x to force cancellation */
+            _fmpz_set_mpn(a, x, xn, !neg);
+            fmpz_add_ui(a, a, n_randint(state, 3));
+        }
+
+        fmpz_get_mpz(c, a);
+        d->_mp_d = x;
+        d->_mp_size = neg ? -xn : xn;
+        d->_mp_alloc = xn;
+        mpz_add(e, c, d);
+
+        _fmpz_add_mpn(a, x, xn, neg);
+        fmpz_get_mpz(c, a);
+
+        result = (mpz_cmp(c, e) == 0 && canonical(a));
+
+        _fmpz_set_mpn(b, x, xn, neg);
+        fmpz_get_mpz(e, b);
+
+        result = (result && mpz_cmp(e, d) == 0 && canonical(b));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            gmp_printf("c = %Zd, d = %Zd, e = %Zd\n", c, d, e);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        mpz_clear(c);
+        mpz_clear(e);
+    }
+
+    /* check _fmpz_addmul_mpz on both sides of FMPZ_MPN_INLINE_LIMBS */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c;
+        mpz_t d, e, f, g;
+        int sub = n_randint(state, 2);
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+        mpz_init(d);
+        mpz_init(e);
+        mpz_init(f);
+        mpz_init(g);
+
+        do {
+            fmpz_randtest(a, state, 1 + n_randint(state, 1200));
+        } while (!COEFF_IS_MPZ(*a));
+        do {
+            fmpz_randtest(b, state, 1 + n_randint(state, 1200));
+        } while (!COEFF_IS_MPZ(*b));
+        fmpz_randtest(c, state, 1 + n_randint(state, 2500));
+
+        fmpz_get_mpz(d, a);
+        fmpz_get_mpz(e, b);
+        fmpz_get_mpz(f, c);
+
+        if (sub)
+            mpz_submul(f, d, e);
+        else
+            mpz_addmul(f, d, e);
+
+        _fmpz_addmul_mpz(c, COEFF_TO_PTR(*a), COEFF_TO_PTR(*b), sub);
+        fmpz_get_mpz(g, c);
+
+        result = (mpz_cmp(f, g) == 0 && canonical(c));
+        if (!result)
+        {
+            flint_printf("FAIL (addmul):\n");
+            gmp_printf("d = %Zd, e = %Zd, f = %Zd, g = %Zd\n", d, e, f, g);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+        mpz_clear(d);
+        mpz_clear(e);
+        mpz_clear(f);
+        mpz_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2009, 2010 William Hart
     Copyright (C) 2009, 2010 Andy Novocin
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -41,6 +42,9 @@
 
 #define SIZE_RED_FAILURE_THRESH 5
 
+/* bit size below which the recursive strategy reduces at full precision */
+#define FMPZ_LLL_RECURSIVE_CUTOFF 512
+
 typedef enum
 {
     GRAM,
@@ -53,12 +57,19 @@ typedef enum
     EXACT
 } gram_type;
 
+typedef enum
+{
+    ITERATIVE,
+    RECURSIVE
+} strategy_type;
+
 typedef struct
 {
     double delta;
     double eta;
     rep_type rt;
     gram_type gt;
+    strategy_type st;
 } fmpz_lll_struct;
 
 typedef fmpz_lll_struct fmpz_lll_t[1];
@@ -102,6 +113,10 @@ FLINT_DLL int fmpz_lll_d(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
 
 FLINT_DLL int fmpz_lll_d_heuristic(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
 
+FLINT_DLL int _fmpz_lll_d_householder(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl);
+
+FLINT_DLL int fmpz_lll_d_householder(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
+
 FLINT_DLL int fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U, mpf_mat_t mu, mpf_mat_t r, mpf *s,
        mpf_mat_t appB, fmpz_gram_t A,
        int a, int zeros, int kappamax, int n, mpf_t tmp, mpf_t rtmp, flint_bitcnt_t prec, const fmpz_lll_t fl);
@@ -126,6 +141,8 @@ FLINT_DLL int fmpz_lll_d_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t g
 
 FLINT_DLL int fmpz_lll_d_heuristic_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl);
 
+FLINT_DLL int fmpz_lll_d_householder_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl);
+
 FLINT_DLL int fmpz_lll_mpf2_with_removal(fmpz_mat_t B, fmpz_mat_t U, flint_bitcnt_t prec, const fmpz_t gs_B, const fmpz_lll_t fl);
 
 FLINT_DLL int fmpz_lll_mpf_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl);
@@ -140,6 +157,14 @@ FLINT_DLL int fmpz_lll_wrapper_with_removal_knapsack(fmpz_mat_t B, fmpz_mat_t U,
 
 FLINT_DLL int fmpz_lll_with_removal_ulll(fmpz_mat_t FM, fmpz_mat_t UM, slong new_size, const fmpz_t gs_B, const fmpz_lll_t fl);
 
+/* Recursive LLL  ************************************************************/
+
+FLINT_DLL int _fmpz_lll_recursive(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl, int knapsack);
+
+FLINT_DLL int fmpz_lll_recursive(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
+
+FLINT_DLL int fmpz_lll_recursive_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl);
+
 /* LLL-reducedness ***********************************************************/
 
 FLINT_DLL int fmpz_lll_is_reduced_d(const fmpz_mat_t B, const fmpz_lll_t fl);
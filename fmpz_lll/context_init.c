@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -21,4 +22,5 @@ fmpz_lll_context_init(fmpz_lll_t fl, double delta, double eta, rep_type rt,
     fl->eta = eta;
     fl->rt = rt;
     fl->gt = gt;
+    fl->st = ITERATIVE;
 }
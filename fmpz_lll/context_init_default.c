@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -20,4 +21,5 @@ fmpz_lll_context_init_default(fmpz_lll_t fl)
     fl->eta = 0.51;
     fl->rt = Z_BASIS;
     fl->gt = APPROX;
+    fl->st = ITERATIVE;
 }
@@ -2,6 +2,7 @@
     Copyright (C) 2009, 2010 William Hart
     Copyright (C) 2009, 2010 Andy Novocin
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -16,5 +17,8 @@
 void
 fmpz_lll(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
 {
-    fmpz_lll_with_removal_ulll(B, U, WORD(250), NULL, fl);
+    if (fl->rt == Z_BASIS && fl->st == RECURSIVE)
+        _fmpz_lll_recursive(B, U, NULL, fl, 1);
+    else
+        fmpz_lll_with_removal_ulll(B, U, WORD(250), NULL, fl);
 }
@@ -0,0 +1,346 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <float.h>
+#include "fmpz_lll.h"
+
+/*
+   L^2 with the R factor of a Householder QR decomposition of the basis
+   in place of the Cholesky factor of the Gram matrix, as in fplll.
+
+   Row k of B is approximated by a vector of doubles times 2^expo[k] and
+   the reflectors of the rows before it are applied to give row k of R,
+   scaled by 2^-expo[k]. Size reduction uses R and is repeated from the
+   exact row until no multiple can be removed. The reflector of row k is
+   stored in V, normalised so that H = I - v v^T. Rows are padded to
+   max(n, d) entries so that linearly dependent rows need no special
+   treatment until they have been reduced to zero.
+*/
+
+/* four independent sums, which the compiler can keep in vector registers */
+static double
+_hh_dot(const double * x, const double * y, slong len)
+{
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        s0 += x[i + 0] * y[i + 0];
+        s1 += x[i + 1] * y[i + 1];
+        s2 += x[i + 2] * y[i + 2];
+        s3 += x[i + 3] * y[i + 3];
+    }
+
+    for ( ; i < len; i++)
+        s0 += x[i] * y[i];
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+/* x = x - a*y */
+static void
+_hh_submul(double * x, double a, const double * y, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        x[i] -= a * y[i];
+}
+
+/* moves row j of B (and U) up to row i < j */
+static void
+_hh_rotate(fmpz_mat_t B, fmpz_mat_t U, slong i, slong j)
+{
+    fmpz * t;
+    slong l;
+
+    t = B->rows[j];
+    for (l = j; l > i; l--)
+        B->rows[l] = B->rows[l - 1];
+    B->rows[i] = t;
+
+    if (U != NULL)
+    {
+        t = _fmpz_vec_init(U->c);
+        _fmpz_vec_set(t, U->rows[j], U->c);
+        for (l = j; l > i; l--)
+            _fmpz_vec_set(U->rows[l], U->rows[l - 1], U->c);
+        _fmpz_vec_set(U->rows[i], t, U->c);
+        _fmpz_vec_clear(t, U->c);
+    }
+}
+
+/*
+   Sets row k of R from row k of B and size reduces row k against rows
+   zeros, ..., k - 1. Returns 0 if the size reduction stops making
+   progress, which happens when the precision is insufficient.
+*/
+static int
+_hh_size_reduce(fmpz_mat_t B, fmpz_mat_t U, d_mat_t R, const d_mat_t V,
+                int * expo, slong k, slong zeros, slong W, double halfplus)
+{
+    double * x = R->rows[k];
+    double ratio, fr, mu, f;
+    slong j, c, n = B->c, e, xm, xe, fails = 0, prev_expo = WORD_MAX;
+    int changed, re;
+
+    while (1)
+    {
+        expo[k] = _fmpz_vec_get_d_vec_2exp(x, B->rows[k], n);
+        for (c = n; c < W; c++)
+            x[c] = 0.0;
+
+        for (j = zeros; j < k; j++)
+        {
+            c = j - zeros;
+            _hh_submul(x + c, _hh_dot(V->rows[j] + c, x + c, W - c),
+                                                     V->rows[j] + c, W - c);
+        }
+
+        changed = 0;
+
+        for (j = k - 1; j >= zeros; j--)
+        {
+            c = j - zeros;
+
+            if (d_mat_entry(R, j, c) == 0.0 || x[c] == 0.0)
+                continue;
+
+            ratio = x[c] / d_mat_entry(R, j, c);
+            e = expo[k] - expo[j];
+
+            if (!(fabs(ratio) <= DBL_MAX))
+                return 0;
+
+            fr = frexp(ratio, &re);
+
+            if (re + e < CPU_SIZE_1 - 2)
+            {
+                mu = ldexp(ratio, e);
+
+                if (fabs(mu) <= halfplus)
+                    continue;
+
+                mu = floor(mu + 0.5);
+                f = ldexp(mu, -e);
+
+                _fmpz_vec_scalar_submul_si(B->rows[k], B->rows[j], n,
+                                                                  (slong) mu);
+                if (U != NULL)
+                    _fmpz_vec_scalar_submul_si(U->rows[k], U->rows[j], U->c,
+                                                                  (slong) mu);
+            }
+            else
+            {
+                /* only the leading bits of mu are known */
+                xm = (slong) ldexp(fr, CPU_SIZE_1 - 2);
+                xe = re + e - (CPU_SIZE_1 - 2);
+                f = ldexp((double) xm, xe - e);
+
+                _fmpz_vec_scalar_submul_si_2exp(B->rows[k], B->rows[j], n,
+                                                                      xm, xe);
+                if (U != NULL)
+                    _fmpz_vec_scalar_submul_si_2exp(U->rows[k], U->rows[j],
+                                                              U->c, xm, xe);
+            }
+
+            _hh_submul(x, f, R->rows[j], c + 1);
+            changed = 1;
+        }
+
+        if (!changed)
+            break;
+
+        if (expo[k] >= prev_expo)
+        {
+            if (++fails > SIZE_RED_FAILURE_THRESH)
+                break;
+        }
+        else
+            fails = 0;
+
+        prev_expo = expo[k];
+    }
+
+    return !changed;
+}
+
+/* computes the reflector of row k and the diagonal entry of R */
+static void
+_hh_reflect(d_mat_t R, d_mat_t V, slong k, slong zeros, slong W)
+{
+    double * x = R->rows[k];
+    double * v = V->rows[k];
+    double nrm, alpha, t;
+    slong i, c = k - zeros;
+
+    nrm = sqrt(_hh_dot(x + c, x + c, W - c));
+
+    for (i = 0; i < W; i++)
+        v[i] = 0.0;
+
+    if (nrm == 0.0)
+        return;
+
+    alpha = (x[c] >= 0.0) ? -nrm : nrm;
+
+    for (i = c; i < W; i++)
+        v[i] = x[i];
+    v[c] -= alpha;
+
+    t = sqrt(2.0 / _hh_dot(v + c, v + c, W - c));
+    for (i = c; i < W; i++)
+        v[i] *= t;
+
+    x[c] = alpha;
+    for (i = c + 1; i < W; i++)
+        x[i] = 0.0;
+}
+
+int
+_fmpz_lll_d_householder(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B,
+                                                         const fmpz_lll_t fl)
+{
+    slong d, n, W, k, kappa, zeros, i, c;
+    d_mat_t R, V;
+    double * s;
+    double ctt, halfplus, tmp;
+    int * expo;
+    int newd = 0;
+    ulong max_exp, iter, max_iter;
+
+    if (fl->rt != Z_BASIS)
+        return -1;
+
+    d = B->r;
+    n = B->c;
+
+    if (U != NULL)
+    {
+        if (U->r != d)
+        {
+            flint_printf
+                ("Exception (fmpz_lll_d_householder*). Incompatible dimensions of capturing matrix.\n");
+            flint_abort();
+        }
+    }
+
+    if (d == 0)
+        return 0;
+
+    W = FLINT_MAX(n, d);
+
+    ctt = (fl->delta + 1) / 2;
+    halfplus = (fl->eta + 0.5) / 2;
+
+    d_mat_init(R, d, W);
+    d_mat_init(V, d, W);
+    s = _d_vec_init(d);
+    expo = (int *) flint_malloc(d * sizeof(int));
+
+    max_exp = FLINT_ABS(fmpz_mat_max_bits(B));
+    max_iter =
+        (ulong) (2 * d +
+                 (d - 1) * d * (2 * max_exp +
+                                d_log2(d)) / d_log2(8 / (fl->delta + 7)));
+
+    zeros = 0;
+    k = 0;
+    iter = 0;
+
+    while (k < d)
+    {
+        if (iter >= max_iter)
+            break;
+        iter++;
+
+        if (!_hh_size_reduce(B, U, R, V, expo, k, zeros, W, halfplus))
+            break;
+
+        if (_fmpz_vec_is_zero(B->rows[k], n))
+        {
+            /* zero vectors go to the front, the rows they pass are redone */
+            _hh_rotate(B, U, zeros, k);
+            zeros++;
+            k = zeros;
+            continue;
+        }
+
+        _hh_reflect(R, V, k, zeros, W);
+
+        /* s[c] is the squared norm of row k projected away from c rows */
+        c = k - zeros;
+        s[c] = d_mat_entry(R, k, c) * d_mat_entry(R, k, c);
+        for (i = c - 1; i >= 0; i--)
+            s[i] = s[i + 1] + d_mat_entry(R, k, i) * d_mat_entry(R, k, i);
+
+        /* Lovasz condition, inserting row k as far up as it fails */
+        kappa = k;
+        while (kappa > zeros)
+        {
+            c = kappa - 1 - zeros;
+            tmp = d_mat_entry(R, kappa - 1, c) * d_mat_entry(R, kappa - 1, c);
+            tmp = ldexp(tmp * ctt, 2 * (expo[kappa - 1] - expo[k]));
+
+            if (tmp <= s[c])
+                break;
+
+            kappa--;
+        }
+
+        if (kappa < k)
+        {
+            _hh_rotate(B, U, kappa, k);
+            k = kappa;
+        }
+        else
+        {
+            k++;
+        }
+    }
+
+    if (k >= d && gs_B != NULL)
+    {
+        fmpz_t rii;
+        int ok = 1;
+
+        newd = d;
+        fmpz_init(rii);
+        for (i = d - 1; (i >= zeros) && (ok > 0); i--)
+        {
+            /* rii is the G-S length of ith vector divided by 2 */
+            c = i - zeros;
+            tmp = d_mat_entry(R, i, c) * d_mat_entry(R, i, c);
+            fmpz_set_d_2exp(rii, tmp, 2 * expo[i] - 1);
+            if ((ok = fmpz_cmp(rii, gs_B)) > 0)
+                newd--;
+        }
+        fmpz_clear(rii);
+    }
+
+    d_mat_clear(R);
+    d_mat_clear(V);
+    _d_vec_clear(s);
+    flint_free(expo);
+
+    if (k < d)
+        return -1;
+
+    return newd;
+}
+
+int
+fmpz_lll_d_householder(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
+{
+    return _fmpz_lll_d_householder(B, U, NULL, fl);
+}
@@ -0,0 +1,19 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_lll.h"
+
+int
+fmpz_lll_d_householder_with_removal(fmpz_mat_t B, fmpz_mat_t U,
+                                  const fmpz_t gs_B, const fmpz_lll_t fl)
+{
+    return _fmpz_lll_d_householder(B, U, gs_B, fl);
+}
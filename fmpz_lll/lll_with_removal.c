@@ -2,6 +2,7 @@
     Copyright (C) 2009, 2010 William Hart
     Copyright (C) 2009, 2010 Andy Novocin
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,5 +18,8 @@ int
 fmpz_lll_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B,
                       const fmpz_lll_t fl)
 {
+    if (fl->rt == Z_BASIS && fl->st == RECURSIVE)
+        return _fmpz_lll_recursive(B, U, gs_B, fl, 1);
+
     return fmpz_lll_with_removal_ulll(B, U, WORD(250), gs_B, fl);
 }
@@ -2,6 +2,7 @@
     Copyright 2009 William Hart
     Copyright 2010,2011 Fredrik Johansson
     Copyright 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -36,7 +37,7 @@ sample(void *arg, ulong count)
     fmpz_lll_t fl;
 
     flint_rand_t rnd;
-    fmpz_mat_t A, B, C, D;
+    fmpz_mat_t A, B, C, D, E;
     FLINT_TEST_INIT(state);
 
 
@@ -52,6 +53,7 @@ sample(void *arg, ulong count)
     fmpz_mat_init_set(B, A);
     fmpz_mat_init_set(C, A);
     fmpz_mat_init_set(D, A);
+    fmpz_mat_init_set(E, A);
 
     prof_start();
 
@@ -75,6 +77,11 @@ sample(void *arg, ulong count)
         {
             fmpz_lll(D, NULL, fl);
         }
+    else if (algorithm == 4)
+        for (i = 0; i < count; i++)
+        {
+            fmpz_lll_d_householder(E, NULL, fl);
+        }
 
     prof_stop();
 
@@ -82,6 +89,7 @@ sample(void *arg, ulong count)
     fmpz_mat_clear(B);
     fmpz_mat_clear(C);
     fmpz_mat_clear(D);
+    fmpz_mat_clear(E);
     fmpq_clear(delta);
     fmpq_clear(eta);
     flint_randclear(state);
@@ -90,7 +98,8 @@ sample(void *arg, ulong count)
 int
 main(void)
 {
-    double min_classical, min_storjohann, min_wrapper, min_default, max;
+    double min_classical, min_storjohann, min_wrapper, min_default;
+    double min_householder, max;
     mat_lll_t params;
     slong dim;
 
@@ -112,9 +121,13 @@ main(void)
         params.algorithm = 3;
         prof_repeat(&min_default, &max, sample, &params);
 
+        params.algorithm = 4;
+        prof_repeat(&min_householder, &max, sample, &params);
+
         flint_printf
-            ("dim = %wd classical/storjohann/wrapper/default %.2f %.2f %.2f %.2f (us)\n",
-             dim, min_classical, min_storjohann, min_wrapper, min_default);
+            ("dim = %wd classical/storjohann/wrapper/default/householder %.2f %.2f %.2f %.2f %.2f (us)\n",
+             dim, min_classical, min_storjohann, min_wrapper, min_default,
+             min_householder);
     }
 
     return 0;
@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "fmpz_lll.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    slong dim;
+    flint_bitcnt_t bits;
+    int algorithm;
+} mat_lll_t;
+
+
+void
+sample(void *arg, ulong count)
+{
+    mat_lll_t *params = (mat_lll_t *) arg;
+    slong i, dim = params->dim;
+    int algorithm = params->algorithm;
+    fmpz_lll_t fl;
+    fmpz_mat_t A, B;
+    FLINT_TEST_INIT(state);
+
+    fmpz_mat_init(A, dim, dim + 1);
+    fmpz_mat_init(B, dim, dim + 1);
+    fmpz_lll_context_init_default(fl);
+
+    fmpz_mat_randintrel(A, state, params->bits);
+
+    prof_start();
+
+    for (i = 0; i < count; i++)
+    {
+        fmpz_mat_set(B, A);
+
+        if (algorithm == 0)
+            fmpz_lll_wrapper(B, NULL, fl);
+        else if (algorithm == 1)
+            fmpz_lll(B, NULL, fl);
+        else
+            fmpz_lll_recursive(B, NULL, fl);
+    }
+
+    prof_stop();
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(B);
+    flint_randclear(state);
+}
+
+int
+main(void)
+{
+    double min_wrapper, min_default, min_recursive, max;
+    mat_lll_t params;
+    slong dim;
+    flint_bitcnt_t bits;
+
+    flint_printf("fmpz_lll_recursive (integer relations):\n");
+
+    for (dim = 10; dim <= 40; dim *= 2)
+    {
+        for (bits = 500; bits <= 8000; bits *= 2)
+        {
+            params.dim = dim;
+            params.bits = bits;
+
+            params.algorithm = 0;
+            prof_repeat(&min_wrapper, &max, sample, &params);
+
+            params.algorithm = 1;
+            prof_repeat(&min_default, &max, sample, &params);
+
+            params.algorithm = 2;
+            prof_repeat(&min_recursive, &max, sample, &params);
+
+            flint_printf
+                ("dim = %wd bits = %wu wrapper/default/recursive %.2f %.2f %.2f (us)\n",
+                 dim, bits, min_wrapper, min_default, min_recursive);
+        }
+    }
+
+    return 0;
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -40,4 +41,5 @@ fmpz_lll_randtest(fmpz_lll_t fl, flint_rand_t state)
     rt = n_randint(state, 2);
     gt = n_randint(state, 2);
     fmpz_lll_context_init(fl, delta, eta, rt, gt);
+    fl->st = n_randint(state, 2);
 }
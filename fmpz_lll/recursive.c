@@ -0,0 +1,128 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_lll.h"
+
+/*
+   Sets A to the identity adjoined to the nonzero columns of B divided by
+   2^shift. A is initialised by this function.
+*/
+static void
+_fmpz_lll_recursive_truncate(fmpz_mat_t A, const fmpz_mat_t B, slong shift)
+{
+    slong d = B->r, n = B->c, i, j, m;
+    fmpz_mat_t T;
+    int * nonzero;
+
+    fmpz_mat_init(T, d, n);
+    fmpz_mat_scalar_tdiv_q_2exp(T, B, (ulong) shift);
+
+    nonzero = (int *) flint_malloc(n * sizeof(int));
+
+    for (j = 0, m = 0; j < n; j++)
+    {
+        for (i = 0; i < d && fmpz_is_zero(fmpz_mat_entry(T, i, j)); i++) ;
+
+        nonzero[j] = (i < d);
+        m += nonzero[j];
+    }
+
+    fmpz_mat_init(A, d, d + m);
+
+    for (i = 0; i < d; i++)
+    {
+        fmpz_one(fmpz_mat_entry(A, i, i));
+
+        for (j = 0, m = d; j < n; j++)
+        {
+            if (nonzero[j])
+                fmpz_swap(fmpz_mat_entry(A, i, m++), fmpz_mat_entry(T, i, j));
+        }
+    }
+
+    flint_free(nonzero);
+    fmpz_mat_clear(T);
+}
+
+/*
+   Reduces the top half of the bits of B, adjoined to an identity matrix
+   which records the transformation, by a recursive call, and applies the
+   transformation to B and U. This is repeated while the entries of B
+   shrink, after which B is reduced at full precision.
+*/
+int
+_fmpz_lll_recursive(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B,
+                                            const fmpz_lll_t fl, int knapsack)
+{
+    slong d = B->r, mbits, prev_mbits, keep, cutoff;
+    fmpz_lll_t fl2;
+    fmpz_mat_t A, V;
+    int done;
+
+    fl2->delta = fl->delta;
+    fl2->eta = fl->eta;
+    fl2->rt = fl->rt;
+    fl2->gt = fl->gt;
+    fl2->st = ITERATIVE;
+
+    if (U != NULL && U->r != d)
+    {
+        flint_printf
+            ("Exception (fmpz_lll_recursive*). Incompatible dimensions of capturing matrix.\n");
+        flint_abort();
+    }
+
+    if (fl->rt == Z_BASIS)
+    {
+        cutoff = FLINT_MAX(FMPZ_LLL_RECURSIVE_CUTOFF, 4 * d);
+        mbits = FLINT_ABS(fmpz_mat_max_bits(B));
+
+        while (mbits > cutoff)
+        {
+            keep = FLINT_MAX(mbits / 2, cutoff / 2);
+
+            _fmpz_lll_recursive_truncate(A, B, mbits - keep);
+            _fmpz_lll_recursive(A, NULL, NULL, fl2, 1);
+
+            fmpz_mat_window_init(V, A, 0, 0, d, d);
+
+            done = fmpz_mat_is_one(V);
+            if (!done)
+            {
+                fmpz_mat_mul(B, V, B);
+                if (U != NULL)
+                    fmpz_mat_mul(U, V, U);
+            }
+
+            fmpz_mat_window_clear(V);
+            fmpz_mat_clear(A);
+
+            prev_mbits = mbits;
+            mbits = FLINT_ABS(fmpz_mat_max_bits(B));
+
+            if (done || mbits > prev_mbits - keep / 4)
+                break;
+        }
+    }
+
+    if (knapsack)
+        return fmpz_lll_wrapper_with_removal_knapsack(B, U, gs_B, fl2);
+    else if (gs_B != NULL)
+        return fmpz_lll_wrapper_with_removal(B, U, gs_B, fl2);
+    else
+        return fmpz_lll_wrapper(B, U, fl2);
+}
+
+int
+fmpz_lll_recursive(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
+{
+    return _fmpz_lll_recursive(B, U, NULL, fl, 0);
+}
@@ -0,0 +1,154 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_lll.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, res, newd;
+    slong j;
+    fmpz_mat_t mat, mat2, U;
+    fmpz_t bound;
+    fmpz_lll_t fl;
+    flint_bitcnt_t bits;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lll_d_householder....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        slong r, c;
+        int with_removal;
+
+        fmpz_lll_context_init(fl, 0.51 + 0.48 * n_randint(state, 101) / 100.0,
+                         0.51 + 0.48 * n_randint(state, 101) / 100.0,
+                         Z_BASIS, APPROX);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                r = 2 * (n_randint(state, 20) + 1);
+                c = r;
+                fmpz_mat_init(mat, r, c);
+                bits = n_randint(state, 20) + 1;
+                fmpz_mat_randntrulike(mat, state, bits,
+                                                   n_randint(state, 200) + 1);
+                break;
+            case 1:
+                r = n_randint(state, 30) + 1;
+                c = r + 1;
+                fmpz_mat_init(mat, r, c);
+                bits = n_randint(state, 300) + 1;
+                fmpz_mat_randintrel(mat, state, bits);
+                break;
+            case 2:
+                /* linearly dependent rows */
+                r = n_randint(state, 15) + 1;
+                c = n_randint(state, 15) + 1;
+                fmpz_mat_init(mat, r, c);
+                bits = n_randint(state, 30) + 1;
+                fmpz_mat_randrank(mat, state,
+                                   n_randint(state, FLINT_MIN(r, c) + 1), bits);
+                if (r > 0)
+                    fmpz_mat_randops(mat, state, n_randint(state, 2*r*c + 1));
+                break;
+            default:
+                r = n_randint(state, 20) + 1;
+                c = r;
+                fmpz_mat_init(mat, r, c);
+                bits = n_randint(state, 100) + 1;
+                fmpz_mat_randtest(mat, state, bits);
+        }
+
+        fmpz_init_set_ui(bound, 2);
+        fmpz_mul_2exp(bound, bound, bits);
+
+        fmpz_mat_init_set(mat2, mat);
+        fmpz_mat_init(U, r, r);
+        fmpz_mat_one(U);
+
+        with_removal = n_randint(state, 2);
+
+        if (with_removal)
+            res = fmpz_lll_d_householder_with_removal(mat, U, bound, fl);
+        else
+            res = fmpz_lll_d_householder(mat, U, fl);
+
+        newd = res;
+
+        fmpz_mat_mul(mat2, U, mat2);
+
+        if (!fmpz_mat_equal(mat, mat2))
+        {
+            flint_printf("FAIL: basis matrices not equal!\n");
+            fmpz_mat_print_pretty(mat);
+            fmpz_mat_print_pretty(mat2);
+            abort();
+        }
+
+        if (res != -1)
+        {
+            fmpz_mat_t W;
+            slong z;
+
+            /* zero vectors come first, the checks need the others */
+            for (z = 0; z < r && _fmpz_vec_is_zero(mat->rows[z], c); z++) ;
+
+            for (res = 1, j = z; j < r; j++)
+                res = res && !_fmpz_vec_is_zero(mat->rows[j], c);
+
+            fmpz_mat_window_init(W, mat, z, 0, r, c);
+
+            if (with_removal)
+                res = res && fmpz_mat_is_reduced_with_removal(W, fl->delta,
+                                                   fl->eta, bound, newd - z);
+            else
+                res = res && fmpz_mat_is_reduced(W, fl->delta, fl->eta);
+
+            fmpz_mat_window_clear(W);
+
+            if (!res)
+            {
+                flint_printf("FAIL: not reduced!\n");
+                fmpz_mat_print_pretty(mat);
+                flint_printf("bits = %wu, i = %d\n", bits, i);
+                flint_printf("delta = %g, eta = %g\n", fl->delta, fl->eta);
+                abort();
+            }
+        }
+        else if (r <= 20 && bits <= 20)
+        {
+            flint_printf("FAIL: unexpected failure!\n");
+            fmpz_mat_print_pretty(mat2);
+            abort();
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(U);
+        fmpz_clear(bound);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
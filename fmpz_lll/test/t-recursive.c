@@ -0,0 +1,136 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_lll.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, res, newd;
+    fmpz_mat_t mat, mat2, U;
+    fmpz_t bound;
+    fmpz_lll_t fl;
+    flint_bitcnt_t bits;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("recursive....");
+    fflush(stdout);
+
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        slong r, c;
+        int with_removal, which;
+
+        fmpz_lll_context_init(fl, 0.51 + 0.48 * n_randint(state, 101) / 100.0,
+                         0.51 + 0.48 * n_randint(state, 101) / 100.0,
+                         Z_BASIS, APPROX);
+        fl->st = RECURSIVE;
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                r = 2 * (n_randint(state, 10) + 1);
+                c = r;
+                fmpz_mat_init(mat, r, c);
+                bits = n_randint(state, 20) + 1;
+                fmpz_mat_randntrulike(mat, state, bits,
+                                                   n_randint(state, 200) + 1);
+                break;
+            case 1:
+                r = n_randint(state, 12) + 1;
+                c = r;
+                fmpz_mat_init(mat, r, c);
+                bits = n_randint(state, 1500) + 1;
+                fmpz_mat_randsimdioph(mat, state, bits,
+                                              n_randint(state, 2 * bits) + 1);
+                break;
+            default:
+                r = n_randint(state, 20) + 1;
+                c = r + 1;
+                fmpz_mat_init(mat, r, c);
+                bits = n_randint(state, 4000) + 1;
+                fmpz_mat_randintrel(mat, state, bits);
+        }
+
+        fmpz_init_set_ui(bound, 2);
+        fmpz_mul_2exp(bound, bound, n_randint(state, 2 * bits + 1));
+
+        fmpz_mat_init_set(mat2, mat);
+        fmpz_mat_init(U, r, r);
+        fmpz_mat_one(U);
+
+        with_removal = n_randint(state, 2);
+        which = n_randint(state, 3);
+
+        if (with_removal)
+        {
+            if (which == 0)
+                newd = fmpz_lll_recursive_with_removal(mat, U, bound, fl);
+            else if (which == 1)
+                newd = fmpz_lll_wrapper_with_removal_knapsack(mat, U, bound,
+                                                                          fl);
+            else
+                newd = fmpz_lll_with_removal(mat, U, bound, fl);
+        }
+        else
+        {
+            if (which == 0)
+                fmpz_lll_recursive(mat, U, fl);
+            else if (which == 1)
+                fmpz_lll_wrapper(mat, U, fl);
+            else
+                fmpz_lll(mat, U, fl);
+            newd = r;
+        }
+
+        fmpz_mat_mul(mat2, U, mat2);
+
+        if (!fmpz_mat_equal(mat, mat2))
+        {
+            flint_printf("FAIL: basis matrices not equal!\n");
+            fmpz_mat_print_pretty(mat);
+            fmpz_mat_print_pretty(mat2);
+            abort();
+        }
+
+        if (with_removal)
+            res = fmpz_mat_is_reduced_with_removal(mat, fl->delta, fl->eta,
+                                                                bound, newd);
+        else
+            res = fmpz_mat_is_reduced(mat, fl->delta, fl->eta);
+
+        if (!res)
+        {
+            flint_printf("FAIL: not reduced!\n");
+            fmpz_mat_print_pretty(mat);
+            flint_printf("bits = %wu, i = %d, which = %d\n", bits, i, which);
+            flint_printf("delta = %g, eta = %g\n", fl->delta, fl->eta);
+            abort();
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(U);
+        fmpz_clear(bound);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
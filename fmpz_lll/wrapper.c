@@ -2,6 +2,7 @@
     Copyright (C) 2009, 2010 William Hart
     Copyright (C) 2009, 2010 Andy Novocin
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -16,13 +17,22 @@
 int
 fmpz_lll_wrapper(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
 {
-    int res = fmpz_lll_d(B, U, fl);
+    int res;
+
+    if (fl->rt == Z_BASIS && fl->st == RECURSIVE)
+        return _fmpz_lll_recursive(B, U, NULL, fl, 0);
+
+    res = fmpz_lll_d(B, U, fl);
 
     if ((res == -1) || (!fmpz_lll_is_reduced(B, fl, D_BITS)))
     {
         if (fl->rt == Z_BASIS && fl->gt == APPROX)
         {
-            res = fmpz_lll_d_heuristic(B, U, fl);
+            res = fmpz_lll_d_householder(B, U, fl);
+            if ((res == -1) || (!fmpz_lll_is_reduced(B, fl, D_BITS)))
+            {
+                res = fmpz_lll_d_heuristic(B, U, fl);
+            }
             if ((res == -1) || (!fmpz_lll_is_reduced(B, fl, D_BITS)))
             {
                 res = fmpz_lll_mpf(B, U, fl);
@@ -2,6 +2,7 @@
     Copyright (C) 2009, 2010 William Hart
     Copyright (C) 2009, 2010 Andy Novocin
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,14 +18,25 @@ int
 fmpz_lll_wrapper_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B,
                               const fmpz_lll_t fl)
 {
-    int res = fmpz_lll_d_with_removal(B, U, gs_B, fl);
+    int res;
+
+    if (fl->rt == Z_BASIS && fl->st == RECURSIVE)
+        return _fmpz_lll_recursive(B, U, gs_B, fl, 0);
+
+    res = fmpz_lll_d_with_removal(B, U, gs_B, fl);
 
     if ((res == -1)
         || (!fmpz_lll_is_reduced_with_removal(B, fl, gs_B, res, D_BITS)))
     {
         if (fl->rt == Z_BASIS && fl->gt == APPROX)
         {
-            res = fmpz_lll_d_heuristic_with_removal(B, U, gs_B, fl);
+            res = fmpz_lll_d_householder_with_removal(B, U, gs_B, fl);
+            if ((res == -1)
+                ||
+                (!fmpz_lll_is_reduced_with_removal(B, fl, gs_B, res, D_BITS)))
+            {
+                res = fmpz_lll_d_heuristic_with_removal(B, U, gs_B, fl);
+            }
             if ((res == -1)
                 ||
                 (!fmpz_lll_is_reduced_with_removal(B, fl, gs_B, res, D_BITS)))
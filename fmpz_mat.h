@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010 William Hart
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -254,12 +255,21 @@ FLINT_DLL void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmp
 FLINT_DLL void fmpz_mat_mul_classical_inline(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B);
 
+/* bytes of residues held by the multimodular product by default */
+#define FMPZ_MAT_MULTI_MOD_MEMORY (WORD(1) << 30)
+
 FLINT_DLL void _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
                            const fmpz_mat_t B, int sign, flint_bitcnt_t Cbits);
 
 FLINT_DLL void fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
                                                            const fmpz_mat_t B);
 
+FLINT_DLL void _fmpz_mat_mul_multi_mod_mem(fmpz_mat_t C, const fmpz_mat_t A,
+               const fmpz_mat_t B, int sign, flint_bitcnt_t Cbits, slong mem);
+
+FLINT_DLL void fmpz_mat_mul_multi_mod_mem(fmpz_mat_t C, const fmpz_mat_t A,
+                                                const fmpz_mat_t B, slong mem);
+
 FLINT_DLL int _fmpz_mat_mul_blas(fmpz_mat_t C,
                                     const fmpz_mat_t A, flint_bitcnt_t Abits,
                                     const fmpz_mat_t B, flint_bitcnt_t Bbits,
@@ -588,6 +598,9 @@ FLINT_DLL void fmpz_mat_multi_CRT_ui(fmpz_mat_t mat, nmod_mat_t * const residues
 
 /* HNF and SNF **************************************************************/
 
+/* Size from which transforms of square matrices are found by solving */
+#define FMPZ_MAT_HNF_TRANSFORM_SOLVE_CUTOFF 10
+
 FLINT_DLL void fmpz_mat_hnf(fmpz_mat_t H, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_hnf_classical(fmpz_mat_t H, const fmpz_mat_t A);
@@ -604,6 +617,7 @@ FLINT_DLL void fmpz_mat_snf_diagonal(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_kannan_bachem(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A,
         const fmpz_t mod);
+FLINT_DLL void fmpz_mat_snf_modular(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL int fmpz_mat_is_in_snf(const fmpz_mat_t A);
 
 /* Special matrices **********************************************************/
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,6 +18,7 @@
 #include "fmpz_mat.h"
 #include "nmod_mat.h"
 #include "nmod_poly.h"
+#include "thread_support.h"
 
 #define CHARPOLY_M_LOG2E  1.44269504088896340736  /* log2(e) */
 
@@ -88,6 +90,72 @@ void _fmpz_mat_charpoly_small(fmpz * rop, const fmpz_mat_t op)
     }
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * op;
+    mp_srcptr primes;
+    nmod_poly_struct * polys;
+}
+_charpoly_mod_arg_struct;
+
+static void
+_charpoly_mod_worker(slong start, slong stop, void * varg)
+{
+    _charpoly_mod_arg_struct * arg = (_charpoly_mod_arg_struct *) varg;
+    slong i, n = arg->op->r;
+    nmod_mat_t mat;
+
+    for (i = start; i < stop; i++)
+    {
+        nmod_mat_init(mat, n, n, arg->primes[i]);
+        fmpz_mat_get_nmod_mat(mat, arg->op);
+        nmod_mat_charpoly(arg->polys + i, mat);
+        nmod_mat_clear(mat);
+    }
+}
+
+typedef struct
+{
+    fmpz * rop;
+    const nmod_poly_struct * polys;
+    slong num;
+    const fmpz_comb_struct * comb;
+    const fmpz * m;
+    fmpz * batch_prod;
+    const fmpz * prod;
+    fmpz * c;
+}
+_charpoly_crt_arg_struct;
+
+/* combine coefficients with the residues of a batch of primes */
+static void
+_charpoly_crt_worker(slong start, slong stop, void * varg)
+{
+    _charpoly_crt_arg_struct * arg = (_charpoly_crt_arg_struct *) varg;
+    fmpz_comb_temp_t temp;
+    fmpz_t r;
+    mp_ptr res;
+    slong i, k;
+
+    fmpz_comb_temp_init(temp, arg->comb);
+    fmpz_init(r);
+    res = flint_malloc(arg->num*sizeof(mp_limb_t));
+
+    for (i = start; i < stop; i++)
+    {
+        for (k = 0; k < arg->num; k++)
+            res[k] = arg->polys[k].coeffs[i];
+
+        fmpz_multi_CRT_ui(r, res, arg->comb, temp, 0);
+        _fmpz_CRT(arg->rop + i, arg->rop + i, arg->m, r, arg->batch_prod,
+                                                       arg->prod, arg->c, 1);
+    }
+
+    flint_free(res);
+    fmpz_clear(r);
+    fmpz_comb_temp_clear(temp);
+}
+
 void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
 {
     const slong n = op->r;
@@ -112,7 +180,13 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
         slong pbits  = FLINT_BITS - 1;
         mp_limb_t p = (UWORD(1) << pbits);
 
-        fmpz_t m;
+        fmpz_t m, batch_prod, prod, c;
+        _charpoly_mod_arg_struct arg;
+        _charpoly_crt_arg_struct crt_arg;
+        fmpz_comb_t comb;
+        mp_ptr primes;
+        nmod_poly_struct * polys;
+        slong i, num, num_threads;
 
         /* Determine the bound in bits */
         {
@@ -141,28 +215,78 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
         }
 
         fmpz_init_set_ui(m, 1);
+        fmpz_init(batch_prod);
+        fmpz_init(prod);
+        fmpz_init(c);
+
+        num_threads = flint_get_num_threads();
+        primes = flint_malloc(num_threads*sizeof(mp_limb_t));
+        polys = flint_malloc(num_threads*sizeof(nmod_poly_struct));
 
+        arg.op = op;
+        arg.primes = primes;
+        arg.polys = polys;
+
+        crt_arg.rop = rop;
+        crt_arg.polys = polys;
+        crt_arg.m = m;
+        crt_arg.batch_prod = batch_prod;
+        crt_arg.prod = prod;
+        crt_arg.c = c;
+
+        _fmpz_vec_zero(rop, n + 1);
+
+        /* Take the primes in batches of up to one per thread */
         for ( ; fmpz_bits(m) < bound; )
         {
-            nmod_mat_t mat;
-            nmod_poly_t poly;
+            num = (bound - fmpz_bits(m)) / pbits + 1;
+            num = FLINT_MIN(num, num_threads);
 
-            p = n_nextprime(p, 0);
+            fmpz_one(batch_prod);
+            for (i = 0; i < num; i++)
+            {
+                p = n_nextprime(p, 0);
+                primes[i] = p;
+                nmod_poly_init(polys + i, p);
+                fmpz_mul_ui(batch_prod, batch_prod, p);
+            }
+
+            flint_parallel_for(0, num, 1, _charpoly_mod_worker, &arg,
+                                                                 num_threads);
+
+            if (num == 1)
+            {
+                _fmpz_poly_CRT_ui(rop, rop, n + 1, m, polys->coeffs, n + 1,
+                                          polys->mod.n, polys->mod.ninv, 1);
+            }
+            else
+            {
+                fmpz_comb_init(comb, primes, num);
 
-            nmod_mat_init(mat, n, n, p);
-            nmod_poly_init(poly, p);
+                fmpz_mul(prod, m, batch_prod);
+                fmpz_mod(c, m, batch_prod);
+                fmpz_invmod(c, c, batch_prod);
 
-            fmpz_mat_get_nmod_mat(mat, op);
-            nmod_mat_charpoly(poly, mat);
+                crt_arg.num = num;
+                crt_arg.comb = comb;
 
-            _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs, n + 1, poly->mod.n, poly->mod.ninv, 1);
+                flint_parallel_for(0, n + 1, 0, _charpoly_crt_worker,
+                                                       &crt_arg, num_threads);
+
+                fmpz_comb_clear(comb);
+            }
 
-            fmpz_mul_ui(m, m, p);
+            fmpz_mul(m, m, batch_prod);
 
-            nmod_mat_clear(mat);
-            nmod_poly_clear(poly);
+            for (i = 0; i < num; i++)
+                nmod_poly_clear(polys + i);
         }
 
+        flint_free(primes);
+        flint_free(polys);
+        fmpz_clear(batch_prod);
+        fmpz_clear(prod);
+        fmpz_clear(c);
         fmpz_clear(m);
     }
 }
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -10,6 +11,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_support.h"
 
 /* Enable to exercise corner cases */
 #define DEBUG_USE_SMALL_PRIMES 0
@@ -30,14 +32,56 @@ next_good_prime(const fmpz_t d, mp_limb_t p)
 }
 
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz * d;
+    mp_srcptr primes;
+    mp_ptr res;
+}
+_det_mod_arg_struct;
+
+/* res[i] = det(A) / d mod primes[i] */
+static void
+_det_mod_worker(slong start, slong stop, void * varg)
+{
+    _det_mod_arg_struct * arg = (_det_mod_arg_struct *) varg;
+    slong i, n = arg->A->r;
+    mp_limb_t p, xmod;
+    nmod_mat_t Amod;
+
+    for (i = start; i < stop; i++)
+    {
+        p = arg->primes[i];
+
+        nmod_mat_init(Amod, n, n, p);
+        fmpz_mat_get_nmod_mat(Amod, arg->A);
+
+        xmod = _nmod_mat_det(Amod);
+        arg->res[i] = n_mulmod2_preinv(xmod,
+            n_invmod(fmpz_fdiv_ui(arg->d, p), p), Amod->mod.n, Amod->mod.ninv);
+
+        nmod_mat_clear(Amod);
+    }
+}
+
+/*
+    The primes are taken in batches of up to one per thread, never more
+    than the bound still requires. The residues of a batch are combined
+    with a product tree and then with the previous result, so that the
+    early termination test is done once per batch.
+*/
 void
 fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     const fmpz_t d, int proved)
 {
-    fmpz_t bound, prod, stable_prod, x, xnew;
-    mp_limb_t p, xmod;
-    nmod_mat_t Amod;
-    slong n = A->r;
+    fmpz_t bound, prod, stable_prod, x, xnew, r, batch_prod;
+    _det_mod_arg_struct arg;
+    fmpz_comb_t comb;
+    fmpz_comb_temp_t comb_temp;
+    mp_ptr primes, res;
+    mp_limb_t p;
+    slong i, num, num_threads, n = A->r;
 
     if (n == 0)
     {
@@ -56,13 +100,23 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     fmpz_init(stable_prod);
     fmpz_init(x);
     fmpz_init(xnew);
+    fmpz_init(r);
+    fmpz_init(batch_prod);
 
     /* Bound x = det(A) / d */
     fmpz_mat_det_bound(bound, A);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* accomodate sign */
     fmpz_cdiv_q(bound, bound, d);
 
-    nmod_mat_init(Amod, n, n, 2);
+    num_threads = flint_get_num_threads();
+    primes = flint_malloc(num_threads*sizeof(mp_limb_t));
+    res = flint_malloc(num_threads*sizeof(mp_limb_t));
+
+    arg.A = A;
+    arg.d = d;
+    arg.primes = primes;
+    arg.res = res;
+
     fmpz_zero(x);
     fmpz_one(prod);
 
@@ -75,39 +129,64 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     /* Compute x = det(A) / d */
     while (fmpz_cmp(prod, bound) <= 0)
     {
-        p = next_good_prime(d, p);
-        _nmod_mat_set_mod(Amod, p);
-        fmpz_mat_get_nmod_mat(Amod, A);
+        num = (fmpz_bits(bound) - fmpz_bits(prod))
+                                    / NMOD_MAT_OPTIMAL_MODULUS_BITS + 1;
+        num = FLINT_MIN(num, num_threads);
 
-        /* Compute x = det(A) / d mod p */
-        xmod = _nmod_mat_det(Amod);
-        xmod = n_mulmod2_preinv(xmod,
-            n_invmod(fmpz_fdiv_ui(d, p), p), Amod->mod.n, Amod->mod.ninv);
+        for (i = 0; i < num; i++)
+        {
+            p = next_good_prime(d, p);
+            primes[i] = p;
+        }
+
+        /* Compute x = det(A) / d mod p for each prime in the batch */
+        flint_parallel_for(0, num, 1, _det_mod_worker, &arg, num_threads);
+
+        if (num == 1)
+        {
+            fmpz_set_ui(r, res[0]);
+            fmpz_set_ui(batch_prod, primes[0]);
+        }
+        else
+        {
+            fmpz_comb_init(comb, primes, num);
+            fmpz_comb_temp_init(comb_temp, comb);
+            fmpz_multi_CRT_ui(r, res, comb, comb_temp, 0);
+            fmpz_comb_temp_clear(comb_temp);
+            fmpz_comb_clear(comb);
+
+            fmpz_one(batch_prod);
+            for (i = 0; i < num; i++)
+                fmpz_mul_ui(batch_prod, batch_prod, primes[i]);
+        }
 
-        fmpz_CRT_ui(xnew, x, prod, xmod, p, 1);
+        fmpz_CRT(xnew, x, prod, r, batch_prod, 1);
 
         if (fmpz_equal(xnew, x))
         {
-            fmpz_mul_ui(stable_prod, stable_prod, p);
+            fmpz_mul(stable_prod, stable_prod, batch_prod);
             if (!proved && fmpz_bits(stable_prod) > 100)
                 break;
         }
         else
         {
-            fmpz_set_ui(stable_prod, p);
+            fmpz_set(stable_prod, batch_prod);
         }
 
-        fmpz_mul_ui(prod, prod, p);
+        fmpz_mul(prod, prod, batch_prod);
         fmpz_set(x, xnew);
     }
 
     /* det(A) = x * d */
     fmpz_mul(det, x, d);
 
-    nmod_mat_clear(Amod);
+    flint_free(primes);
+    flint_free(res);
     fmpz_clear(bound);
     fmpz_clear(prod);
     fmpz_clear(stable_prod);
     fmpz_clear(x);
     fmpz_clear(xnew);
+    fmpz_clear(r);
+    fmpz_clear(batch_prod);
 }
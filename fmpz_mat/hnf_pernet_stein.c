@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014, 2015 Alex J. Best
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -12,6 +13,7 @@
 #include "fmpz_mat.h"
 #include "fmpq_mat.h"
 #include "perm.h"
+#include "thread_support.h"
 
 static void
 add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t state)
@@ -253,18 +255,88 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
     fmpz_clear(b);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * B;
+    const fmpz_mat_struct * c;
+    const fmpz_mat_struct * d;
+    const fmpz * u1;
+    const fmpz * u2;
+    mp_srcptr primes;
+    mp_ptr res1;
+    mp_ptr res2;
+}
+_double_det_arg_struct;
+
+/* determinant of the n x n matrix with columns the rows of B and then e */
+static mp_limb_t
+_det_mod(nmod_mat_t Btmod, slong * P, const fmpz_mat_t B, const fmpz_mat_t e)
+{
+    slong i, j, n = Btmod->r;
+    mp_limb_t p = Btmod->mod.n, v = UWORD(1);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n - 1; j++)
+            nmod_mat_entry(Btmod, i, j) =
+                fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
+        nmod_mat_entry(Btmod, i, n - 1) =
+            fmpz_fdiv_ui(fmpz_mat_entry(e, 0, i), p);
+    }
+
+    nmod_mat_lu(P, Btmod, 0);
+
+    for (i = 0; i < n; i++)
+        v = n_mulmod2_preinv(v, nmod_mat_entry(Btmod, i, i), p,
+                                                          Btmod->mod.ninv);
+    if (_perm_parity(P, n) == 1)
+        v = nmod_neg(v, Btmod->mod);
+
+    return v;
+}
+
+/* determinants divided by u1 and u2 modulo primes[start], ... */
+static void
+_double_det_worker(slong start, slong stop, void * varg)
+{
+    _double_det_arg_struct * arg = (_double_det_arg_struct *) varg;
+    slong i, n = arg->B->c;
+    slong * P = _perm_init(n);
+    mp_limb_t p, v1mod, v2mod;
+    nmod_mat_t Btmod;
+
+    for (i = start; i < stop; i++)
+    {
+        p = arg->primes[i];
+
+        nmod_mat_init(Btmod, n, n, p);
+
+        v1mod = _det_mod(Btmod, P, arg->B, arg->c);
+        v2mod = _det_mod(Btmod, P, arg->B, arg->d);
+
+        arg->res1[i] = n_mulmod2_preinv(v1mod,
+            n_invmod(fmpz_fdiv_ui(arg->u1, p), p), p, Btmod->mod.ninv);
+        arg->res2[i] = n_mulmod2_preinv(v2mod,
+            n_invmod(fmpz_fdiv_ui(arg->u2, p), p), p, Btmod->mod.ninv);
+
+        nmod_mat_clear(Btmod);
+    }
+
+    _perm_clear(P);
+}
+
 static void
 double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         const fmpz_mat_t d)
 {
-    slong i, j, n;
-    slong *P;
-    mp_limb_t p, u1mod, u2mod, v1mod, v2mod;
+    slong i, j, n, num, num_threads;
+    mp_limb_t p;
+    mp_ptr primes, res1, res2;
     fmpz_t bound, prod, s1, s2, t, u1, u2, v1, v2;
     fmpz_mat_t dt, Bt;
     fmpq_t tmpq;
     fmpq_mat_t x;
-    nmod_mat_t Btmod;
+    _double_det_arg_struct arg;
 
     n = B->c;
 
@@ -348,59 +420,54 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         fmpz_mul_ui(bound, bound, UWORD(2));
 
         fmpz_one(prod);
-        P = _perm_init(n);
-        nmod_mat_init(Btmod, n, n, 2);
         p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
-        /* compute determinants divided by u1 and u2 */
+
+        num_threads = flint_get_num_threads();
+        primes = flint_malloc(num_threads*sizeof(mp_limb_t));
+        res1 = flint_malloc(num_threads*sizeof(mp_limb_t));
+        res2 = flint_malloc(num_threads*sizeof(mp_limb_t));
+
+        arg.B = B;
+        arg.c = c;
+        arg.d = d;
+        arg.u1 = u1;
+        arg.u2 = u2;
+        arg.primes = primes;
+        arg.res1 = res1;
+        arg.res2 = res2;
+
+        /* compute determinants divided by u1 and u2, a batch of primes
+           at a time */
         while (fmpz_cmp(prod, bound) <= 0)
         {
-            p = n_nextprime(p, 0);
-            u1mod = fmpz_fdiv_ui(u1, p);
-            u2mod = fmpz_fdiv_ui(u2, p);
-            if (!(u1mod || u2mod))
-                continue;
-            _nmod_mat_set_mod(Btmod, p);
-            for (i = 0; i < n; i++)
+            num = (fmpz_bits(bound) - fmpz_bits(prod))
+                                    / NMOD_MAT_OPTIMAL_MODULUS_BITS + 1;
+            num = FLINT_MIN(num, num_threads);
+
+            for (i = 0; i < num; i++)
             {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(c, 0, i), p);
+                do {
+                    p = n_nextprime(p, 0);
+                } while (fmpz_fdiv_ui(u1, p) == 0 || fmpz_fdiv_ui(u2, p) == 0);
+
+                primes[i] = p;
             }
-            nmod_mat_lu(P, Btmod, 0);
-            v1mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v1mod = n_mulmod2_preinv(v1mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v1mod = nmod_neg(v1mod, Btmod->mod);
 
-            for (i = 0; i < n; i++)
+            flint_parallel_for(0, num, 1, _double_det_worker, &arg,
+                                                                 num_threads);
+
+            for (i = 0; i < num; i++)
             {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(d, 0, i), p);
+                fmpz_CRT_ui(v1, v1, prod, res1[i], primes[i], 1);
+                fmpz_CRT_ui(v2, v2, prod, res2[i], primes[i], 1);
+                fmpz_mul_ui(prod, prod, primes[i]);
             }
-            nmod_mat_lu(P, Btmod, 0);
-            v2mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v2mod = n_mulmod2_preinv(v2mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v2mod = nmod_neg(v2mod, Btmod->mod);
-
-            v1mod = n_mulmod2_preinv(v1mod, n_invmod(u1mod, p), p,
-                    Btmod->mod.ninv);
-            v2mod = n_mulmod2_preinv(v2mod, n_invmod(u2mod, p), p,
-                    Btmod->mod.ninv);
-            fmpz_CRT_ui(v1, v1, prod, v1mod, p, 1);
-            fmpz_CRT_ui(v2, v2, prod, v2mod, p, 1);
-            fmpz_mul_ui(prod, prod, p);
         }
 
+        flint_free(primes);
+        flint_free(res1);
+        flint_free(res2);
+
         fmpz_mul(d1, u1, v1);
         fmpz_mul(d2, u2, v2);
 
@@ -413,8 +480,6 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         fmpz_clear(v1);
         fmpz_clear(v2);
         fmpz_clear(t);
-        _perm_clear(P);
-        nmod_mat_clear(Btmod);
     }
     else                        /* can't use the clever method above so naively compute both dets */
     {
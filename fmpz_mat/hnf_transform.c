@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2014 Alex J. Best
     Copyright (C) 2017 Tommy Hofmann
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -11,6 +12,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_support.h"
 
 void
 _fmpz_mat_hnf_transform_naive(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
@@ -47,6 +49,146 @@ _fmpz_mat_hnf_transform_naive(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
     fmpz_mat_clear(H2);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz_mat_struct * H;
+    nmod_mat_struct * U;
+    int * ok;
+}
+_transform_mod_arg_struct;
+
+/* U[i] = H A^{-1} modulo the modulus of U[i] */
+static void
+_transform_mod_worker(slong start, slong stop, void * varg)
+{
+    _transform_mod_arg_struct * arg = (_transform_mod_arg_struct *) varg;
+    slong i, n = arg->A->r;
+    nmod_mat_t Amod, Ainv, Hmod;
+
+    for (i = start; i < stop; i++)
+    {
+        mp_limb_t p = arg->U[i].mod.n;
+
+        nmod_mat_init(Amod, n, n, p);
+        nmod_mat_init(Ainv, n, n, p);
+        nmod_mat_init(Hmod, n, n, p);
+
+        fmpz_mat_get_nmod_mat(Amod, arg->A);
+        fmpz_mat_get_nmod_mat(Hmod, arg->H);
+
+        arg->ok[i] = nmod_mat_inv(Ainv, Amod);
+        if (arg->ok[i])
+            nmod_mat_mul(arg->U + i, Hmod, Ainv);
+
+        nmod_mat_clear(Amod);
+        nmod_mat_clear(Ainv);
+        nmod_mat_clear(Hmod);
+    }
+}
+
+/*
+    For nonsingular square A the transformation U = H A^{-1} is unique and
+    integral, and |det(A)| is the product of the diagonal of H. With the
+    Hadamard bound for the cofactors of A this bounds the entries of U, and
+    U is found by Chinese remaindering, a batch of primes at a time in
+    parallel, stopping early once U A = H.
+*/
+static void
+_fmpz_mat_hnf_transform_multi_mod(fmpz_mat_t H, fmpz_mat_t U,
+                                                          const fmpz_mat_t A)
+{
+    slong i, n = fmpz_mat_nrows(A), num, num_threads;
+    fmpz_t bound, prod, det;
+    fmpz_mat_t H2, UA, Uold;
+    _transform_mod_arg_struct arg;
+    nmod_mat_struct * Umod;
+    int * ok;
+    mp_limb_t p;
+
+    fmpz_init(bound);
+    fmpz_init(prod);
+    fmpz_init(det);
+    fmpz_mat_init(H2, n, n);
+    fmpz_mat_init(UA, n, n);
+    fmpz_mat_init(Uold, n, n);
+
+    fmpz_mat_hnf(H2, A);
+
+    /* |U_ij| <= n max |H| detbound(A) / |det(A)| */
+    fmpz_one(det);
+    for (i = 0; i < n; i++)
+        fmpz_mul(det, det, fmpz_mat_entry(H2, i, i));
+
+    fmpz_mat_det_bound(bound, A);
+    fmpz_mul_ui(bound, bound, n);
+    i = fmpz_mat_max_bits(H2);
+    fmpz_mul_2exp(bound, bound, FLINT_ABS(i) + 1);  /* accomodate sign */
+    fmpz_cdiv_q(bound, bound, det);
+
+    num_threads = flint_get_num_threads();
+    Umod = flint_malloc(num_threads*sizeof(nmod_mat_struct));
+    ok = flint_malloc(num_threads*sizeof(int));
+
+    arg.A = A;
+    arg.H = H2;
+    arg.U = Umod;
+    arg.ok = ok;
+
+    fmpz_mat_zero(U);
+    fmpz_one(prod);
+    p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
+
+    while (fmpz_cmp(prod, bound) <= 0)
+    {
+        num = (fmpz_bits(bound) - fmpz_bits(prod))
+                                    / NMOD_MAT_OPTIMAL_MODULUS_BITS + 1;
+        num = FLINT_MIN(num, num_threads);
+
+        for (i = 0; i < num; i++)
+        {
+            p = n_nextprime(p, 0);
+            nmod_mat_init(Umod + i, n, n, p);
+        }
+
+        flint_parallel_for(0, num, 1, _transform_mod_worker, &arg,
+                                                                 num_threads);
+
+        for (i = 0; i < num; i++)
+        {
+            /* primes dividing det(A) are skipped */
+            if (ok[i])
+            {
+                fmpz_mat_CRT_ui(U, U, prod, Umod + i, 1);
+                fmpz_mul_ui(prod, prod, Umod[i].mod.n);
+            }
+
+            nmod_mat_clear(Umod + i);
+        }
+
+        /* the image stopped changing, so U is probably correct */
+        if (fmpz_mat_equal(U, Uold) && fmpz_cmp(prod, bound) <= 0)
+        {
+            fmpz_mat_mul(UA, U, A);
+            if (fmpz_mat_equal(UA, H2))
+                break;
+        }
+
+        fmpz_mat_set(Uold, U);
+    }
+
+    fmpz_mat_set(H, H2);
+
+    flint_free(Umod);
+    flint_free(ok);
+    fmpz_clear(bound);
+    fmpz_clear(prod);
+    fmpz_clear(det);
+    fmpz_mat_clear(H2);
+    fmpz_mat_clear(UA);
+    fmpz_mat_clear(Uold);
+}
+
 void
 fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
 {
@@ -72,7 +214,9 @@ fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A)
 
         flint_randclear(state);
 
-        if (r == n) /* Full column rank */
+        if (r == n && m == n && n >= FMPZ_MAT_HNF_TRANSFORM_SOLVE_CUTOFF)
+            _fmpz_mat_hnf_transform_multi_mod(H, U, A);
+        else if (r == n) /* Full column rank */
             fmpz_mat_hnf_minors_transform(H, U, A);
         else
             _fmpz_mat_hnf_transform_naive(H, U, A);
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2013 Sebastian Pancratz
     Copyright (C) 2015 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -18,6 +19,7 @@
 #include "fmpz_mat.h"
 #include "nmod_mat.h"
 #include "nmod_poly.h"
+#include "thread_support.h"
 
 #define MINPOLY_M_LOG2E  1.44269504088896340736  /* log2(e) */
 
@@ -108,6 +110,36 @@ void _fmpz_mat_bound_ovals_of_cassini(fmpz_t b, const fmpz_mat_t op)
    fmpz_clear(q);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * op;
+    mp_srcptr primes;
+    nmod_poly_struct * polys;
+    ulong * P;
+}
+_minpoly_mod_arg_struct;
+
+static void
+_minpoly_mod_worker(slong start, slong stop, void * varg)
+{
+    _minpoly_mod_arg_struct * arg = (_minpoly_mod_arg_struct *) varg;
+    slong i, j, n = arg->op->r;
+    nmod_mat_t mat;
+
+    for (i = start; i < stop; i++)
+    {
+        ulong * P = arg->P + i*n;
+
+        for (j = 0; j < n; j++)
+            P[j] = 0;
+
+        nmod_mat_init(mat, n, n, arg->primes[i]);
+        fmpz_mat_get_nmod_mat(mat, arg->op);
+        nmod_mat_minpoly_with_gens(arg->polys + i, mat, P);
+        nmod_mat_clear(mat);
+    }
+}
+
 slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
 {
     const slong n = op->r;
@@ -132,9 +164,13 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
         slong bound;
         double b1, b2, b3, bb;
 
-        slong pbits  = FLINT_BITS - 1, i, j;
+        slong pbits  = FLINT_BITS - 1, i, j, k, num, num_threads;
         mp_limb_t p = (UWORD(1) << pbits);
         ulong * P, * Q;
+        mp_ptr primes;
+        nmod_poly_struct * polys;
+        _minpoly_mod_arg_struct arg;
+        int done;
 
         fmpz_mat_t v1, v2, v3;
         fmpz * rold;
@@ -170,124 +206,138 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
             fmpz_clear(b);
         }
 
-        P = (ulong *) flint_calloc(n, sizeof(ulong));
+        num_threads = flint_get_num_threads();
+        primes = (mp_ptr) flint_malloc(num_threads*sizeof(mp_limb_t));
+        polys = (nmod_poly_struct *)
+                        flint_malloc(num_threads*sizeof(nmod_poly_struct));
+        P = (ulong *) flint_malloc(num_threads*n*sizeof(ulong));
         Q = (ulong *) flint_calloc(n, sizeof(ulong));
         rold = (fmpz *) _fmpz_vec_init(n + 1);
         fmpz_mat_init(v1, n, 1);
         fmpz_mat_init(v2, n, 1);
         fmpz_mat_init(v3, n, 1);
 
+        arg.op = op;
+        arg.primes = primes;
+        arg.polys = polys;
+        arg.P = P;
+
         fmpz_init_set_ui(m, 1);
 
         oldlen = 0;
         len = 0;
+        done = 0;
 
-        for ( ; fmpz_bits(m) <= bound; )
+        /*
+            The minimal polynomials are computed for batches of up to one
+            prime per thread, then the primes of a batch are processed in
+            order exactly as if they had been taken one at a time.
+        */
+        while (!done && fmpz_bits(m) <= bound)
         {
-            nmod_mat_t mat;
-            nmod_poly_t poly;
-            
-            p = n_nextprime(p, 0);
-
-            nmod_mat_init(mat, n, n, p);
-            nmod_poly_init(poly, p);
+            num = (bound - fmpz_bits(m)) / pbits + 1;
+            num = FLINT_MIN(num, num_threads);
 
-            for (i = 0; i < n; i++)
-               P[i] = 0;
-
-            fmpz_mat_get_nmod_mat(mat, op);
-            nmod_mat_minpoly_with_gens(poly, mat, P);
-
-            len = poly->length;
-
-            if (oldlen != 0 && len > oldlen)
-            {
-               /* all previous primes were bad, discard */
-                           
-               fmpz_one(m);
-               oldlen = len;
-
-               for (i = 0; i < n + 1; i++)
-                  fmpz_zero(rop + i);
-
-               for (i = 0; i < n; i++)
-                  Q[i] = 0;
-            } else if (len < oldlen)
+            for (k = 0; k < num; k++)
             {
-               /* this prime was bad, skip */
-
-               nmod_mat_clear(mat);
-               nmod_poly_clear(poly);
-            
-               continue;   
+                p = n_nextprime(p, 0);
+                primes[k] = p;
+                nmod_poly_init(polys + k, p);
             }
 
-            for (i = 0; i < n; i++)
-               Q[i] |= P[i];
+            flint_parallel_for(0, num, 1, _minpoly_mod_worker, &arg,
+                                                                 num_threads);
 
-            _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs, 
-                              poly->length, poly->mod.n, poly->mod.ninv, 1);
-
-            fmpz_mul_ui(m, m, p);
-
-            /* check if stabilised */
-            for (i = 0; i < len; i++)
+            for (k = 0; k < num && !done && fmpz_bits(m) <= bound; k++)
             {
-               if (!fmpz_equal(rop + i, rold + i))
-                  break;
-            }
-
-            for (j = 0; j < len; j++)
-               fmpz_set(rold + j, rop + j);
-
-            if (i == len) /* stabilised */
-            {
-               for (i = 0; i < n; i++)
-               {
-                  if (Q[i] == 1)
-                  {
-                     fmpz_mat_zero(v1);
-                     fmpz_mat_zero(v3);
-
-                     fmpz_set_ui(fmpz_mat_entry(v1, i, 0), 1);
-
-                     for (j = 0; j < len; j++)
-                     {
-                        fmpz_mat_scalar_mul_fmpz(v2, v1, rop + j);
-                        fmpz_mat_add(v3, v3, v2);
-
-                        if (j != len - 1)
-                        {
-                           fmpz_mat_mul(v2, op, v1);
-                           fmpz_mat_swap(v1, v2);
-                        }
-                     }
-                  
-                     /* check f(A)v = 0 */
-                     for (j = 0; j < n; j++)
-                     {
-                        if (!fmpz_is_zero(v3->rows[j] + 0))
+                nmod_poly_struct * poly = polys + k;
+                ulong * Pk = P + k*n;
+
+                len = poly->length;
+
+                if (oldlen != 0 && len > oldlen)
+                {
+                   /* all previous primes were bad, discard */
+
+                   fmpz_one(m);
+                   oldlen = len;
+
+                   for (i = 0; i < n + 1; i++)
+                      fmpz_zero(rop + i);
+
+                   for (i = 0; i < n; i++)
+                      Q[i] = 0;
+                } else if (len < oldlen)
+                {
+                   /* this prime was bad, skip */
+                   continue;
+                }
+
+                for (i = 0; i < n; i++)
+                   Q[i] |= Pk[i];
+
+                _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs,
+                                  poly->length, poly->mod.n, poly->mod.ninv, 1);
+
+                fmpz_mul_ui(m, m, primes[k]);
+
+                /* check if stabilised */
+                for (i = 0; i < len; i++)
+                {
+                   if (!fmpz_equal(rop + i, rold + i))
+                      break;
+                }
+
+                for (j = 0; j < len; j++)
+                   fmpz_set(rold + j, rop + j);
+
+                if (i == len) /* stabilised */
+                {
+                   for (i = 0; i < n; i++)
+                   {
+                      if (Q[i] == 1)
+                      {
+                         fmpz_mat_zero(v1);
+                         fmpz_mat_zero(v3);
+
+                         fmpz_set_ui(fmpz_mat_entry(v1, i, 0), 1);
+
+                         for (j = 0; j < len; j++)
+                         {
+                            fmpz_mat_scalar_mul_fmpz(v2, v1, rop + j);
+                            fmpz_mat_add(v3, v3, v2);
+
+                            if (j != len - 1)
+                            {
+                               fmpz_mat_mul(v2, op, v1);
+                               fmpz_mat_swap(v1, v2);
+                            }
+                         }
+
+                         /* check f(A)v = 0 */
+                         for (j = 0; j < n; j++)
+                         {
+                            if (!fmpz_is_zero(v3->rows[j] + 0))
+                                break;
+                         }
+
+                         if (j != n)
                             break;
-                     }
-
-                     if (j != n)
-                        break;
-                  }
-               }
-
-               /* if f(A)v = 0 for all generators v, we are done */
-               if (i == n)
-               {
-                  nmod_mat_clear(mat);
-                  nmod_poly_clear(poly);
-                  break;
-               }
+                      }
+                   }
+
+                   /* if f(A)v = 0 for all generators v, we are done */
+                   if (i == n)
+                      done = 1;
+                }
             }
 
-            nmod_mat_clear(mat);
-            nmod_poly_clear(poly);
+            for (k = 0; k < num; k++)
+                nmod_poly_clear(polys + k);
         }
 
+        flint_free(primes);
+        flint_free(polys);
         flint_free(P);
         flint_free(Q);
         fmpz_mat_clear(v2);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2021 Daniel Schultz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -19,9 +20,51 @@
 #include "n_poly.h"
 #include "mpn_extras.h"
 
-#if FLINT_USES_BLAS && FLINT_BITS == 64
+#if FLINT_BITS == 64
 
+#if FLINT_USES_BLAS
 #include "cblas.h"
+#else
+#include "d_mat.h"
+#endif
+
+/*
+    dC = dA*dB for row major m x k and k x n matrices, on the given threads
+    if BLAS is not available, or on threads requested here if there are none
+*/
+static void _dgemm(double * dC, double * dA, double * dB,
+                   slong m, slong k, slong n,
+                   thread_pool_handle * threads, slong num_threads)
+{
+#if FLINT_USES_BLAS
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                                       m, n, k, 1.0, dA, k, dB, n, 0.0, dC, n);
+#else
+    slong i;
+    double ** rows = FLINT_ARRAY_ALLOC(2*m + k, double *);
+    int own = (threads == NULL);
+
+    for (i = 0; i < m; i++)
+    {
+        rows[i] = dC + i*n;
+        rows[m + i] = dA + i*k;
+    }
+
+    for (i = 0; i < k; i++)
+        rows[2*m + i] = dB + i*n;
+
+    if (own)
+        num_threads = flint_request_threads(&threads, flint_get_num_threads());
+
+    _d_mat_mul_blocked_threaded_pool_op(rows, rows + m, rows + 2*m, m, k, n,
+                                                     0, threads, num_threads);
+
+    if (own)
+        flint_give_back_threads(threads, num_threads);
+
+    flint_free(rows);
+#endif
+}
 
 
 typedef struct {
@@ -135,8 +178,7 @@ red_single:
         flint_free(args);
     }
 
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
-                                       m, n, k, 1.0, dA, k, dB, n, 0.0, dC, n);
+    _dgemm(dC, dA, dB, m, k, n, NULL, 0);
 
     for (i = 0; i < m; i++)
         for (j = 0; j < n; j++)
@@ -552,8 +594,7 @@ int _fmpz_mat_mul_blas(
         for (i = 0; i < num_workers; i++)
             thread_pool_wait(global_thread_pool, handles[i]);
 
-        cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
-                                       m, n, k, 1.0, dA, k, dB, n, 0.0, dC, n);
+        _dgemm(dC, dA, dB, m, k, n, handles, num_workers);
 
         for (i = 0; i < num_workers; i++)
             thread_pool_wake(global_thread_pool, handles[i], 0, _fromd_worker, &args[i]);
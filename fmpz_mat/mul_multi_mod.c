@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010, 2018 Fredrik Johansson
     Copyright (C) 2021 Daniel Schultz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -13,6 +14,11 @@
 #include "fmpz_mat.h"
 
 
+/* TUNING */
+#define MULTI_MOD_COMB_CUTOFF 200
+#define MULTI_MOD_GROUP 4
+#define MULTI_MOD_GROUP_MEMORY (WORD(1) << 20)
+
 typedef struct {
     slong m;
     slong k;
@@ -29,6 +35,8 @@ typedef struct {
     nmod_mat_t * mod_A;
     nmod_mat_t * mod_B;
     nmod_mat_t * mod_C;
+    const slong * num_rows;
+    slong group;
     const fmpz_comb_struct * comb;
     slong num_primes;
     mp_ptr primes;
@@ -52,52 +60,92 @@ static void _mod_worker(void * varg)
     nmod_mat_t * mod_B = arg->mod_B;
     slong num_primes = arg->num_primes;
     const fmpz_comb_struct * comb = arg->comb;
+    mp_limb_t * residues;
+    fmpz_comb_temp_t comb_temp;
 
-    if (comb != NULL)
+    residues = FLINT_ARRAY_ALLOC(num_primes, mp_limb_t);
+    fmpz_comb_temp_init(comb_temp, comb);
+
+    for (i = Astartrow; i < Astoprow; i++)
+    for (j = 0; j < k; j++)
     {
-        mp_limb_t * residues;
-        fmpz_comb_temp_t comb_temp;
+        fmpz_multi_mod_ui(residues, &Arows[i][j], comb, comb_temp);
+        for (l = 0; l < num_primes; l++)
+            mod_A[l]->rows[i][j] = residues[l];
+    }
 
-        residues = FLINT_ARRAY_ALLOC(num_primes, mp_limb_t);
-        fmpz_comb_temp_init(comb_temp, comb);
+    for (i = Bstartrow; i < Bstoprow; i++)
+    for (j = 0; j < n; j++)
+    {
+        fmpz_multi_mod_ui(residues, &Brows[i][j], comb, comb_temp);
+        for (l = 0; l < num_primes; l++)
+            mod_B[l]->rows[i][j] = residues[l];
+    }
 
-        for (i = Astartrow; i < Astoprow; i++)
-        for (j = 0; j < k; j++)
-        {
-            fmpz_multi_mod_ui(residues, &Arows[i][j], comb, comb_temp);
-            for (l = 0; l < num_primes; l++)
-                mod_A[l]->rows[i][j] = residues[l];
-        }
+    flint_free(residues);
+    fmpz_comb_temp_clear(comb_temp);
+}
 
-        for (i = Bstartrow; i < Bstoprow; i++)
-        for (j = 0; j < n; j++)
+/*
+   Reduce A and B modulo the primes in [start, stop) and multiply the
+   residues straight away, so that the residues of A and B only exist for
+   the primes being worked on. The primes are taken in groups, so that each
+   entry is read once per group rather than once per prime. Only the first
+   num_rows[l] rows of A are needed for the prime l.
+*/
+static void _prime_worker(slong start, slong stop, void * varg)
+{
+    _worker_arg * arg = (_worker_arg *) varg;
+    slong i, j, l, g, len;
+    slong k = arg->k;
+    slong n = arg->n;
+    fmpz ** Arows = arg->Arows;
+    fmpz ** Brows = arg->Brows;
+    nmod_mat_t * mod_C = arg->mod_C;
+    nmod_mat_t * mod_A, * mod_B;
+
+    mod_A = FLINT_ARRAY_ALLOC(arg->group, nmod_mat_t);
+    mod_B = FLINT_ARRAY_ALLOC(arg->group, nmod_mat_t);
+
+    for ( ; start < stop; start += len)
+    {
+        len = FLINT_MIN(arg->group, stop - start);
+
+        for (g = 0; g < len; g++)
         {
-            fmpz_multi_mod_ui(residues, &Brows[i][j], comb, comb_temp);
-            for (l = 0; l < num_primes; l++)
-                mod_B[l]->rows[i][j] = residues[l];
+            nmod_mat_init(mod_A[g], arg->num_rows[start + g], k,
+                                                  mod_C[start + g]->mod.n);
+            nmod_mat_init(mod_B[g], k, n, mod_C[start + g]->mod.n);
         }
 
-        flint_free(residues);
-        fmpz_comb_temp_clear(comb_temp);
-    }
-    else
-    {
-        for (i = Astartrow; i < Astoprow; i++)
+        /* the rows needing the most primes come first */
+        for (i = 0; i < arg->num_rows[start]; i++)
         for (j = 0; j < k; j++)
         {
-            for (l = 0; l < num_primes; l++)
-                nmod_mat_entry(mod_A[l], i, j) = fmpz_get_nmod(&Arows[i][j],
-                                                                mod_A[l]->mod);
+            for (g = 0; g < len && i < mod_A[g]->r; g++)
+                nmod_mat_entry(mod_A[g], i, j) = fmpz_get_nmod(&Arows[i][j],
+                                                             mod_A[g]->mod);
         }
 
-        for (i = Bstartrow; i < Bstoprow; i++)
+        for (i = 0; i < k; i++)
         for (j = 0; j < n; j++)
         {
-            for (l = 0; l < num_primes; l++)
-                nmod_mat_entry(mod_B[l], i, j) = fmpz_get_nmod(&Brows[i][j],
-                                                                mod_A[l]->mod);
+            for (g = 0; g < len; g++)
+                nmod_mat_entry(mod_B[g], i, j) = fmpz_get_nmod(&Brows[i][j],
+                                                             mod_B[g]->mod);
+        }
+
+        for (g = 0; g < len; g++)
+        {
+            l = start + g;
+            nmod_mat_mul(mod_C[l], mod_A[g], mod_B[g]);
+            nmod_mat_clear(mod_A[g]);
+            nmod_mat_clear(mod_B[g]);
         }
     }
+
+    flint_free(mod_A);
+    flint_free(mod_B);
 }
 
 static void _crt_worker(void * varg)
@@ -281,23 +329,59 @@ static void _crt_worker(void * varg)
 }
 
 
-void _fmpz_mat_mul_multi_mod(
+/*
+   The rows of C are ordered by decreasing number of primes, the rows
+   [num_rows[l], num_rows[l - 1]) needing exactly l primes.
+*/
+static void _crt_rows_worker(slong start, slong stop, void * varg)
+{
+    _worker_arg arg = *((_worker_arg *) varg);
+    slong i, l, lo, hi;
+    slong num_primes = arg.num_primes;
+
+    for (l = num_primes; l >= 0; l--)
+    {
+        lo = (l == num_primes) ? 0 : arg.num_rows[l];
+        hi = (l == 0) ? arg.m : arg.num_rows[l - 1];
+        lo = FLINT_MAX(lo, start);
+        hi = FLINT_MIN(hi, stop);
+
+        if (lo >= hi)
+            continue;
+
+        if (l == 0)
+        {
+            for (i = lo; i < hi; i++)
+                _fmpz_vec_zero(arg.Crows[i], arg.n);
+        }
+        else
+        {
+            arg.num_primes = l;
+            arg.Cstartrow = lo;
+            arg.Cstoprow = hi;
+            _crt_worker(&arg);
+        }
+    }
+}
+
+/* with many primes, all residues are computed at once using a comb */
+static void _fmpz_mat_mul_multi_mod_primes_comb(
     fmpz_mat_t C,
     const fmpz_mat_t A,
     const fmpz_mat_t B,
+    mp_ptr primes,
+    slong num_primes,
     int sign,
     flint_bitcnt_t bits)
 {
     slong i, start, stop;
     slong m, k, n;
-    flint_bitcnt_t primes_bits;
     _worker_arg mainarg;
     _worker_arg * args;
     fmpz_comb_t comb;
     slong num_workers;
     thread_pool_handle * handles;
     slong limit;
-    ulong first_prime; /* not prime */
 
     mainarg.m = m = A->r;
     mainarg.k = k = A->c;
@@ -305,41 +389,9 @@ void _fmpz_mat_mul_multi_mod(
     mainarg.Arows = A->rows;
     mainarg.Brows = B->rows;
     mainarg.Crows = C->rows;
-
-    if (m < 1 || n < 1 || k < 1)
-    {
-        fmpz_mat_zero(C);
-        return;
-    }
-
-    FLINT_ASSERT(sign == 0 || sign == 1);
-    bits += sign;
-
-    /* TUNING */
-    primes_bits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
-
-    if (bits < primes_bits || bits <= FLINT_BITS - 1)
-    {
-        mainarg.num_primes = 1;
-        first_prime = UWORD(1) << bits;
-    }
-    else
-    {
-        /* Round up in the division */
-        mainarg.num_primes = 1 + (bits - (FLINT_BITS - 1) + primes_bits - 1)/primes_bits;
-        first_prime = UWORD(1) << (FLINT_BITS - 1);
-    }
-
-    /* Initialize */
     mainarg.sign = sign;
-    mainarg.primes = FLINT_ARRAY_ALLOC(mainarg.num_primes, mp_limb_t);
-    mainarg.primes[0] = first_prime;
-    if (mainarg.num_primes > 1)
-    {
-        mainarg.primes[1] = n_nextprime(UWORD(1) << primes_bits, 0);
-        for (i = 2; i < mainarg.num_primes; i++)
-            mainarg.primes[i] = n_nextprime(mainarg.primes[i-1], 0);
-    }
+    mainarg.primes = primes;
+    mainarg.num_primes = num_primes;
 
     mainarg.mod_A = FLINT_ARRAY_ALLOC(mainarg.num_primes, nmod_mat_t);
     mainarg.mod_B = FLINT_ARRAY_ALLOC(mainarg.num_primes, nmod_mat_t);
@@ -351,18 +403,8 @@ void _fmpz_mat_mul_multi_mod(
         nmod_mat_init(mainarg.mod_C[i], C->r, C->c, mainarg.primes[i]);
     }
 
-    /* TUNING */
-    if (mainarg.num_primes > 200)
-    {
-        /* use comb */
-        fmpz_comb_init(comb, mainarg.primes, mainarg.num_primes);
-        mainarg.comb = comb;
-    }
-    else
-    {
-        /* don't use comb */
-        mainarg.comb = NULL;
-    }
+    fmpz_comb_init(comb, mainarg.primes, mainarg.num_primes);
+    mainarg.comb = comb;
 
     /* limit on the number of threads */
     limit = ((m + k + n)/128)*(1 + bits/1024);
@@ -460,8 +502,7 @@ crt_single:
     }
 
     /* Cleanup */
-    if (mainarg.comb != NULL)
-        fmpz_comb_clear(comb);
+    fmpz_comb_clear(comb);
 
     for (i = 0; i < mainarg.num_primes; i++)
     {
@@ -473,11 +514,362 @@ crt_single:
     flint_free(mainarg.mod_A);
     flint_free(mainarg.mod_B);
     flint_free(mainarg.mod_C);
-    flint_free(mainarg.primes);
+}
+
+/*
+   Set C to A*B reduced modulo the product M of the given primes, into
+   [0, M) if sign is 0 and into (-M/2, M/2] otherwise. If row_primes is
+   not NULL, row i of C is only reduced modulo the product of the first
+   row_primes[i] primes.
+
+   Without a comb, the work is split over the primes: for each prime, a
+   thread reduces A and B and multiplies the residues, keeping only the
+   residues of C. Splitting the product itself into tiles of rows would
+   lose the benefit of Strassen multiplication in nmod_mat_mul.
+*/
+static void _fmpz_mat_mul_multi_mod_primes(
+    fmpz_mat_t C,
+    const fmpz_mat_t A,
+    const fmpz_mat_t B,
+    mp_ptr primes,
+    slong num_primes,
+    const slong * row_primes,
+    int sign,
+    flint_bitcnt_t bits)
+{
+    slong i, l, m, k, n, limit, grain;
+    slong * num_rows, * next;
+    _worker_arg arg;
+
+    if (num_primes > MULTI_MOD_COMB_CUTOFF)
+    {
+        _fmpz_mat_mul_multi_mod_primes_comb(C, A, B, primes, num_primes,
+                                                                  sign, bits);
+        return;
+    }
+
+    arg.m = m = A->r;
+    arg.k = k = A->c;
+    arg.n = n = B->c;
+    arg.Brows = B->rows;
+    arg.comb = NULL;
+    arg.sign = sign;
+    arg.primes = primes;
+    arg.num_primes = num_primes;
+
+    num_rows = FLINT_ARRAY_ALLOC(num_primes + 1, slong);
+
+    if (row_primes == NULL)
+    {
+        arg.Arows = A->rows;
+        arg.Crows = C->rows;
+
+        for (l = 0; l < num_primes; l++)
+            num_rows[l] = m;
+        num_rows[num_primes] = 0;
+    }
+    else
+    {
+        arg.Arows = FLINT_ARRAY_ALLOC(m, fmpz *);
+        arg.Crows = FLINT_ARRAY_ALLOC(m, fmpz *);
+        next = FLINT_ARRAY_ALLOC(num_primes + 1, slong);
+
+        for (l = 0; l <= num_primes; l++)
+            next[l] = 0;
+        for (i = 0; i < m; i++)
+            next[row_primes[i]]++;
+
+        /* sort the rows by decreasing number of primes */
+        num_rows[num_primes] = 0;
+        for (l = num_primes - 1; l >= 0; l--)
+            num_rows[l] = num_rows[l + 1] + next[l + 1];
+
+        for (l = 0; l <= num_primes; l++)
+            next[l] = num_rows[l];
+
+        for (i = 0; i < m; i++)
+        {
+            arg.Arows[next[row_primes[i]]] = A->rows[i];
+            arg.Crows[next[row_primes[i]]++] = C->rows[i];
+        }
+
+        flint_free(next);
+    }
+
+    arg.num_rows = num_rows;
+
+    arg.mod_C = FLINT_ARRAY_ALLOC(num_primes, nmod_mat_t);
+    for (l = 0; l < num_primes; l++)
+        nmod_mat_init(arg.mod_C[l], num_rows[l], n, primes[l]);
+
+    /* limit on the number of threads */
+    limit = (m + k + n)/64;
+    limit = FLINT_MIN(limit, num_primes);
+    limit = FLINT_MIN(limit, flint_get_num_threads());
+    limit = FLINT_MAX(limit, 1);
+
+    /* the residues of A and B for a group take a bounded amount of memory */
+    arg.group = MULTI_MOD_GROUP_MEMORY/((m*k + k*n)*sizeof(mp_limb_t));
+    arg.group = FLINT_MAX(arg.group, MULTI_MOD_GROUP);
+
+    /* mod and mul, with the threads not needed here left to nmod_mat_mul */
+    grain = FLINT_MIN(arg.group, num_primes/limit);
+    grain = FLINT_MAX(grain, 1);
+    flint_parallel_for(0, num_primes, grain, _prime_worker, &arg, limit);
+
+    /* limit on the number of threads */
+    limit = ((m + n)/64)*(1 + bits/1024);
+    limit = FLINT_MIN(limit, m/2);
+
+    /* crt */
+    flint_parallel_for(0, m, 0, _crt_rows_worker, &arg, limit);
+
+    for (l = 0; l < num_primes; l++)
+        nmod_mat_clear(arg.mod_C[l]);
+
+    flint_free(arg.mod_C);
+    flint_free(num_rows);
+
+    if (row_primes != NULL)
+    {
+        flint_free(arg.Arows);
+        flint_free(arg.Crows);
+    }
+}
+
+/*
+   Set row_primes[i] to the number of primes needed for row i of A*B, from
+   the bound bits and the bits of the row of A and of B, and return the
+   largest number.
+*/
+static slong _fmpz_mat_mul_multi_mod_row_primes(
+    slong * row_primes,
+    const fmpz_mat_t A,
+    const fmpz_mat_t B,
+    int sign,
+    flint_bitcnt_t bits,
+    slong num_primes,
+    flint_bitcnt_t primes_bits)
+{
+    slong i, r, max = 0;
+    slong k = A->c;
+    flint_bitcnt_t Abits, Bbits, rbits;
+
+    Bbits = FLINT_ABS(fmpz_mat_max_bits(B));
+
+    for (i = 0; i < A->r; i++)
+    {
+        Abits = FLINT_ABS(_fmpz_vec_max_bits(A->rows[i], k));
+
+        if (Abits == 0 || Bbits == 0)
+        {
+            r = 0;
+        }
+        else
+        {
+            rbits = Abits + Bbits + FLINT_BIT_COUNT(k) + sign;
+            rbits = FLINT_MIN(rbits, bits);
+
+            if (rbits <= FLINT_BITS - 1)
+                r = 1;
+            else
+                r = 1 + (rbits - (FLINT_BITS - 1) + primes_bits - 1)/primes_bits;
+
+            r = FLINT_MIN(r, num_primes);
+        }
+
+        row_primes[i] = r;
+        max = FLINT_MAX(max, r);
+    }
+
+    return max;
+}
+
+
+typedef struct {
+    slong n;
+    fmpz ** Crows;
+    fmpz ** Xrows;
+    const fmpz * M;
+    fmpz * Mb;
+    const fmpz * MMb;
+    fmpz * c;
+    int sign;
+} _combine_arg;
+
+static void _combine_worker(slong start, slong stop, void * varg)
+{
+    _combine_arg * arg = (_combine_arg *) varg;
+    slong i, j;
+
+    for (i = start; i < stop; i++)
+        for (j = 0; j < arg->n; j++)
+            _fmpz_CRT(arg->Crows[i] + j, arg->Crows[i] + j, arg->M,
+                   arg->Xrows[i] + j, arg->Mb, arg->MMb, arg->c, arg->sign);
+}
+
+void _fmpz_mat_mul_multi_mod_mem(
+    fmpz_mat_t C,
+    const fmpz_mat_t A,
+    const fmpz_mat_t B,
+    int sign,
+    flint_bitcnt_t bits,
+    slong mem)
+{
+    slong i, start, len, batch, size;
+    slong m, k, n, num_primes;
+    flint_bitcnt_t primes_bits;
+    mp_ptr primes;
+    ulong first_prime; /* not prime */
+
+    m = A->r;
+    k = A->c;
+    n = B->c;
+
+    if (m < 1 || n < 1 || k < 1)
+    {
+        fmpz_mat_zero(C);
+        return;
+    }
+
+    FLINT_ASSERT(sign == 0 || sign == 1);
+    bits += sign;
+
+    /* TUNING */
+    primes_bits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
+
+    if (bits < primes_bits || bits <= FLINT_BITS - 1)
+    {
+        num_primes = 1;
+        first_prime = UWORD(1) << bits;
+    }
+    else
+    {
+        /* Round up in the division */
+        num_primes = 1 + (bits - (FLINT_BITS - 1) + primes_bits - 1)/primes_bits;
+        first_prime = UWORD(1) << (FLINT_BITS - 1);
+    }
+
+    primes = FLINT_ARRAY_ALLOC(num_primes, mp_limb_t);
+    primes[0] = first_prime;
+    if (num_primes > 1)
+    {
+        primes[1] = n_nextprime(UWORD(1) << primes_bits, 0);
+        for (i = 2; i < num_primes; i++)
+            primes[i] = n_nextprime(primes[i-1], 0);
+    }
+
+    /*
+       Each prime costs the residues of C, and with a comb also those of A
+       and B, which otherwise only exist for the primes being multiplied.
+       When there is more than one batch, each prime also costs a limb of
+       each entry of the partial product.
+    */
+    size = m*n;
+    if (num_primes > MULTI_MOD_COMB_CUTOFF)
+        size += m*k + k*n;
+
+    if (num_primes <= mem/(size*sizeof(mp_limb_t)))
+    {
+        slong * row_primes = NULL;
+
+        /* rows of A with small entries need fewer primes */
+        if (num_primes > 1 && num_primes <= MULTI_MOD_COMB_CUTOFF)
+        {
+            row_primes = FLINT_ARRAY_ALLOC(m, slong);
+            num_primes = _fmpz_mat_mul_multi_mod_row_primes(row_primes, A, B,
+                                         sign, bits, num_primes, primes_bits);
+        }
+
+        if (num_primes == 0)
+            fmpz_mat_zero(C);
+        else
+            _fmpz_mat_mul_multi_mod_primes(C, A, B, primes, num_primes,
+                                                       row_primes, sign, bits);
+
+        flint_free(row_primes);
+    }
+    else
+    {
+        fmpz_mat_t X;
+        fmpz_t M, Mb, MMb, c;
+        _combine_arg arg;
+        slong limit;
+
+        batch = mem/((size + m*n)*sizeof(mp_limb_t));
+        batch = FLINT_MAX(batch, 1);
+
+        fmpz_mat_init(X, m, n);
+        fmpz_init(M);
+        fmpz_init(Mb);
+        fmpz_init(MMb);
+        fmpz_init(c);
+
+        _fmpz_mat_mul_multi_mod_primes(C, A, B, primes, batch, NULL, 0, bits);
+
+        fmpz_one(M);
+        for (i = 0; i < batch; i++)
+            fmpz_mul_ui(M, M, primes[i]);
+
+        /* limit on the number of threads */
+        limit = ((m + n)/64)*(1 + bits/1024);
+        limit = FLINT_MIN(limit, m/2);
+
+        arg.n = n;
+        arg.Crows = C->rows;
+        arg.Xrows = X->rows;
+        arg.M = M;
+        arg.Mb = Mb;
+        arg.MMb = MMb;
+        arg.c = c;
+
+        for (start = batch; start < num_primes; start += len)
+        {
+            len = FLINT_MIN(batch, num_primes - start);
+
+            _fmpz_mat_mul_multi_mod_primes(X, A, B, primes + start, len,
+                                                             NULL, 0, bits);
+
+            fmpz_one(Mb);
+            for (i = 0; i < len; i++)
+                fmpz_mul_ui(Mb, Mb, primes[start + i]);
+
+            fmpz_mul(MMb, M, Mb);
+            fmpz_mod(c, M, Mb);
+            fmpz_invmod(c, c, Mb);
+
+            /* only the final combination is put in the symmetric range */
+            arg.sign = sign && (start + len == num_primes);
+
+            flint_parallel_for(0, m, 0, _combine_worker, &arg, limit);
+
+            fmpz_swap(M, MMb);
+        }
+
+        fmpz_mat_clear(X);
+        fmpz_clear(M);
+        fmpz_clear(Mb);
+        fmpz_clear(MMb);
+        fmpz_clear(c);
+    }
+
+    flint_free(primes);
+}
+
+void _fmpz_mat_mul_multi_mod(
+    fmpz_mat_t C,
+    const fmpz_mat_t A,
+    const fmpz_mat_t B,
+    int sign,
+    flint_bitcnt_t bits)
+{
+    _fmpz_mat_mul_multi_mod_mem(C, A, B, sign, bits,
+                                               FMPZ_MAT_MULTI_MOD_MEMORY);
 }
 
 void
-fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
+fmpz_mat_mul_multi_mod_mem(fmpz_mat_t C, const fmpz_mat_t A,
+                                               const fmpz_mat_t B, slong mem)
 {
     slong Abits, Bbits;
     int sign = 0;
@@ -500,6 +892,11 @@ fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 
     Cbits = Abits + Bbits + FLINT_BIT_COUNT(A->c);
 
-    _fmpz_mat_mul_multi_mod(C, A, B, sign, Cbits);
+    _fmpz_mat_mul_multi_mod_mem(C, A, B, sign, Cbits, mem);
 }
 
+void
+fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
+{
+    fmpz_mat_mul_multi_mod_mem(C, A, B, FMPZ_MAT_MULTI_MOD_MEMORY);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright 2021 Daniel Schultz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -87,6 +88,40 @@ int main(void)
         fmpz_mat_clear(E);
     }
 
+    flint_printf("*** one row in eight of A with large entries ***\n");
+
+    for (dim = 50; dim <= 1000; dim += 5 + dim/8)
+    {
+        fmpz_mat_t A, B, E;
+        slong r, j;
+
+        fmpz_mat_init(A, dim, dim);
+        fmpz_mat_init(B, dim, dim);
+        fmpz_mat_init(E, dim, dim);
+
+        reps = 1 + 2000000/dim/dim/dim;
+        den = reps*dim*dim*dim;
+
+        for (r = 0; r < dim; r++)
+            for (j = 0; j < dim; j++)
+                fmpz_randtest(fmpz_mat_entry(A, r, j), state,
+                                      (r % 8 == 0) ? 6*FLINT_BITS : FLINT_BITS/2);
+
+        fmpz_mat_randtest(B, state, 2*FLINT_BITS);
+
+        timeit_start(timer);
+        for (i = reps; i > 0; i--)
+            fmpz_mat_mul_multi_mod(E, A, B);
+        timeit_stop(timer);
+
+        flint_printf("dim %3wd: %.3f ns | %wd reps\n",
+                     dim, 1000000.0*timer->wall/den, reps);
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(E);
+    }
+
     FLINT_TEST_CLEANUP(state);
     return 0;
 }
@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+
+/*
+    Sets B to a nonsingular r x r matrix with the same nonzero invariant
+    factors as A, where r is the rank of A, and det to its determinant, by
+    taking Hermite normal forms of A and of the transpose of the result.
+*/
+static slong
+_fmpz_mat_snf_reduce(fmpz_mat_t B, fmpz_t det, const fmpz_mat_t A)
+{
+    slong i, j, r, m = A->r, n = A->c;
+    fmpz_mat_t H, T;
+
+    fmpz_mat_init(H, m, n);
+    fmpz_mat_hnf(H, A);
+
+    for (r = 0; r < m && !fmpz_mat_is_zero_row(H, r); r++) ;
+
+    fmpz_mat_init(T, n, r);
+    for (i = 0; i < r; i++)
+        for (j = 0; j < n; j++)
+            fmpz_set(fmpz_mat_entry(T, j, i), fmpz_mat_entry(H, i, j));
+
+    fmpz_mat_clear(H);
+
+    fmpz_mat_init(H, n, r);
+    fmpz_mat_hnf(H, T);
+
+    fmpz_mat_init(B, r, r);
+    fmpz_one(det);
+    for (i = 0; i < r; i++)
+    {
+        for (j = i; j < r; j++)
+            fmpz_set(fmpz_mat_entry(B, i, j), fmpz_mat_entry(H, i, j));
+        fmpz_mul(det, det, fmpz_mat_entry(B, i, i));
+    }
+
+    fmpz_mat_clear(H);
+    fmpz_mat_clear(T);
+
+    return r;
+}
+
+/*
+    The largest invariant factor s_r of a nonsingular r x r matrix is the
+    least common denominator of its inverse, and the denominator d of the
+    solution of a linear system with a random right hand side is a divisor
+    of s_r which is usually equal to it. Then M = |det| / d is a multiple of
+    each of s_1, ..., s_{r-1}, so the Smith form modulo M gives these exactly
+    and s_r is recovered from the determinant. As the product of the other
+    invariant factors is usually tiny, working modulo M rather than modulo
+    the determinant avoids the growth of the entries.
+*/
+void
+fmpz_mat_snf_modular(fmpz_mat_t S, const fmpz_mat_t A)
+{
+    slong i, r, m = A->r, n = A->c;
+    fmpz_t d, det, M;
+    fmpz_mat_t B, C;
+    fmpz * inv;
+    int reduced = 0;
+
+    if (m == 0 || n == 0)
+        return;
+
+    fmpz_init(d);
+    fmpz_init(det);
+    fmpz_init(M);
+
+    if (m == n)
+        fmpz_mat_det_divisor(d, A);
+
+    if (!fmpz_is_zero(d))
+    {
+        r = n;
+        fmpz_mat_det_modular_given_divisor(det, A, d, 1);
+        *B = *A;
+    }
+    else
+    {
+        r = _fmpz_mat_snf_reduce(B, det, A);
+        reduced = 1;
+
+        if (r != 0)
+            fmpz_mat_det_divisor(d, B);
+    }
+
+    inv = _fmpz_vec_init(r);
+
+    if (r != 0)
+    {
+        fmpz_abs(det, det);
+        fmpz_abs(d, d);
+        fmpz_divexact(M, det, d);
+
+        if (fmpz_is_one(M))
+        {
+            for (i = 0; i < r - 1; i++)
+                fmpz_one(inv + i);
+        }
+        else
+        {
+            fmpz_mat_init(C, r, r);
+            fmpz_mat_snf_iliopoulos(C, B, M);
+
+            for (i = 0; i < r - 1; i++)
+            {
+                fmpz_set(inv + i, fmpz_mat_entry(C, i, i));
+                fmpz_divexact(det, det, inv + i);
+            }
+
+            fmpz_mat_clear(C);
+        }
+
+        fmpz_set(inv + r - 1, det);
+    }
+
+    fmpz_mat_zero(S);
+    for (i = 0; i < r; i++)
+        fmpz_swap(fmpz_mat_entry(S, i, i), inv + i);
+
+    _fmpz_vec_clear(inv, r);
+
+    if (reduced)
+        fmpz_mat_clear(B);
+
+    fmpz_clear(d);
+    fmpz_clear(det);
+    fmpz_clear(M);
+}
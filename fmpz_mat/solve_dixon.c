@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -10,6 +11,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_support.h"
 
 mp_limb_t
 fmpz_mat_find_good_prime_and_invert(nmod_mat_t Ainv,
@@ -87,6 +89,75 @@ mp_limb_t * fmpz_mat_dixon_get_crt_primes(slong * num_primes, const fmpz_mat_t A
 }
 
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    nmod_mat_struct * A_mod;
+    nmod_mat_struct * Ay_mod;
+    const nmod_mat_struct * y_mod;
+    fmpz_mat_struct * Ay;
+    mp_srcptr primes;
+    slong num_primes;
+    const fmpz_comb_struct * comb;
+}
+_dixon_arg_struct;
+
+static void
+_dixon_reduce_worker(slong start, slong stop, void * varg)
+{
+    _dixon_arg_struct * arg = (_dixon_arg_struct *) varg;
+    slong i;
+
+    for (i = start; i < stop; i++)
+        fmpz_mat_get_nmod_mat(arg->A_mod + i, arg->A);
+}
+
+/* y_mod has entries < p, so it can be read modulo any of the crt primes */
+static void
+_dixon_mul_worker(slong start, slong stop, void * varg)
+{
+    _dixon_arg_struct * arg = (_dixon_arg_struct *) varg;
+    nmod_mat_t y;
+    slong i;
+
+    for (i = start; i < stop; i++)
+    {
+        nmod_mat_window_init(y, arg->y_mod, 0, 0,
+                                          arg->y_mod->r, arg->y_mod->c);
+        _nmod_mat_set_mod(y, arg->primes[i]);
+        nmod_mat_mul(arg->Ay_mod + i, arg->A_mod + i, y);
+        nmod_mat_window_clear(y);
+    }
+}
+
+/* reconstructs the rows start, ..., stop - 1 of Ay with the product tree */
+static void
+_dixon_crt_worker(slong start, slong stop, void * varg)
+{
+    _dixon_arg_struct * arg = (_dixon_arg_struct *) varg;
+    fmpz_comb_temp_t temp;
+    mp_ptr r;
+    slong i, j, k;
+
+    fmpz_comb_temp_init(temp, arg->comb);
+    r = _nmod_vec_init(arg->num_primes);
+
+    for (i = start; i < stop; i++)
+    {
+        for (j = 0; j < arg->Ay->c; j++)
+        {
+            for (k = 0; k < arg->num_primes; k++)
+                r[k] = nmod_mat_entry(arg->Ay_mod + k, i, j);
+
+            fmpz_multi_CRT_ui(fmpz_mat_entry(arg->Ay, i, j), r,
+                                                     arg->comb, temp, 1);
+        }
+    }
+
+    _nmod_vec_clear(r);
+    fmpz_comb_temp_clear(temp);
+}
+
 void
 _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
                         const fmpz_mat_t A, const fmpz_mat_t B,
@@ -95,18 +166,18 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 {
     fmpz_t bound, ppow;
     fmpz_mat_t x, d, y, Ay;
-    fmpz_t prod;
     mp_limb_t * crt_primes;
-    nmod_mat_t * A_mod;
-    nmod_mat_t Ay_mod, d_mod, y_mod;
-    slong i, n, cols, num_primes;
+    nmod_mat_struct * A_mod, * Ay_mod;
+    nmod_mat_t d_mod, y_mod;
+    fmpz_comb_t comb;
+    _dixon_arg_struct arg;
+    slong i, n, cols, num_primes, num_threads;
 
     n = A->r;
     cols = B->c;
 
     fmpz_init(bound);
     fmpz_init(ppow);
-    fmpz_init(prod);
 
     fmpz_mat_init(x, n, cols);
     fmpz_mat_init(y, n, cols);
@@ -124,15 +195,32 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         fmpz_mul(bound, N, N);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
 
+    num_threads = flint_get_num_threads();
+
+    /* the products modulo the crt primes are done in parallel */
     crt_primes = fmpz_mat_dixon_get_crt_primes(&num_primes, A, p);
-    A_mod = (nmod_mat_t *) flint_malloc(sizeof(nmod_mat_t) * num_primes);
+    A_mod = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
+    Ay_mod = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
     for (i = 0; i < num_primes; i++)
     {
-        nmod_mat_init(A_mod[i], n, n, crt_primes[i]);
-        fmpz_mat_get_nmod_mat(A_mod[i], A);
+        nmod_mat_init(A_mod + i, n, n, crt_primes[i]);
+        nmod_mat_init(Ay_mod + i, n, cols, crt_primes[i]);
     }
 
-    nmod_mat_init(Ay_mod, n, cols, UWORD(1));
+    fmpz_comb_init(comb, crt_primes, num_primes);
+
+    arg.A = A;
+    arg.A_mod = A_mod;
+    arg.Ay_mod = Ay_mod;
+    arg.y_mod = y_mod;
+    arg.Ay = Ay;
+    arg.primes = crt_primes;
+    arg.num_primes = num_primes;
+    arg.comb = comb;
+
+    flint_parallel_for(0, num_primes, 1, _dixon_reduce_worker, &arg,
+                                                                 num_threads);
+
     nmod_mat_init(d_mod, n, cols, p);
     nmod_mat_init(y_mod, n, cols, p);
 
@@ -157,25 +245,11 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         fmpz_mat_set_nmod_mat_unsigned(y, y_mod);
         fmpz_mat_mul(Ay, A, y);
 #else
-        for (i = 0; i < num_primes; i++)
-        {
-            _nmod_mat_set_mod(y_mod, crt_primes[i]);
-            _nmod_mat_set_mod(Ay_mod, crt_primes[i]);
-            nmod_mat_mul(Ay_mod, A_mod[i], y_mod);
-            if (i == 0)
-            {
-                fmpz_mat_set_nmod_mat(Ay, Ay_mod);
-                fmpz_set_ui(prod, crt_primes[0]);
-            }
-            else
-            {
-                fmpz_mat_CRT_ui(Ay, Ay, prod, Ay_mod, 1);
-                fmpz_mul_ui(prod, prod, crt_primes[i]);
-            }
-        }
+        flint_parallel_for(0, num_primes, 1, _dixon_mul_worker, &arg,
+                                                                 num_threads);
+        flint_parallel_for(0, n, 0, _dixon_crt_worker, &arg, num_threads);
 #endif
 
-        _nmod_mat_set_mod(y_mod, p);
         fmpz_mat_sub(d, d, Ay);
         fmpz_mat_scalar_divexact_ui(d, d, p);
     }
@@ -185,17 +259,20 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
     nmod_mat_clear(y_mod);
     nmod_mat_clear(d_mod);
-    nmod_mat_clear(Ay_mod);
 
     for (i = 0; i < num_primes; i++)
-        nmod_mat_clear(A_mod[i]);
+    {
+        nmod_mat_clear(A_mod + i);
+        nmod_mat_clear(Ay_mod + i);
+    }
 
+    fmpz_comb_clear(comb);
     flint_free(A_mod);
+    flint_free(Ay_mod);
     flint_free(crt_primes);
 
     fmpz_clear(bound);
     fmpz_clear(ppow);
-    fmpz_clear(prod);
 
     fmpz_mat_clear(x);
     fmpz_mat_clear(y);
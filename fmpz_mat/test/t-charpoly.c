@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,6 +18,7 @@
 #include "fmpz.h"
 #include "fmpz_mat.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
 
 int
 main(void)
@@ -113,6 +115,39 @@ main(void)
         fmpz_poly_clear(g);
     }
 
+    /* modular algorithm with several threads */
+    for (rep = 0; rep < 100 * flint_test_multiplier(); rep++)
+    {
+        fmpz_mat_t A;
+        fmpz_poly_t f, g;
+
+        m = n_randint(state, 20);
+
+        fmpz_mat_init(A, m, m);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 100));
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_mat_charpoly_modular(f, A);
+        fmpz_mat_charpoly_berkowitz(g, A);
+
+        if (!fmpz_poly_equal(f, g))
+        {
+            flint_printf("FAIL: modular and Berkowitz charpolys differ.\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("cp1 = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("cp2 = "), fmpz_poly_print_pretty(g, "X"), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,6 +18,7 @@
 #include "fmpz_vec.h"
 #include "fmpz_mat.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
 
 
 int
@@ -37,6 +39,8 @@ main(void)
         int proved = n_randlimb(state) % 2;
         m = n_randint(state, 10);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         fmpz_mat_init(A, m, m);
 
         fmpz_init(det1);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014 Alex J. Best
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -195,6 +196,62 @@ main(void)
         fmpz_mat_clear(A);
     }
 
+    /* Larger nonsingular square matrices, with aliasing */
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, H, H2, U;
+        fmpz_t det;
+        slong n, b, d;
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        n = FMPZ_MAT_HNF_TRANSFORM_SOLVE_CUTOFF + n_randint(state, 20);
+
+        fmpz_mat_init(A, n, n);
+        fmpz_mat_init(H, n, n);
+        fmpz_mat_init(H2, n, n);
+        fmpz_mat_init(U, n, n);
+
+        b = 1 + n_randint(state, 10) * n_randint(state, 10);
+        d = n_randint(state, 2*n*n + 1);
+        fmpz_mat_randrank(A, state, n, b);
+        fmpz_mat_randops(A, state, d);
+
+        fmpz_mat_set(H, A);
+        fmpz_mat_hnf_transform(H, U, H);
+
+        fmpz_mat_hnf(H2, A);
+        if (!fmpz_mat_equal(H, H2))
+        {
+            flint_printf("FAIL (square):\n");
+            flint_printf("hnfs produced by different methods should be the same!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H2); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_init(det);
+        fmpz_mat_det(det, U);
+        fmpz_mat_mul(H2, U, A);
+
+        if (!fmpz_is_pm1(det) || !fmpz_mat_equal(H, H2))
+        {
+            flint_printf("FAIL (square):\n");
+            flint_printf("bad transformation matrix!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(U); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_clear(det);
+        fmpz_mat_clear(U);
+        fmpz_mat_clear(H2);
+        fmpz_mat_clear(H);
+        fmpz_mat_clear(A);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,6 +18,7 @@
 #include "fmpz.h"
 #include "fmpz_mat.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
 
 int
 main(void)
@@ -138,6 +140,57 @@ main(void)
         fmpz_poly_clear(g);
     }
 
+    /* several threads against one thread */
+    for (rep = 0; rep < 100 * flint_test_multiplier(); rep++)
+    {
+        fmpz_mat_t A;
+        fmpz_poly_t f, g, q, r;
+
+        n = 2*n_randint(state, 8);
+
+        fmpz_mat_init(A, n, n);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(q);
+        fmpz_poly_init(r);
+
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 50));
+
+        for (i = 0; i < n/2; i++)
+        {
+           for (j = 0; j < n/2; j++)
+           {
+              fmpz_zero(fmpz_mat_entry(A, i + n/2, j));
+              fmpz_zero(fmpz_mat_entry(A, i, j + n/2));
+              fmpz_set(fmpz_mat_entry(A, i + n/2, j + n/2), fmpz_mat_entry(A, i, j));
+           }
+        }
+
+        flint_set_num_threads(n_randint(state, 4) + 2);
+        fmpz_mat_minpoly_modular(f, A);
+
+        flint_set_num_threads(1);
+        fmpz_mat_minpoly_modular(g, A);
+
+        fmpz_mat_charpoly(q, A);
+        fmpz_poly_divrem(q, r, q, f);
+
+        if (!fmpz_poly_equal(f, g) || !fmpz_poly_is_zero(r))
+        {
+            flint_printf("FAIL: threaded minpoly.\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("mp1 = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("mp2 = "), fmpz_poly_print_pretty(g, "X"), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(q);
+        fmpz_poly_clear(r);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -95,8 +96,87 @@ int main(void)
         fmpz_mat_clear(D);
     }
 
+    /* limit the memory so that the primes are split into batches */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        slong m, n, k, mem;
+
+        m = n_randint(state, 20) + 1;
+        n = n_randint(state, 20) + 1;
+        k = n_randint(state, 20) + 1;
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, n, k);
+        fmpz_mat_init(C, m, k);
+        fmpz_mat_init(D, m, k);
+
+        fmpz_mat_randtest(A, state, n_randint(state, 2000) + 1);
+        fmpz_mat_randtest(B, state, n_randint(state, 2000) + 1);
+        fmpz_mat_randtest(D, state, n_randint(state, 200) + 1);
+
+        mem = n_randint(state, 20)*(m*n + n*k + 2*m*k)*sizeof(mp_limb_t);
+
+        fmpz_mat_mul_classical_inline(C, A, B);
+        fmpz_mat_mul_multi_mod_mem(D, A, B, mem);
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal (mem = %wd)\n", mem);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(D);
+    }
+
+    /* rows of very different sizes need different numbers of primes */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        slong m, n, k, r, j;
+
+        m = n_randint(state, 40) + 1;
+        n = n_randint(state, 40) + 1;
+        k = n_randint(state, 40) + 1;
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, n, k);
+        fmpz_mat_init(C, m, k);
+        fmpz_mat_init(D, m, k);
+
+        for (r = 0; r < m; r++)
+        {
+            if (n_randint(state, 4) == 0)
+                continue;
+
+            for (j = 0; j < n; j++)
+                fmpz_randtest(fmpz_mat_entry(A, r, j), state,
+                                             n_randint(state, 1000) + 1);
+        }
+
+        fmpz_mat_randtest(B, state, n_randint(state, 1000) + 1);
+        fmpz_mat_randtest(D, state, n_randint(state, 200) + 1);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_mat_mul_classical_inline(C, A, B);
+        fmpz_mat_mul_multi_mod(D, A, B);
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal (rows of different sizes)\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(D);
+    }
+
     FLINT_TEST_CLEANUP(state);
-    
+
     flint_printf("PASS\n");
     return 0;
 }
@@ -0,0 +1,123 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("snf_modular....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, S, S2;
+        slong i, m, n, b, d, r;
+        int equal, known;
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+
+        if (n_randint(state, 2))
+            n = m;
+
+        /* larger matrices only with known invariant factors */
+        known = n_randint(state, 2);
+        if (known && n_randint(state, 5) == 0)
+        {
+            m += 10;
+            n += 10;
+        }
+
+        r = FLINT_MIN(m, n);
+        if (n_randint(state, 3) == 0)
+            r = n_randint(state, r + 1);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(S, m, n);
+        fmpz_mat_init(S2, m, n);
+
+        if (!known)
+        {
+            /* sparse */
+            b = 1 + n_randint(state, 10) * n_randint(state, 10);
+            fmpz_mat_randrank(A, state, r, b);
+        }
+        else
+        {
+            /* prescribed nontrivial invariant factors */
+            fmpz_t s;
+            fmpz_init_set_ui(s, 1);
+            for (i = 0; i < r; i++)
+            {
+                fmpz_mul_ui(s, s, 1 + n_randint(state, 2) * n_randint(state, 6));
+                fmpz_set(fmpz_mat_entry(A, i, i), s);
+            }
+            fmpz_clear(s);
+            fmpz_mat_set(S2, A);
+        }
+
+        /* dense */
+        d = n_randint(state, 2*m*n + 1);
+        if (n_randint(state, 4) != 0)
+            fmpz_mat_randops(A, state, d);
+
+        if (n_randint(state, 2))
+        {
+            fmpz_mat_snf_modular(S, A);
+        }
+        else
+        {
+            fmpz_mat_set(S, A);
+            fmpz_mat_snf_modular(S, S);
+        }
+
+        if (!fmpz_mat_is_in_snf(S))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("matrix not in snf!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            abort();
+        }
+
+        if (!known)
+            fmpz_mat_snf_kannan_bachem(S2, A);
+        equal = fmpz_mat_equal(S, S2);
+
+        if (!equal)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong invariant factors!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S2); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_clear(S2);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -17,6 +18,7 @@
 #include "fmpz_vec.h"
 #include "fmpz_mat.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
 
 int
 main(void)
@@ -36,6 +38,8 @@ main(void)
         m = n_randint(state, 20);
         n = n_randint(state, 20);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         fmpz_mat_init(A, m, m);
         fmpz_mat_init(B, m, n);
         fmpz_mat_init(Bm, m, n);
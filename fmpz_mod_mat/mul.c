@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2017 Luca De Feo
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -13,6 +14,37 @@
 
 void fmpz_mod_mat_mul(fmpz_mod_mat_t C, const fmpz_mod_mat_t A, const fmpz_mod_mat_t B)
 {
+    /* a word size modulus uses Strassen and threading in nmod_mat_mul */
+    if (fmpz_abs_fits_ui(A->mod))
+    {
+        nmod_mat_t Amod, Bmod, Cmod;
+        mp_limb_t n = fmpz_get_ui(A->mod);
+        slong i, j;
+
+        nmod_mat_init(Amod, A->mat->r, A->mat->c, n);
+        nmod_mat_init(Bmod, B->mat->r, B->mat->c, n);
+        nmod_mat_init(Cmod, A->mat->r, B->mat->c, n);
+
+        /* the entries are reduced already */
+        for (i = 0; i < Amod->r; i++)
+            for (j = 0; j < Amod->c; j++)
+                nmod_mat_entry(Amod, i, j) =
+                                    fmpz_get_ui(fmpz_mod_mat_entry(A, i, j));
+
+        for (i = 0; i < Bmod->r; i++)
+            for (j = 0; j < Bmod->c; j++)
+                nmod_mat_entry(Bmod, i, j) =
+                                    fmpz_get_ui(fmpz_mod_mat_entry(B, i, j));
+
+        nmod_mat_mul(Cmod, Amod, Bmod);
+        fmpz_mat_set_nmod_mat_unsigned(C->mat, Cmod);
+
+        nmod_mat_clear(Amod);
+        nmod_mat_clear(Bmod);
+        nmod_mat_clear(Cmod);
+        return;
+    }
+
     /* N.B. don't call classical_threaded, instead, thread fmpz_mat_mul */
     fmpz_mat_mul(C->mat, A->mat, B->mat);
     _fmpz_mod_mat_reduce(C);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2017 Luca De Feo
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -13,6 +14,29 @@
 
 void fmpz_mod_mat_sqr(fmpz_mod_mat_t B, const fmpz_mod_mat_t A)
 {
+    if (fmpz_abs_fits_ui(A->mod))
+    {
+        nmod_mat_t Amod, Bmod;
+        mp_limb_t n = fmpz_get_ui(A->mod);
+        slong i, j;
+
+        nmod_mat_init(Amod, A->mat->r, A->mat->c, n);
+        nmod_mat_init(Bmod, A->mat->r, A->mat->c, n);
+
+        /* the entries are reduced already */
+        for (i = 0; i < Amod->r; i++)
+            for (j = 0; j < Amod->c; j++)
+                nmod_mat_entry(Amod, i, j) =
+                                    fmpz_get_ui(fmpz_mod_mat_entry(A, i, j));
+
+        nmod_mat_mul(Bmod, Amod, Amod);
+        fmpz_mat_set_nmod_mat_unsigned(B->mat, Bmod);
+
+        nmod_mat_clear(Amod);
+        nmod_mat_clear(Bmod);
+        return;
+    }
+
     fmpz_mat_sqr(B->mat, A->mat);
     _fmpz_mod_mat_reduce(B);
 }
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 Sebastian Pancratz
     Copyright (C) 2014 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -42,6 +43,9 @@
 
 #define FMPZ_MOD_POLY_INV_NEWTON_CUTOFF  64 /* Inv series newton: Basecase -> Newton */
 
+#define FMPZ_MOD_POLY_MULMOD_PRECACHE_CUTOFF 64 /* mulmod: plain -> precached FFT */
+#define FMPZ_MOD_POLY_MULMOD_PRECACHE_RATIO 256 /* max length per limb of p for the FFT */
+
 /*  Type definitions *********************************************************/
 
 typedef struct
@@ -101,6 +105,18 @@ typedef struct
 }
 fmpz_mod_poly_compose_mod_precomp_preinv_arg_t;
 
+typedef struct
+{
+    fmpz_mod_poly_t f;
+    fmpz_mod_poly_t finv;
+    fmpz_poly_mul_precache_t pre_f;    /* f truncated to lenf - 1 terms */
+    fmpz_poly_mul_precache_t pre_finv; /* finv truncated to lenf - 2 terms */
+    int use_fft; /* whether pre_f and pre_finv are initialised */
+}
+fmpz_mod_poly_mulmod_precache_struct;
+
+typedef fmpz_mod_poly_mulmod_precache_struct fmpz_mod_poly_mulmod_precache_t[1];
+
 
 /*  Initialisation and memory management *************************************/
 
@@ -490,6 +506,21 @@ FLINT_DLL void fmpz_mod_poly_mulmod_preinv(fmpz_mod_poly_t res,
                      const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
                                                      const fmpz_mod_ctx_t ctx);
 
+FLINT_DLL void fmpz_mod_poly_mulmod_precache_init(
+                  fmpz_mod_poly_mulmod_precache_t pre, const fmpz_mod_poly_t f,
+                   const fmpz_mod_poly_t finv, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_poly_mulmod_precache_clear(
+              fmpz_mod_poly_mulmod_precache_t pre, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_mulmod_preinv_precache(fmpz * res,
+             const fmpz * poly1, slong len1, const fmpz * poly2, slong len2,
+                         fmpz_mod_poly_mulmod_precache_t pre, const fmpz_t p);
+
+FLINT_DLL void fmpz_mod_poly_mulmod_preinv_precache(fmpz_mod_poly_t res,
+                     const fmpz_mod_poly_t poly1, const fmpz_mod_poly_t poly2,
+             fmpz_mod_poly_mulmod_precache_t pre, const fmpz_mod_ctx_t ctx);
+
 /*  Powering *****************************************************************/
 
 FLINT_DLL void _fmpz_mod_poly_pow(fmpz *rop, const fmpz *op, slong len, ulong e, 
@@ -0,0 +1,162 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod_poly.h"
+
+static void
+_precache_init_trunc(fmpz_poly_mul_precache_t pre, slong len1,
+                            slong bits1, const fmpz * coeffs, slong len)
+{
+    fmpz_poly_struct t;
+
+    t.coeffs = (fmpz *) coeffs;
+    t.alloc = len;
+    t.length = len;
+    _fmpz_poly_normalise(&t);
+
+    fmpz_poly_mul_SS_precache_init(pre, len1, bits1, &t);
+}
+
+void fmpz_mod_poly_mulmod_precache_init(fmpz_mod_poly_mulmod_precache_t pre,
+                   const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    const slong lenf = f->length;
+    slong bits = fmpz_bits(fmpz_mod_ctx_modulus(ctx));
+    slong limbs = (bits + FLINT_BITS - 1)/FLINT_BITS;
+
+    fmpz_mod_poly_init(pre->f, ctx);
+    fmpz_mod_poly_init(pre->finv, ctx);
+    fmpz_mod_poly_set(pre->f, f, ctx);
+    fmpz_mod_poly_set(pre->finv, finv, ctx);
+
+    /*
+        The quotient has at most lenf - 2 terms, so only that many terms
+        of finv and lenf - 1 terms of f are ever needed. Kronecker
+        substitution wins for single limb moduli and for long polynomials
+        relative to the size of the modulus.
+    */
+    pre->use_fft = (limbs > 1 &&
+                    lenf >= FMPZ_MOD_POLY_MULMOD_PRECACHE_CUTOFF &&
+                    lenf <= limbs*FMPZ_MOD_POLY_MULMOD_PRECACHE_RATIO &&
+                    !_fmpz_vec_is_zero(f->coeffs, lenf - 1) &&
+                    !_fmpz_vec_is_zero(finv->coeffs,
+                                       FLINT_MIN(finv->length, lenf - 2)));
+
+    if (pre->use_fft)
+    {
+        _precache_init_trunc(pre->pre_f, lenf - 2, bits,
+                                                      f->coeffs, lenf - 1);
+        _precache_init_trunc(pre->pre_finv, lenf - 2, bits,
+                        finv->coeffs, FLINT_MIN(finv->length, lenf - 2));
+    }
+}
+
+void fmpz_mod_poly_mulmod_precache_clear(fmpz_mod_poly_mulmod_precache_t pre,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    if (pre->use_fft)
+    {
+        fmpz_poly_mul_precache_clear(pre->pre_f);
+        fmpz_poly_mul_precache_clear(pre->pre_finv);
+    }
+
+    fmpz_mod_poly_clear(pre->f, ctx);
+    fmpz_mod_poly_clear(pre->finv, ctx);
+}
+
+void _fmpz_mod_poly_mulmod_preinv_precache(fmpz * res,
+             const fmpz * poly1, slong len1, const fmpz * poly2, slong len2,
+                          fmpz_mod_poly_mulmod_precache_t pre, const fmpz_t p)
+{
+    const slong lenf = pre->f->length;
+    fmpz * T, * Q;
+    slong lenT, lenQ;
+
+    if (!pre->use_fft)
+    {
+        _fmpz_mod_poly_mulmod_preinv(res, poly1, len1, poly2, len2,
+                   pre->f->coeffs, lenf, pre->finv->coeffs, pre->finv->length, p);
+        return;
+    }
+
+    lenT = len1 + len2 - 1;
+    lenQ = lenT - lenf + 1;
+
+    T = _fmpz_vec_init(lenT + lenQ);
+    Q = T + lenT;
+
+    if (len1 >= len2)
+        _fmpz_mod_poly_mul(T, poly1, len1, poly2, len2, p);
+    else
+        _fmpz_mod_poly_mul(T, poly2, len2, poly1, len1, p);
+
+    /* Q = rev(rev(T)*finv mod x^lenQ) */
+    _fmpz_poly_reverse(Q, T + lenT - lenQ, lenQ, lenQ);
+    _fmpz_poly_mullow_SS_precache(Q, Q, lenQ, pre->pre_finv, lenQ);
+    _fmpz_vec_scalar_mod_fmpz(Q, Q, lenQ, p);
+    _fmpz_poly_reverse(Q, Q, lenQ, lenQ);
+
+    /* res = T - Q*f mod x^(lenf - 1) */
+    _fmpz_poly_mullow_SS_precache(res, Q, lenQ, pre->pre_f, lenf - 1);
+    _fmpz_vec_sub(res, T, res, lenf - 1);
+    _fmpz_vec_scalar_mod_fmpz(res, res, lenf - 1, p);
+
+    _fmpz_vec_clear(T, lenT + lenQ);
+}
+
+void
+fmpz_mod_poly_mulmod_preinv_precache(fmpz_mod_poly_t res,
+                     const fmpz_mod_poly_t poly1, const fmpz_mod_poly_t poly2,
+              fmpz_mod_poly_mulmod_precache_t pre, const fmpz_mod_ctx_t ctx)
+{
+    slong len1, len2, lenf;
+
+    lenf = pre->f->length;
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    if (lenf == 0)
+    {
+        flint_printf("Exception (fmpz_mod_poly_mulmod_preinv_precache). Divide by zero\n");
+        flint_abort();
+    }
+
+    if (lenf <= len1 || lenf <= len2)
+    {
+        flint_printf("Exception (fmpz_mod_poly_mulmod_preinv_precache). Input larger than modulus.\n");
+        flint_abort();
+    }
+
+    if (lenf == 1 || len1 == 0 || len2 == 0)
+    {
+        fmpz_mod_poly_zero(res, ctx);
+        return;
+    }
+
+    if (len1 + len2 - lenf > 0)
+    {
+        fmpz_mod_poly_fit_length(res, len1 + len2 - 1, ctx);
+        _fmpz_mod_poly_mulmod_preinv_precache(res->coeffs, poly1->coeffs, len1,
+                       poly2->coeffs, len2, pre, fmpz_mod_ctx_modulus(ctx));
+
+        _fmpz_mod_poly_set_length(res, lenf - 1);
+        _fmpz_mod_poly_normalise(res);
+    }
+    else
+    {
+        fmpz_mod_poly_mul(res, poly1, poly2, ctx);
+    }
+}
@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    fmpz_mod_ctx_t ctx;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmod_preinv_precache....");
+    fflush(stdout);
+
+    fmpz_mod_ctx_init_ui(ctx, 2);
+
+    /* Compare with mulmod, several products for each precache */
+    for (i = 0; i < 30 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        fmpz_mod_poly_t a, b, res1, res2, f, finv;
+        fmpz_mod_poly_mulmod_precache_t pre;
+        slong lenf, k;
+
+        fmpz_init(p);
+        fmpz_randprime(p, state, 2 + n_randint(state, 200), 0);
+        fmpz_mod_ctx_set_modulus(ctx, p);
+
+        fmpz_mod_poly_init(a, ctx);
+        fmpz_mod_poly_init(b, ctx);
+        fmpz_mod_poly_init(f, ctx);
+        fmpz_mod_poly_init(finv, ctx);
+        fmpz_mod_poly_init(res1, ctx);
+        fmpz_mod_poly_init(res2, ctx);
+
+        lenf = 1 + n_randint(state, n_randint(state, 2) ? 50 : 300);
+        fmpz_mod_poly_randtest_not_zero(f, state, lenf, ctx);
+
+        fmpz_mod_poly_reverse(finv, f, f->length, ctx);
+        fmpz_mod_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+        fmpz_mod_poly_mulmod_precache_init(pre, f, finv, ctx);
+
+        for (k = 0; k < 3; k++)
+        {
+            fmpz_mod_poly_randtest(a, state, n_randint(state, f->length), ctx);
+            fmpz_mod_poly_randtest(b, state, n_randint(state, f->length), ctx);
+
+            fmpz_mod_poly_mulmod(res1, a, b, f, ctx);
+            fmpz_mod_poly_mulmod_preinv_precache(res2, a, b, pre, ctx);
+
+            result = (fmpz_mod_poly_equal(res1, res2, ctx));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("a:\n"); fmpz_mod_poly_print(a, ctx), flint_printf("\n\n");
+                flint_printf("b:\n"); fmpz_mod_poly_print(b, ctx), flint_printf("\n\n");
+                flint_printf("f:\n"); fmpz_mod_poly_print(f, ctx), flint_printf("\n\n");
+                flint_printf("res1:\n"); fmpz_mod_poly_print(res1, ctx), flint_printf("\n\n");
+                flint_printf("res2:\n"); fmpz_mod_poly_print(res2, ctx), flint_printf("\n\n");
+                abort();
+            }
+
+            /* aliasing res and a */
+            fmpz_mod_poly_mulmod_preinv_precache(a, a, b, pre, ctx);
+
+            result = (fmpz_mod_poly_equal(res1, a, ctx));
+            if (!result)
+            {
+                flint_printf("FAIL (aliasing):\n");
+                flint_printf("f:\n"); fmpz_mod_poly_print(f, ctx), flint_printf("\n\n");
+                flint_printf("res1:\n"); fmpz_mod_poly_print(res1, ctx), flint_printf("\n\n");
+                flint_printf("a:\n"); fmpz_mod_poly_print(a, ctx), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpz_mod_poly_mulmod_precache_clear(pre, ctx);
+
+        fmpz_clear(p);
+        fmpz_mod_poly_clear(a, ctx);
+        fmpz_mod_poly_clear(b, ctx);
+        fmpz_mod_poly_clear(f, ctx);
+        fmpz_mod_poly_clear(finv, ctx);
+        fmpz_mod_poly_clear(res1, ctx);
+        fmpz_mod_poly_clear(res2, ctx);
+    }
+
+    fmpz_mod_ctx_clear(ctx);
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -3,6 +3,7 @@
     Copyright (C) 2009, 2011 Andy Novocin
     Copyright (C) 2010 Sebastian Pancratz
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -34,6 +35,7 @@
 #include "fmpz_vec.h"
 #include "nmod_poly.h"
 #include "fmpq.h"
+#include "fft.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -74,12 +76,9 @@ typedef fmpz_poly_factor_struct fmpz_poly_factor_t[1];
 
 typedef struct
 {
-   mp_limb_t ** jj; /* used by fft_convolution_precache */
-   slong n;
+   fft_plan_t plan; /* transform of poly2 */
    slong len2;
-   slong loglen;
    slong bits2;
-   slong limbs;
    fmpz_poly_t poly2;
 } fmpz_poly_mul_precache_struct;
 
@@ -500,6 +499,38 @@ FLINT_DLL void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong le
 FLINT_DLL void fmpz_poly_mullow_SS(fmpz_poly_t res,
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+#define FMPZ_POLY_MULTI_MOD_NUM_PRIMES 256
+#define FMPZ_POLY_MULTI_MOD_CUTOFF 512
+#define FMPZ_POLY_MULTI_MOD_BITS_CUTOFF 600
+
+/*
+   Whether the multimodular algorithm is preferred for a product where the
+   shorter factor has length len and the bit sizes of the factors add up
+   to bits. Its three phases split evenly over up to four threads, which
+   raises the bit size at which Schoenhage-Strassen takes over.
+*/
+FMPZ_POLY_INLINE int
+_fmpz_poly_mul_multi_mod_use(slong len, flint_bitcnt_t bits)
+{
+    slong limit = FMPZ_POLY_MULTI_MOD_BITS_CUTOFF
+                          * FLINT_MIN(FLINT_MAX(flint_get_num_threads(), 1), 4);
+
+    if (len < FMPZ_POLY_MULTI_MOD_CUTOFF
+          || (bits < 2*FLINT_BITS && len < 2*FMPZ_POLY_MULTI_MOD_CUTOFF))
+        return 0;
+
+    if (len >= 8*FMPZ_POLY_MULTI_MOD_CUTOFF)
+        limit *= 2;
+
+    return bits <= limit;
+}
+
+FLINT_DLL void _fmpz_poly_mul_multi_mod(fmpz * res, const fmpz * poly1,
+                          slong len1, const fmpz * poly2, slong len2);
+
+FLINT_DLL void fmpz_poly_mul_multi_mod(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
 FLINT_DLL void _fmpz_poly_mul(fmpz * res, const fmpz * poly1, 
                                   slong len1, const fmpz * poly2, slong len2);
 
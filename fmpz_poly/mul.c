@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -145,6 +146,8 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
 
     if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
         _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
+    else if (_fmpz_poly_mul_multi_mod_use(len2, bits1 + bits2))
+        _fmpz_poly_mul_multi_mod(res, poly1, len1, poly2, len2);
     else if (limbs1 + limbs2 <= 8)
         _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
     else if ((limbs1+limbs2)/2048 > len1 + len2)
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2010, 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -28,6 +29,7 @@ _fmpz_poly_mul_KS(fmpz * res, const fmpz * poly1, slong len1,
     slong bits1, bits2, bits;
     mp_limb_t *arr1, *arr2, *arr3;
     slong sign = 0;
+    TMP_INIT;
 
     FMPZ_VEC_NORM(poly1, len1);
     FMPZ_VEC_NORM(poly2, len2);
@@ -67,21 +69,25 @@ _fmpz_poly_mul_KS(fmpz * res, const fmpz * poly1, slong len1,
     limbs1 = (bits * len1 - 1) / FLINT_BITS + 1;
     limbs2 = (bits * len2 - 1) / FLINT_BITS + 1;
 
+    TMP_START;
+
     if (poly1 == poly2)
     {
-        arr1 = (mp_limb_t *) flint_calloc(limbs1, sizeof(mp_limb_t));
+        arr1 = (mp_limb_t *) TMP_ALLOC(limbs1*sizeof(mp_limb_t));
+        flint_mpn_zero(arr1, limbs1);
         arr2 = arr1;
         _fmpz_poly_bit_pack(arr1, poly1, len1, bits, neg1);
     }
     else
     {
-        arr1 = (mp_limb_t *) flint_calloc(limbs1 + limbs2, sizeof(mp_limb_t));
+        arr1 = (mp_limb_t *) TMP_ALLOC((limbs1 + limbs2)*sizeof(mp_limb_t));
+        flint_mpn_zero(arr1, limbs1 + limbs2);
         arr2 = arr1 + limbs1;
         _fmpz_poly_bit_pack(arr1, poly1, len1, bits, neg1);
         _fmpz_poly_bit_pack(arr2, poly2, len2, bits, neg2);
     }
 
-    arr3 = (mp_limb_t *) flint_malloc((limbs1 + limbs2) * sizeof(mp_limb_t));
+    arr3 = (mp_limb_t *) TMP_ALLOC((limbs1 + limbs2)*sizeof(mp_limb_t));
 
     if (limbs1 == limbs2)
     {
@@ -111,8 +117,7 @@ _fmpz_poly_mul_KS(fmpz * res, const fmpz * poly1, slong len1,
     if ((len1 < in1_len) | (len2 < in2_len))
         _fmpz_vec_zero(res + (len1 + len2 - 1), (in1_len - len1) + (in2_len - len2));
 
-    flint_free(arr1);
-    flint_free(arr3);
+    TMP_END;
 }
 
 void
@@ -0,0 +1,465 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "nmod_poly.h"
+#include "thread_support.h"
+
+/*
+    Primes p = c*2^48 + 1 with 2^61 < p < 2^62, the largest such primes in
+    decreasing order. Each of them supports the transforms of
+    nmod_poly_ntt_init_prime up to length 2^48.
+*/
+#define MULTI_MOD_MAX_DEPTH 48
+
+static const mp_limb_t fmpz_poly_multi_mod_primes[FMPZ_POLY_MULTI_MOD_NUM_PRIMES] =
+{
+    UWORD(0x3fdc000000000001), UWORD(0x3fc6000000000001), UWORD(0x3fa3000000000001),
+    UWORD(0x3f9a000000000001), UWORD(0x3f82000000000001), UWORD(0x3f18000000000001),
+    UWORD(0x3f16000000000001), UWORD(0x3f03000000000001), UWORD(0x3ee6000000000001),
+    UWORD(0x3ec4000000000001), UWORD(0x3ea0000000000001), UWORD(0x3e95000000000001),
+    UWORD(0x3e86000000000001), UWORD(0x3e74000000000001), UWORD(0x3e62000000000001),
+    UWORD(0x3e5f000000000001), UWORD(0x3e56000000000001), UWORD(0x3e4c000000000001),
+    UWORD(0x3e46000000000001), UWORD(0x3e32000000000001), UWORD(0x3e2e000000000001),
+    UWORD(0x3e2c000000000001), UWORD(0x3e10000000000001), UWORD(0x3e0e000000000001),
+    UWORD(0x3dce000000000001), UWORD(0x3d89000000000001), UWORD(0x3d11000000000001),
+    UWORD(0x3d05000000000001), UWORD(0x3cff000000000001), UWORD(0x3cfa000000000001),
+    UWORD(0x3cf1000000000001), UWORD(0x3cee000000000001), UWORD(0x3ce7000000000001),
+    UWORD(0x3cde000000000001), UWORD(0x3cd9000000000001), UWORD(0x3cd8000000000001),
+    UWORD(0x3ccd000000000001), UWORD(0x3cb4000000000001), UWORD(0x3c7f000000000001),
+    UWORD(0x3c55000000000001), UWORD(0x3c4e000000000001), UWORD(0x3c4c000000000001),
+    UWORD(0x3c33000000000001), UWORD(0x3c2d000000000001), UWORD(0x3c1c000000000001),
+    UWORD(0x3c1b000000000001), UWORD(0x3c15000000000001), UWORD(0x3c0d000000000001),
+    UWORD(0x3be9000000000001), UWORD(0x3be3000000000001), UWORD(0x3bc2000000000001),
+    UWORD(0x3b9e000000000001), UWORD(0x3b8f000000000001), UWORD(0x3b58000000000001),
+    UWORD(0x3b43000000000001), UWORD(0x3b2f000000000001), UWORD(0x3b29000000000001),
+    UWORD(0x3b0b000000000001), UWORD(0x3aff000000000001), UWORD(0x3afc000000000001),
+    UWORD(0x3af2000000000001), UWORD(0x3aea000000000001), UWORD(0x3ae0000000000001),
+    UWORD(0x3adb000000000001), UWORD(0x3ac5000000000001), UWORD(0x3aaa000000000001),
+    UWORD(0x3aa8000000000001), UWORD(0x3a90000000000001), UWORD(0x3a89000000000001),
+    UWORD(0x3a5f000000000001), UWORD(0x3a32000000000001), UWORD(0x3a18000000000001),
+    UWORD(0x3a00000000000001), UWORD(0x39f4000000000001), UWORD(0x39d8000000000001),
+    UWORD(0x39cc000000000001), UWORD(0x39be000000000001), UWORD(0x39a5000000000001),
+    UWORD(0x3994000000000001), UWORD(0x398b000000000001), UWORD(0x3978000000000001),
+    UWORD(0x3976000000000001), UWORD(0x3969000000000001), UWORD(0x3960000000000001),
+    UWORD(0x3955000000000001), UWORD(0x3946000000000001), UWORD(0x3921000000000001),
+    UWORD(0x3918000000000001), UWORD(0x390f000000000001), UWORD(0x38f1000000000001),
+    UWORD(0x38e2000000000001), UWORD(0x38dc000000000001), UWORD(0x389b000000000001),
+    UWORD(0x3895000000000001), UWORD(0x385e000000000001), UWORD(0x382e000000000001),
+    UWORD(0x3823000000000001), UWORD(0x3820000000000001), UWORD(0x3810000000000001),
+    UWORD(0x37f0000000000001), UWORD(0x37e7000000000001), UWORD(0x37c5000000000001),
+    UWORD(0x37bc000000000001), UWORD(0x37a8000000000001), UWORD(0x3792000000000001),
+    UWORD(0x372f000000000001), UWORD(0x372a000000000001), UWORD(0x36df000000000001),
+    UWORD(0x36cc000000000001), UWORD(0x36bb000000000001), UWORD(0x36b2000000000001),
+    UWORD(0x36a9000000000001), UWORD(0x369d000000000001), UWORD(0x3697000000000001),
+    UWORD(0x365e000000000001), UWORD(0x3652000000000001), UWORD(0x3633000000000001),
+    UWORD(0x3630000000000001), UWORD(0x360c000000000001), UWORD(0x35cb000000000001),
+    UWORD(0x35c7000000000001), UWORD(0x35b6000000000001), UWORD(0x358b000000000001),
+    UWORD(0x3564000000000001), UWORD(0x3553000000000001), UWORD(0x3508000000000001),
+    UWORD(0x34ea000000000001), UWORD(0x34d2000000000001), UWORD(0x34a4000000000001),
+    UWORD(0x3496000000000001), UWORD(0x348f000000000001), UWORD(0x346f000000000001),
+    UWORD(0x3460000000000001), UWORD(0x344a000000000001), UWORD(0x3441000000000001),
+    UWORD(0x3427000000000001), UWORD(0x33f1000000000001), UWORD(0x33db000000000001),
+    UWORD(0x33cf000000000001), UWORD(0x33cd000000000001), UWORD(0x33c4000000000001),
+    UWORD(0x339a000000000001), UWORD(0x337e000000000001), UWORD(0x3379000000000001),
+    UWORD(0x332a000000000001), UWORD(0x3325000000000001), UWORD(0x3318000000000001),
+    UWORD(0x32d9000000000001), UWORD(0x32b2000000000001), UWORD(0x32af000000000001),
+    UWORD(0x329d000000000001), UWORD(0x3247000000000001), UWORD(0x3214000000000001),
+    UWORD(0x31f3000000000001), UWORD(0x31a1000000000001), UWORD(0x318a000000000001),
+    UWORD(0x317e000000000001), UWORD(0x3159000000000001), UWORD(0x3147000000000001),
+    UWORD(0x3117000000000001), UWORD(0x30fc000000000001), UWORD(0x30ee000000000001),
+    UWORD(0x30eb000000000001), UWORD(0x30db000000000001), UWORD(0x30d6000000000001),
+    UWORD(0x30b7000000000001), UWORD(0x30a3000000000001), UWORD(0x309a000000000001),
+    UWORD(0x3099000000000001), UWORD(0x3091000000000001), UWORD(0x3078000000000001),
+    UWORD(0x3055000000000001), UWORD(0x304f000000000001), UWORD(0x304e000000000001),
+    UWORD(0x3036000000000001), UWORD(0x3022000000000001), UWORD(0x2fdd000000000001),
+    UWORD(0x2fd0000000000001), UWORD(0x2fc7000000000001), UWORD(0x2f73000000000001),
+    UWORD(0x2f4a000000000001), UWORD(0x2f49000000000001), UWORD(0x2f28000000000001),
+    UWORD(0x2f19000000000001), UWORD(0x2f04000000000001), UWORD(0x2ef6000000000001),
+    UWORD(0x2eea000000000001), UWORD(0x2ee6000000000001), UWORD(0x2ee3000000000001),
+    UWORD(0x2ee0000000000001), UWORD(0x2ed8000000000001), UWORD(0x2ed4000000000001),
+    UWORD(0x2eb9000000000001), UWORD(0x2eb6000000000001), UWORD(0x2e98000000000001),
+    UWORD(0x2e93000000000001), UWORD(0x2e8d000000000001), UWORD(0x2e87000000000001),
+    UWORD(0x2e68000000000001), UWORD(0x2e2f000000000001), UWORD(0x2e2a000000000001),
+    UWORD(0x2e1e000000000001), UWORD(0x2dfa000000000001), UWORD(0x2dd9000000000001),
+    UWORD(0x2dc3000000000001), UWORD(0x2da8000000000001), UWORD(0x2d8e000000000001),
+    UWORD(0x2d7b000000000001), UWORD(0x2d79000000000001), UWORD(0x2d70000000000001),
+    UWORD(0x2d66000000000001), UWORD(0x2d5b000000000001), UWORD(0x2d34000000000001),
+    UWORD(0x2d2a000000000001), UWORD(0x2d21000000000001), UWORD(0x2d1c000000000001),
+    UWORD(0x2cd4000000000001), UWORD(0x2cd1000000000001), UWORD(0x2cbf000000000001),
+    UWORD(0x2ca9000000000001), UWORD(0x2c92000000000001), UWORD(0x2c8f000000000001),
+    UWORD(0x2c71000000000001), UWORD(0x2c65000000000001), UWORD(0x2c40000000000001),
+    UWORD(0x2c26000000000001), UWORD(0x2c1c000000000001), UWORD(0x2c0d000000000001),
+    UWORD(0x2be0000000000001), UWORD(0x2bda000000000001), UWORD(0x2bd7000000000001),
+    UWORD(0x2ba5000000000001), UWORD(0x2b6e000000000001), UWORD(0x2b5f000000000001),
+    UWORD(0x2b5a000000000001), UWORD(0x2b14000000000001), UWORD(0x2aaf000000000001),
+    UWORD(0x2aab000000000001), UWORD(0x2aa5000000000001), UWORD(0x2aa3000000000001),
+    UWORD(0x2a94000000000001), UWORD(0x2a88000000000001), UWORD(0x2a31000000000001),
+    UWORD(0x2a28000000000001), UWORD(0x2a1f000000000001), UWORD(0x2a1e000000000001),
+    UWORD(0x2a12000000000001), UWORD(0x2a09000000000001), UWORD(0x29f5000000000001),
+    UWORD(0x29b6000000000001), UWORD(0x299b000000000001), UWORD(0x2995000000000001),
+    UWORD(0x296e000000000001), UWORD(0x292f000000000001), UWORD(0x291d000000000001),
+    UWORD(0x2913000000000001)
+};
+
+/*
+    The coefficients are reduced as the dot products of their limbs with
+    the powers 2^(FLINT_BITS*k) modulo each prime. The product is recovered
+    from its residues r_j as the sum of u_j (M / p_j) reduced modulo M,
+    where M is the product of the primes and u_j = r_j (M / p_j)^(-1) modulo
+    p_j, so that the CRT costs one multiplication of a limb by an integer
+    of the size of M per prime and a single division.
+*/
+typedef struct
+{
+    const fmpz * poly1;
+    slong len1;
+    const fmpz * poly2;
+    slong len2;
+    fmpz * res;
+    mp_ptr * r1;      /* residues of poly1, then of the product */
+    mp_ptr * r2;      /* residues of poly2, NULL when squaring */
+    const mp_limb_t * primes;
+    slong num_primes;
+    flint_bitcnt_t depth;
+    nmod_t * mod;
+    mp_srcptr pow;    /* 2^(FLINT_BITS*k) mod p_j at pow[j*limbs + k] */
+    slong limbs;
+    mp_srcptr M;      /* product of the primes */
+    mp_srcptr Mj;     /* M / p_j at Mj[j*Mlimbs] */
+    slong Mlimbs;
+    mp_srcptr c;      /* (M / p_j)^(-1) mod p_j */
+    mp_srcptr cpre;
+    int sign;
+}
+_worker_arg;
+
+/* reduces coefficients start, ..., stop - 1 of poly1 followed by poly2 */
+static void
+_reduce_worker(slong start, slong stop, void * varg)
+{
+    _worker_arg * arg = (_worker_arg *) varg;
+    slong i, j, k, n, num_primes = arg->num_primes;
+    const mp_limb_t * primes = arg->primes;
+    const fmpz * c;
+    mp_ptr * r;
+
+    for (i = start; i < stop; i++)
+    {
+        if (i < arg->len1)
+        {
+            c = arg->poly1 + i;
+            r = arg->r1;
+            k = i;
+        }
+        else
+        {
+            c = arg->poly2 + i - arg->len1;
+            r = arg->r2;
+            k = i - arg->len1;
+        }
+
+        if (!COEFF_IS_MPZ(*c))
+        {
+            /* the transforms accept any word as input */
+            if (*c >= 0)
+            {
+                for (j = 0; j < num_primes; j++)
+                    r[j][k] = *c;
+            }
+            else
+            {
+                mp_limb_t u = -(*c);
+
+                for (j = 0; j < num_primes; j++)
+                    r[j][k] = primes[j] - (u - ((u >= primes[j]) ? primes[j] : 0));
+            }
+        }
+        else
+        {
+            __mpz_struct * z = COEFF_TO_PTR(*c);
+            mp_limb_t t;
+
+            n = FLINT_ABS(z->_mp_size);
+
+            for (j = 0; j < num_primes; j++)
+            {
+                mp_srcptr d = z->_mp_d, w = arg->pow + j*arg->limbs;
+                mp_limb_t s2 = 0, s1 = 0, s0 = 0, hi, lo;
+                slong l;
+
+                for (l = 0; l < n; l++)
+                {
+                    umul_ppmm(hi, lo, d[l], w[l]);
+                    add_sssaaaaaa(s2, s1, s0, s2, s1, s0, 0, hi, lo);
+                }
+
+                NMOD_RED3(t, s2, s1, s0, arg->mod[j]);
+
+                if (z->_mp_size < 0 && t != 0)
+                    t = primes[j] - t;
+
+                r[j][k] = t;
+            }
+        }
+    }
+}
+
+/* multiplies modulo primes start, ..., stop - 1 */
+static void
+_prime_worker(slong start, slong stop, void * varg)
+{
+    _worker_arg * arg = (_worker_arg *) varg;
+    slong j;
+    mp_ptr t;
+    nmod_poly_ntt_t F;
+
+    t = FLINT_ARRAY_ALLOC(WORD(1) << arg->depth, mp_limb_t);
+
+    for (j = start; j < stop; j++)
+    {
+        nmod_poly_ntt_init_prime(F, arg->primes[j], arg->depth);
+
+        if (arg->r2 == NULL)
+            _nmod_poly_ntt_mul(arg->r1[j], arg->r1[j], arg->len1,
+                               arg->r1[j], arg->len1, t, arg->depth, F);
+        else
+            _nmod_poly_ntt_mul(arg->r1[j], arg->r1[j], arg->len1,
+                               arg->r2[j], arg->len2, t, arg->depth, F);
+
+        nmod_poly_ntt_clear(F);
+    }
+
+    flint_free(t);
+}
+
+/* reconstructs coefficients start, ..., stop - 1 of the product */
+static void
+_crt_worker(slong start, slong stop, void * varg)
+{
+    _worker_arg * arg = (_worker_arg *) varg;
+    slong i, j, n, num_primes = arg->num_primes, Mlimbs = arg->Mlimbs;
+    mp_ptr s, q, t;
+    mp_limb_t u;
+    int neg;
+
+    s = FLINT_ARRAY_ALLOC(3*Mlimbs + 3, mp_limb_t);
+    q = s + Mlimbs + 1;
+    t = q + 2;
+
+    for (i = start; i < stop; i++)
+    {
+        flint_mpn_zero(s, Mlimbs + 1);
+
+        for (j = 0; j < num_primes; j++)
+        {
+            u = n_mulmod_shoup(arg->c[j], arg->r1[j][i], arg->cpre[j],
+                                                              arg->primes[j]);
+            s[Mlimbs] += mpn_addmul_1(s, arg->Mj + j*Mlimbs, Mlimbs, u);
+        }
+
+        /* the sum is less than num_primes*M */
+        mpn_tdiv_qr(q, t, 0, s, Mlimbs + 1, arg->M, Mlimbs);
+
+        neg = 0;
+        if (arg->sign)
+        {
+            mpn_sub_n(s, arg->M, t, Mlimbs);
+
+            if (mpn_cmp(t, s, Mlimbs) > 0)
+            {
+                flint_mpn_copyi(t, s, Mlimbs);
+                neg = 1;
+            }
+        }
+
+        n = Mlimbs;
+        while (n > 0 && t[n - 1] == 0)
+            n--;
+
+        _fmpz_set_mpn(arg->res + i, t, n, neg);
+    }
+
+    flint_free(s);
+}
+
+void
+_fmpz_poly_mul_multi_mod(fmpz * res, const fmpz * poly1, slong len1,
+                                     const fmpz * poly2, slong len2)
+{
+    slong bits1, bits2, j, k, num_primes, rlen, limit, Mlimbs;
+    flint_bitcnt_t bits, depth;
+    int sqr = (poly1 == poly2 && len1 == len2);
+    mp_ptr pow, M, Mj, c, cpre;
+    _worker_arg arg;
+
+    rlen = len1 + len2 - 1;
+
+    bits1 = _fmpz_vec_max_bits(poly1, len1);
+    bits2 = sqr ? bits1 : _fmpz_vec_max_bits(poly2, len2);
+
+    if (bits1 == 0 || bits2 == 0)
+    {
+        _fmpz_vec_zero(res, rlen);
+        return;
+    }
+
+    arg.sign = (bits1 < 0 || bits2 < 0);
+    bits1 = FLINT_ABS(bits1);
+    bits2 = FLINT_ABS(bits2);
+    bits = bits1 + bits2 + FLINT_BIT_COUNT(FLINT_MIN(len1, len2)) + arg.sign;
+    num_primes = (bits + NMOD_POLY_NTT_PRIME_BITS - 1)
+                                                  / NMOD_POLY_NTT_PRIME_BITS;
+    depth = FLINT_CLOG2(rlen);
+
+    if (num_primes > FMPZ_POLY_MULTI_MOD_NUM_PRIMES
+                                             || depth > MULTI_MOD_MAX_DEPTH)
+    {
+        _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
+        return;
+    }
+
+    arg.poly1 = poly1;
+    arg.len1 = len1;
+    arg.poly2 = poly2;
+    arg.len2 = len2;
+    arg.res = res;
+    arg.primes = fmpz_poly_multi_mod_primes;
+    arg.num_primes = num_primes;
+    arg.depth = depth;
+    arg.limbs = (FLINT_MAX(bits1, bits2) + FLINT_BITS - 1) / FLINT_BITS;
+
+    /* precomputations for reduction and CRT */
+    arg.mod = FLINT_ARRAY_ALLOC(num_primes, nmod_t);
+    pow = FLINT_ARRAY_ALLOC(num_primes*arg.limbs, mp_limb_t);
+
+    for (j = 0; j < num_primes; j++)
+    {
+        mp_limb_t b;
+
+        nmod_init(arg.mod + j, arg.primes[j]);
+        b = n_ll_mod_preinv(UWORD(1), UWORD(0), arg.primes[j],
+                                                          arg.mod[j].ninv);
+        pow[j*arg.limbs] = 1;
+        for (k = 1; k < arg.limbs; k++)
+            pow[j*arg.limbs + k] = nmod_mul(pow[j*arg.limbs + k - 1], b,
+                                                                  arg.mod[j]);
+    }
+
+    M = FLINT_ARRAY_ALLOC(num_primes + 1, mp_limb_t);
+    M[0] = arg.primes[0];
+    Mlimbs = 1;
+    for (j = 1; j < num_primes; j++)
+    {
+        M[Mlimbs] = mpn_mul_1(M, M, Mlimbs, arg.primes[j]);
+        Mlimbs += (M[Mlimbs] != 0);
+    }
+
+    Mj = FLINT_ARRAY_ALLOC(num_primes*Mlimbs, mp_limb_t);
+    c = FLINT_ARRAY_ALLOC(2*num_primes, mp_limb_t);
+    cpre = c + num_primes;
+
+    for (j = 0; j < num_primes; j++)
+    {
+        mpn_divrem_1(Mj + j*Mlimbs, 0, M, Mlimbs, arg.primes[j]);
+        c[j] = n_invmod(mpn_mod_1(Mj + j*Mlimbs, Mlimbs, arg.primes[j]),
+                                                              arg.primes[j]);
+        cpre[j] = n_mulmod_precomp_shoup(c[j], arg.primes[j]);
+    }
+
+    arg.pow = pow;
+    arg.M = M;
+    arg.Mj = Mj;
+    arg.Mlimbs = Mlimbs;
+    arg.c = c;
+    arg.cpre = cpre;
+
+    arg.r1 = FLINT_ARRAY_ALLOC(num_primes, mp_ptr);
+    for (j = 0; j < num_primes; j++)
+        arg.r1[j] = FLINT_ARRAY_ALLOC(WORD(1) << depth, mp_limb_t);
+
+    if (sqr)
+    {
+        arg.r2 = NULL;
+    }
+    else
+    {
+        arg.r2 = FLINT_ARRAY_ALLOC(num_primes, mp_ptr);
+        for (j = 0; j < num_primes; j++)
+            arg.r2[j] = FLINT_ARRAY_ALLOC(len2, mp_limb_t);
+    }
+
+    limit = flint_get_num_threads();
+
+    flint_parallel_for(0, sqr ? len1 : len1 + len2, 0, _reduce_worker,
+                                                                &arg, limit);
+
+    flint_parallel_for(0, num_primes, 1, _prime_worker, &arg,
+                                             FLINT_MIN(limit, num_primes));
+
+    flint_parallel_for(0, rlen, 0, _crt_worker, &arg, limit);
+
+    for (j = 0; j < num_primes; j++)
+        flint_free(arg.r1[j]);
+    flint_free(arg.r1);
+
+    if (!sqr)
+    {
+        for (j = 0; j < num_primes; j++)
+            flint_free(arg.r2[j]);
+        flint_free(arg.r2);
+    }
+
+    flint_free(arg.mod);
+    flint_free(pow);
+    flint_free(M);
+    flint_free(Mj);
+    flint_free(c);
+}
+
+void
+fmpz_poly_mul_multi_mod(fmpz_poly_t res,
+                        const fmpz_poly_t poly1, const fmpz_poly_t poly2)
+{
+    const slong len1 = poly1->length, len2 = poly2->length;
+    slong rlen;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    rlen = len1 + len2 - 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, rlen);
+        fmpz_poly_mul_multi_mod(t, poly1, poly2);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+        return;
+    }
+
+    fmpz_poly_fit_length(res, rlen);
+    if (len1 >= len2)
+        _fmpz_poly_mul_multi_mod(res->coeffs, poly1->coeffs, len1,
+                                              poly2->coeffs, len2);
+    else
+        _fmpz_poly_mul_multi_mod(res->coeffs, poly2->coeffs, len2,
+                                              poly1->coeffs, len1);
+    _fmpz_poly_set_length(res, rlen);
+}
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2010 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -27,6 +28,7 @@ _fmpz_poly_mullow_KS(fmpz * res, const fmpz * poly1, slong len1,
     slong bits1, bits2, bits;
     mp_limb_t *arr1, *arr2, *arr3;
     slong sign = 0;
+    TMP_INIT;
 
     len1 = FLINT_MIN(len1, n);
     len2 = FLINT_MIN(len2, n);
@@ -74,21 +76,25 @@ _fmpz_poly_mullow_KS(fmpz * res, const fmpz * poly1, slong len1,
     limbs1 = (bits * len1 - 1) / FLINT_BITS + 1;
     limbs2 = (bits * len2 - 1) / FLINT_BITS + 1;
 
+    TMP_START;
+
     if (poly1 == poly2)
     {
-        arr1 = (mp_ptr) flint_calloc(limbs1, sizeof(mp_limb_t));
+        arr1 = (mp_ptr) TMP_ALLOC(limbs1*sizeof(mp_limb_t));
+        flint_mpn_zero(arr1, limbs1);
         arr2 = arr1;
         _fmpz_poly_bit_pack(arr1, poly1, len1, bits, neg1);
     }
     else
     {
-        arr1 = (mp_ptr) flint_calloc(limbs1 + limbs2, sizeof(mp_limb_t));
+        arr1 = (mp_ptr) TMP_ALLOC((limbs1 + limbs2)*sizeof(mp_limb_t));
+        flint_mpn_zero(arr1, limbs1 + limbs2);
         arr2 = arr1 + limbs1;
         _fmpz_poly_bit_pack(arr1, poly1, len1, bits, neg1);
         _fmpz_poly_bit_pack(arr2, poly2, len2, bits, neg2);
     }
 
-    arr3 = (mp_ptr) flint_malloc((limbs1 + limbs2) * sizeof(mp_limb_t));
+    arr3 = (mp_ptr) TMP_ALLOC((limbs1 + limbs2)*sizeof(mp_limb_t));
 
     if (limbs1 == limbs2)
     {
@@ -115,8 +121,7 @@ _fmpz_poly_mullow_KS(fmpz * res, const fmpz * poly1, slong len1,
     else
         _fmpz_poly_bit_unpack_unsigned(res, n, arr3, bits);
 
-    flint_free(arr1);
-    flint_free(arr3);
+    TMP_END;
 }
 
 void
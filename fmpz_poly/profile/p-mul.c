@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -66,6 +67,86 @@ int write_rgb_ppm(const char* file_name, unsigned char* pixels,
     return 0;
 }
 
+/*
+   Compares mul_KS, mul_SS and mul_multi_mod on long polynomials with
+   coefficients of 64 to 2048 bits, for 1, 2 and 4 threads. Times are wall
+   times in ms.
+ */
+void
+profile_multi_mod(flint_rand_t state)
+{
+    slong len, bits, threads, k;
+    fmpz_poly_t f, g, h;
+
+    fmpz_poly_init(f);
+    fmpz_poly_init(g);
+    fmpz_poly_init(h);
+
+    flint_printf("\n%6s %6s %7s %10s %10s %10s\n",
+                 "len", "bits", "threads", "KS", "SS", "multi_mod");
+
+    for (len = 256; len <= 16384; len *= 4)
+    {
+        for (bits = 64; bits <= 2048; bits *= 2)
+        {
+            fmpz_poly_fit_length(f, len);
+            fmpz_poly_fit_length(g, len);
+            for (k = 0; k < len; k++)
+            {
+                fmpz_randbits(f->coeffs + k, state, bits);
+                fmpz_randbits(g->coeffs + k, state, bits);
+            }
+            _fmpz_poly_set_length(f, len);
+            _fmpz_poly_set_length(g, len);
+            _fmpz_poly_normalise(f);
+            _fmpz_poly_normalise(g);
+
+            for (threads = 1; threads <= 4; threads *= 2)
+            {
+                timeit_t t[3];
+                slong l, loops = 1;
+
+                flint_set_num_threads(threads);
+
+              loop2:
+
+                timeit_start(t[0]);
+                for (l = 0; l < loops; l++)
+                    fmpz_poly_mul_KS(h, f, g);
+                timeit_stop(t[0]);
+
+                timeit_start(t[1]);
+                for (l = 0; l < loops; l++)
+                    fmpz_poly_mul_SS(h, f, g);
+                timeit_stop(t[1]);
+
+                timeit_start(t[2]);
+                for (l = 0; l < loops; l++)
+                    fmpz_poly_mul_multi_mod(h, f, g);
+                timeit_stop(t[2]);
+
+                if (t[0]->wall + t[1]->wall + t[2]->wall <= 3*cpumin)
+                {
+                    loops *= 10;
+                    goto loop2;
+                }
+
+                flint_printf("%6wd %6wd %7wd %10.3f %10.3f %10.3f\n",
+                             len, bits, threads,
+                             t[0]->wall / (double) loops,
+                             t[1]->wall / (double) loops,
+                             t[2]->wall / (double) loops);
+            }
+        }
+    }
+
+    flint_set_num_threads(1);
+
+    fmpz_poly_clear(f);
+    fmpz_poly_clear(g);
+    fmpz_poly_clear(h);
+}
+
 int
 main(void)
 {
@@ -217,5 +298,7 @@ main(void)
         }
     }
 
+    profile_multi_mod(state);
+
     flint_randclear(state);
 }
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -139,6 +140,8 @@ void _fmpz_poly_sqr(fmpz * res, const fmpz * poly, slong len)
 
     if (len < 16 && limbs > 12)
         _fmpz_poly_sqr_karatsuba(res, poly, len);
+    else if (_fmpz_poly_mul_multi_mod_use(len, 2*bits))
+        _fmpz_poly_mul_multi_mod(res, poly, len, poly, len);
     else if (limbs <= 4)
         _fmpz_poly_sqr_KS(res, poly, len);
     else if (limbs/2048 > len)
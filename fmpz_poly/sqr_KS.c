@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2010, 2011 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -25,6 +26,7 @@ _fmpz_poly_sqr_KS(fmpz *rop, const fmpz *op, slong len)
     slong bits, limbs, loglen;
     mp_limb_t *arr, *arr3;
     slong sign = 0;
+    TMP_INIT;
 
     FMPZ_VEC_NORM(op, len);
 
@@ -48,11 +50,14 @@ _fmpz_poly_sqr_KS(fmpz *rop, const fmpz *op, slong len)
     bits   = 2 * bits + loglen + sign;
     limbs  = (bits * len - 1) / FLINT_BITS + 1;
 
-    arr = (mp_limb_t *) flint_calloc(limbs, sizeof(mp_limb_t));
+    TMP_START;
+
+    arr = (mp_limb_t *) TMP_ALLOC(limbs*sizeof(mp_limb_t));
+    flint_mpn_zero(arr, limbs);
 
     _fmpz_poly_bit_pack(arr, op, len, bits, neg);
 
-    arr3 = (mp_limb_t *) flint_malloc((2 * limbs) * sizeof(mp_limb_t));
+    arr3 = (mp_limb_t *) TMP_ALLOC((2 * limbs)*sizeof(mp_limb_t));
 
     mpn_sqr(arr3, arr, limbs);
 
@@ -64,8 +69,7 @@ _fmpz_poly_sqr_KS(fmpz *rop, const fmpz *op, slong len)
     if (len < in_len)
         _fmpz_vec_zero(rop + (2 * len - 1), 2 * (in_len - len));
 
-    flint_free(arr);
-    flint_free(arr3);
+    TMP_END;
 }
 
 void fmpz_poly_sqr_KS(fmpz_poly_t rop, const fmpz_poly_t op)
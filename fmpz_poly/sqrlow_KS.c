@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2010, 2011 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -22,6 +23,7 @@ void _fmpz_poly_sqrlow_KS(fmpz * res, const fmpz * poly, slong len, slong n)
     int neg;
     slong bits, limbs, loglen, sign = 0;
     mp_limb_t *arr_in, *arr_out;
+    TMP_INIT;
 
     len = FLINT_MIN(len, n);
 
@@ -52,8 +54,11 @@ void _fmpz_poly_sqrlow_KS(fmpz * res, const fmpz * poly, slong len, slong n)
     bits   = 2 * bits + loglen + sign;
     limbs  = (bits * len - 1) / FLINT_BITS + 1;
 
-    arr_in  = flint_calloc(limbs, sizeof(mp_limb_t));
-    arr_out = flint_malloc((2 * limbs) * sizeof(mp_limb_t));
+    TMP_START;
+
+    arr_in  = TMP_ALLOC(limbs*sizeof(mp_limb_t));
+    arr_out = TMP_ALLOC((2 * limbs)*sizeof(mp_limb_t));
+    flint_mpn_zero(arr_in, limbs);
 
     _fmpz_poly_bit_pack(arr_in, poly, len, bits, neg);
 
@@ -64,8 +69,7 @@ void _fmpz_poly_sqrlow_KS(fmpz * res, const fmpz * poly, slong len, slong n)
     else
         _fmpz_poly_bit_unpack_unsigned(res, n, arr_out, bits);
 
-    flint_free(arr_in);
-    flint_free(arr_out);
+    TMP_END;
 }
 
 void fmpz_poly_sqrlow_KS(fmpz_poly_t res, const fmpz_poly_t poly, slong n)
@@ -0,0 +1,181 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_multi_mod....");
+    fflush(stdout);
+
+    /* Check aliasing of a and b */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_randtest(b, state, n_randint(state, 50), 200);
+        fmpz_poly_randtest(c, state, n_randint(state, 50), 200);
+
+        fmpz_poly_mul_multi_mod(a, b, c);
+        fmpz_poly_mul_multi_mod(b, b, c);
+
+        result = (fmpz_poly_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing a and b):\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+    }
+
+    /* Check aliasing of b and c */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_randtest(b, state, n_randint(state, 50), 200);
+        fmpz_poly_set(c, b);
+
+        fmpz_poly_mul_multi_mod(a, b, b);
+        fmpz_poly_mul_multi_mod(c, b, c);
+
+        result = (fmpz_poly_equal(a, c));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing b and c):\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(c), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+    }
+
+    /* Compare with mul_KS, signed and unsigned, with threads */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        slong bits = n_randint(state, 3) == 0 ? 3000 : 300;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+
+        if (n_randint(state, 2))
+        {
+            fmpz_poly_randtest(b, state, n_randint(state, 300),
+                                                n_randint(state, bits) + 1);
+            fmpz_poly_randtest(c, state, n_randint(state, 300),
+                                                n_randint(state, bits) + 1);
+        }
+        else
+        {
+            fmpz_poly_randtest_unsigned(b, state, n_randint(state, 300),
+                                                n_randint(state, bits) + 1);
+            fmpz_poly_randtest_unsigned(c, state, n_randint(state, 300),
+                                                n_randint(state, bits) + 1);
+        }
+
+        if (n_randint(state, 4) == 0)
+            fmpz_poly_set(c, b);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_poly_mul_multi_mod(a, b, c);
+        fmpz_poly_mul_KS(d, b, c);
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL (comparison with mul_KS):\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    /* Check that the sign is recovered for coefficients close to the bound */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        slong j, len = n_randint(state, 20) + 1;
+        flint_bitcnt_t bits = n_randint(state, 400) + 1;
+
+        fmpz_poly_init2(b, len);
+        fmpz_poly_init2(c, len);
+        fmpz_poly_init(a);
+        fmpz_poly_init(d);
+
+        for (j = 0; j < len; j++)
+        {
+            fmpz_one(b->coeffs + j);
+            fmpz_mul_2exp(b->coeffs + j, b->coeffs + j, bits);
+            fmpz_sub_ui(b->coeffs + j, b->coeffs + j, 1);
+            fmpz_set(c->coeffs + j, b->coeffs + j);
+
+            if (n_randint(state, 2))
+                fmpz_neg(c->coeffs + j, c->coeffs + j);
+        }
+
+        _fmpz_poly_set_length(b, len);
+        _fmpz_poly_set_length(c, len);
+
+        fmpz_poly_mul_multi_mod(a, b, c);
+        fmpz_poly_mul_classical(d, b, c);
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL (extreme coefficients):\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
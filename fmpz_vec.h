@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010 William Hart
     Copyright (C) 2010 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -71,6 +72,8 @@ FLINT_DLL void _fmpz_vec_sum_max_bits(slong * sumabs, slong * maxabs,
 
 FLINT_DLL mp_size_t _fmpz_vec_max_limbs(const fmpz * vec, slong len);
 
+FLINT_DLL flint_bitcnt_t _fmpz_vec_small_bits(const fmpz * vec, slong len);
+
 FLINT_DLL void _fmpz_vec_height(fmpz_t height, const fmpz * vec, slong len);
 
 FLINT_DLL slong _fmpz_vec_height_index(const fmpz * vec, slong len);
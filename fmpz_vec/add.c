@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -18,6 +19,15 @@ void
 _fmpz_vec_add(fmpz * res, const fmpz * vec1, const fmpz * vec2, slong len2)
 {
     slong i;
+
     for (i = 0; i < len2; i++)
-        fmpz_add(res + i, vec1 + i, vec2 + i);
+    {
+        fmpz c1 = vec1[i], c2 = vec2[i];
+
+        /* small operands cannot overflow a word */
+        if (!COEFF_IS_MPZ(c1) && !COEFF_IS_MPZ(c2))
+            fmpz_set_si(res + i, c1 + c2);
+        else
+            fmpz_add(res + i, vec1 + i, vec2 + i);
+    }
 }
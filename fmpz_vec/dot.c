@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2010 Fredrik Johansson
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -12,11 +13,170 @@
 */
 
 #include "fmpz_vec.h"
+#include "longlong.h"
+#include "mpn_extras.h"
+
+/* all entries small, the dot product has at most bits bits */
+static void
+_fmpz_vec_dot_small(fmpz_t res, const fmpz * vec1, const fmpz * vec2,
+                                                slong len, flint_bitcnt_t bits)
+{
+    slong i;
+
+    if (bits < FLINT_BITS - 1)
+    {
+        ulong s = 0;
+
+        for (i = 0; i < len; i++)
+            s += ((ulong) vec1[i]) * ((ulong) vec2[i]);
+
+        fmpz_set_si(res, (slong) s);
+    }
+    else if (bits < 2*FLINT_BITS - 1)
+    {
+        mp_limb_t s1 = 0, s0 = 0, p1, p0;
+
+        for (i = 0; i < len; i++)
+        {
+            smul_ppmm(p1, p0, vec1[i], vec2[i]);
+            add_ssaaaa(s1, s0, s1, s0, p1, p0);
+        }
+
+        fmpz_set_signed_uiui(res, s1, s0);
+    }
+    else
+    {
+        mp_limb_t s2 = 0, s1 = 0, s0 = 0, p1, p0;
+
+        for (i = 0; i < len; i++)
+        {
+            smul_ppmm(p1, p0, vec1[i], vec2[i]);
+            add_sssaaaaaa(s2, s1, s0, s2, s1, s0, FLINT_SIGN_EXT(p1), p1, p0);
+        }
+
+        fmpz_set_signed_uiuiui(res, s2, s1, s0);
+    }
+}
+
+/*
+   Entries of at most n1 and n2 limbs. Positive and negative products are
+   summed separately into n = n1 + n2 + 1 limbs, which cannot overflow.
+*/
+static void
+_fmpz_vec_dot_mpn(fmpz_t res, const fmpz * vec1, const fmpz * vec2,
+                                         slong len, mp_size_t n1, mp_size_t n2)
+{
+    mp_limb_t pos[FMPZ_MPN_INLINE_LIMBS + 1], neg[FMPZ_MPN_INLINE_LIMBS + 1];
+    mp_limb_t t[FMPZ_MPN_INLINE_LIMBS];
+    mp_limb_t a0, b0;
+    mp_srcptr a, b;
+    mp_size_t an, bn, tn, n = n1 + n2 + 1;
+    slong i;
+    int sa, sb;
+
+    flint_mpn_zero(pos, n);
+    flint_mpn_zero(neg, n);
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz c1 = vec1[i], c2 = vec2[i];
+
+        if (c1 == 0 || c2 == 0)
+            continue;
+
+        if (!COEFF_IS_MPZ(c1))
+        {
+            a0 = FLINT_ABS(c1);
+            a = &a0;
+            an = 1;
+            sa = (c1 < 0);
+        }
+        else
+        {
+            __mpz_struct * z = COEFF_TO_PTR(c1);
+            a = z->_mp_d;
+            an = FLINT_ABS(z->_mp_size);
+            sa = (z->_mp_size < 0);
+        }
+
+        if (!COEFF_IS_MPZ(c2))
+        {
+            b0 = FLINT_ABS(c2);
+            b = &b0;
+            bn = 1;
+            sb = (c2 < 0);
+        }
+        else
+        {
+            __mpz_struct * z = COEFF_TO_PTR(c2);
+            b = z->_mp_d;
+            bn = FLINT_ABS(z->_mp_size);
+            sb = (z->_mp_size < 0);
+        }
+
+        if (an == 1 && bn == 1)
+            umul_ppmm(t[1], t[0], a[0], b[0]);
+        else if (bn == 1)
+            t[an] = mpn_mul_1(t, a, an, b[0]);
+        else if (an == 1)
+            t[bn] = mpn_mul_1(t, b, bn, a[0]);
+        else if (an >= bn)
+            mpn_mul(t, a, an, b, bn);
+        else
+            mpn_mul(t, b, bn, a, an);
+
+        tn = an + bn;
+        tn -= (t[tn - 1] == 0);
+
+        if (sa ^ sb)
+            mpn_add(neg, neg, n, t, tn);
+        else
+            mpn_add(pos, pos, n, t, tn);
+    }
+
+    if (mpn_cmp(pos, neg, n) >= 0)
+    {
+        mpn_sub_n(pos, pos, neg, n);
+        MPN_NORM(pos, n);
+        _fmpz_set_mpn(res, pos, n, 0);
+    }
+    else
+    {
+        mpn_sub_n(neg, neg, pos, n);
+        MPN_NORM(neg, n);
+        _fmpz_set_mpn(res, neg, n, 1);
+    }
+}
 
 void
 _fmpz_vec_dot(fmpz_t res, const fmpz * vec1, const fmpz * vec2, slong len2)
 {
-    slong i;
+    slong i, bits1, bits2;
+
+    bits1 = _fmpz_vec_small_bits(vec1, len2);
+    bits2 = _fmpz_vec_small_bits(vec2, len2);
+
+    if (bits1 < FLINT_BITS && bits2 < FLINT_BITS)
+    {
+        _fmpz_vec_dot_small(res, vec1, vec2, len2,
+                                      bits1 + bits2 + FLINT_BIT_COUNT(len2));
+        return;
+    }
+    else
+    {
+        mp_size_t n1, n2;
+
+        bits1 = FLINT_ABS(_fmpz_vec_max_bits(vec1, len2));
+        bits2 = FLINT_ABS(_fmpz_vec_max_bits(vec2, len2));
+        n1 = (bits1 + FLINT_BITS - 1) / FLINT_BITS;
+        n2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
+
+        if (n1 + n2 <= FMPZ_MPN_INLINE_LIMBS)
+        {
+            _fmpz_vec_dot_mpn(res, vec1, vec2, len2, n1, n2);
+            return;
+        }
+    }
 
     fmpz_zero(res);
     for (i = 0; i < len2; i++)
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -18,6 +19,21 @@ void
 _fmpz_vec_scalar_addmul_si(fmpz * vec1, const fmpz * vec2, slong len2, slong c)
 {
     slong i;
+    flint_bitcnt_t bits1, bits2;
+    ulong uc = (c >= 0) ? (ulong) c : -(ulong) c;
+
+    /* if every entry stays small the loop needs no dispatch */
+    bits2 = _fmpz_vec_small_bits(vec2, len2) + FLINT_BIT_COUNT(uc);
+    bits1 = (bits2 < FLINT_BITS - 2) ? _fmpz_vec_small_bits(vec1, len2)
+                                     : FLINT_BITS;
+
+    if (FLINT_MAX(bits1, bits2) < FLINT_BITS - 2)
+    {
+        for (i = 0; i < len2; i++)
+            vec1[i] += vec2[i] * c;
+
+        return;
+    }
 
     if (c >= 0)
         for (i = 0; i < len2; i++)
@@ -0,0 +1,34 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+flint_bitcnt_t
+_fmpz_vec_small_bits(const fmpz * vec, slong len)
+{
+    slong i;
+    mp_limb_t max_limb = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz c = vec[i];
+
+        if (COEFF_IS_MPZ(c))
+            return FLINT_BITS;
+
+        max_limb |= FLINT_ABS(c);
+    }
+
+    return FLINT_BIT_COUNT(max_limb);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014 Abhinav Baid
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -89,6 +90,65 @@ main(void)
         fmpz_clear(res2);
     }
 
+    /* Check against fmpz_addmul for each size class */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz *a, *b;
+        fmpz_t res1, res2;
+        slong j, len = n_randint(state, 100);
+        flint_bitcnt_t bits1, bits2;
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                bits1 = 1 + n_randint(state, 30);
+                bits2 = 1 + n_randint(state, 30);
+                break;
+            case 1:
+                bits1 = 1 + n_randint(state, FLINT_BITS - 2);
+                bits2 = 1 + n_randint(state, FLINT_BITS - 2);
+                break;
+            case 2:
+                bits1 = 1 + n_randint(state, 16*FLINT_BITS);
+                bits2 = 1 + n_randint(state, 16*FLINT_BITS);
+                break;
+            default:
+                bits1 = 1 + n_randint(state, 40*FLINT_BITS);
+                bits2 = 1 + n_randint(state, 40*FLINT_BITS);
+        }
+
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        _fmpz_vec_randtest(a, state, len, bits1);
+        _fmpz_vec_randtest(b, state, len, bits2);
+
+        fmpz_init(res1);
+        fmpz_init(res2);
+
+        fmpz_randtest(res1, state, 200);
+        _fmpz_vec_dot(res1, a, b, len);
+
+        for (j = 0; j < len; j++)
+            fmpz_addmul(res2, a + j, b + j);
+
+        result = fmpz_equal(res1, res2) && (!COEFF_IS_MPZ(*res1) ||
+                                        fmpz_bits(res1) > FLINT_BITS - 2);
+        if (!result)
+        {
+            flint_printf("FAIL (size classes):\n");
+            flint_printf("bits1 = %wu, bits2 = %wu, len = %wd\n",
+                                                       bits1, bits2, len);
+            fmpz_print(res1); flint_printf("\n");
+            fmpz_print(res2); flint_printf("\n");
+            abort();
+        }
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+        fmpz_clear(res1);
+        fmpz_clear(res2);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2009 William Hart
     Copyright (C) 2010 Sebastian Pancratz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -35,17 +36,20 @@ main(void)
     {
         fmpz *a, *b, *c, *d;
         slong len = n_randint(state, 100), x;
+        flint_bitcnt_t bits;
 
         a = _fmpz_vec_init(len);
         b = _fmpz_vec_init(len);
         c = _fmpz_vec_init(len);
         d = _fmpz_vec_init(len);
 
-        _fmpz_vec_randtest(a, state, len, 200);
-        _fmpz_vec_randtest(b, state, len, 200);
+        bits = n_randint(state, 2) ? 200 : 1 + n_randint(state, 40);
+        _fmpz_vec_randtest(a, state, len, bits);
+        _fmpz_vec_randtest(b, state, len, bits);
         _fmpz_vec_set(c, b, len);
 
-        x = z_randtest(state);
+        x = n_randint(state, 2) ? z_randtest(state)
+                                : (slong) n_randint(state, 1000) - 500;
 
         _fmpz_vec_scalar_submul_si(b, a, len, x);
         _fmpz_vec_scalar_mul_si(d, a, len, x);
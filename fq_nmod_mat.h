@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -30,6 +31,9 @@
 /* Cutoff between classical and recursive LU decomposition */
 #define FQ_NMOD_MAT_LU_RECURSIVE_CUTOFF 4
 
+/* Smallest dimension for multiplication by evaluation and interpolation */
+#define FQ_NMOD_MAT_MUL_INTERPOLATE_CUTOFF 8
+
 FQ_NMOD_MAT_INLINE
 int FQ_NMOD_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx)
 {
@@ -47,4 +51,16 @@ int FQ_NMOD_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx)
 #undef CAP_T
 #undef T
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+FLINT_DLL void fq_nmod_mat_mul_interpolate(fq_nmod_mat_t C,
+                const fq_nmod_mat_t A, const fq_nmod_mat_t B,
+                                                   const fq_nmod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
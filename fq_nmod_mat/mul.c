@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -11,12 +12,27 @@
 
 #include "fq_nmod_mat.h"
 
-#ifdef T
-#undef T
-#endif
+void
+fq_nmod_mat_mul(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    if (C == A || C == B)
+    {
+        fq_nmod_mat_t T;
+        fq_nmod_mat_init(T, A->r, B->c, ctx);
+        fq_nmod_mat_mul(T, A, B, ctx);
+        fq_nmod_mat_swap_entrywise(T, C, ctx);
+        fq_nmod_mat_clear(T, ctx);
+        return;
+    }
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_mat_templates/mul.c"
-#undef CAP_T
-#undef T
+    /* evaluation needs 2d - 1 distinct points */
+    if (FLINT_MIN(A->r, FLINT_MIN(A->c, B->c)) >=
+                                        FQ_NMOD_MAT_MUL_INTERPOLATE_CUTOFF &&
+        ctx->mod.n >= 2*fq_nmod_ctx_degree(ctx) - 1)
+        fq_nmod_mat_mul_interpolate(C, A, B, ctx);
+    else if (FQ_NMOD_MAT_MUL_KS_CUTOFF(A->r, B->c, ctx))
+        fq_nmod_mat_mul_KS(C, A, B, ctx);
+    else
+        fq_nmod_mat_mul_classical(C, A, B, ctx);
+}
@@ -0,0 +1,187 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod_mat.h"
+
+/*
+   The entries are polynomials of length at most d over Z/pZ, so the
+   product before reduction has entries of length at most 2d - 1 and is
+   given by its values at the points 0, 1, ..., 2d - 2. Evaluation,
+   interpolation and reduction modulo the defining polynomial are linear
+   maps, so all three are done by multiplying small matrices with wide
+   matrices holding the coefficients or values of all entries.
+*/
+
+/* sets X (d x r*c) to the coefficients of the entries of A, row by row */
+static void
+_fq_nmod_mat_get_coeffs(nmod_mat_t X, const fq_nmod_mat_t A)
+{
+    slong i, j, t, c = A->c;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < c; j++)
+        {
+            const fq_nmod_struct * a = fq_nmod_mat_entry(A, i, j);
+
+            for (t = 0; t < a->length; t++)
+                nmod_mat_entry(X, t, i*c + j) = a->coeffs[t];
+        }
+    }
+}
+
+/* sets Amod to the r x c matrix stored row by row in row s of Y */
+static void
+_nmod_mat_set_row(nmod_mat_t Amod, const nmod_mat_t Y, slong s)
+{
+    slong i;
+
+    for (i = 0; i < Amod->r; i++)
+        _nmod_vec_set(Amod->rows[i], Y->rows[s] + i*Amod->c, Amod->c);
+}
+
+void
+fq_nmod_mat_mul_interpolate(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    slong d = fq_nmod_ctx_degree(ctx);
+    slong len = 2*d - 1;
+    slong m = A->r, k = A->c, n = B->c;
+    slong i, j, s, t;
+    nmod_t mod = ctx->mod;
+    nmod_mat_t V, W, R, X, YA, YB, Z, Amod, Bmod, Cmod;
+    fq_nmod_t x;
+
+    if (C == A || C == B)
+    {
+        fq_nmod_mat_t T;
+        fq_nmod_mat_init(T, m, n, ctx);
+        fq_nmod_mat_mul_interpolate(T, A, B, ctx);
+        fq_nmod_mat_swap_entrywise(C, T, ctx);
+        fq_nmod_mat_clear(T, ctx);
+        return;
+    }
+
+    if (mod.n < len)
+    {
+        flint_printf("Exception (fq_nmod_mat_mul_interpolate). \n"
+               "Characteristic is too small.\n");
+        flint_abort();
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (k == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    /* V[s][t] = s^t, for all t and for t < d */
+    nmod_mat_init(V, len, len, mod.n);
+    for (s = 0; s < len; s++)
+    {
+        nmod_mat_entry(V, s, 0) = 1;
+        for (t = 1; t < len; t++)
+            nmod_mat_entry(V, s, t) = nmod_mul(nmod_mat_entry(V, s, t - 1),
+                                                                      s, mod);
+    }
+
+    /* W = R V^(-1), where column t of R is x^t reduced modulo f */
+    nmod_mat_init(W, len, len, mod.n);
+    nmod_mat_inv(W, V);
+
+    nmod_mat_init(R, d, len, mod.n);
+    fq_nmod_init2(x, ctx);
+    nmod_poly_fit_length(x, len);
+    for (t = 0; t < len; t++)
+    {
+        _nmod_vec_zero(x->coeffs, t);
+        x->coeffs[t] = 1;
+        x->length = t + 1;
+        fq_nmod_reduce(x, ctx);
+
+        for (i = 0; i < x->length; i++)
+            nmod_mat_entry(R, i, t) = x->coeffs[i];
+    }
+    fq_nmod_clear(x, ctx);
+
+    nmod_mat_init(X, d, len, mod.n);
+    nmod_mat_mul(X, R, W);
+    nmod_mat_swap(W, X);
+    nmod_mat_clear(X);
+    nmod_mat_clear(R);
+
+    /* values of the entries of A and B at all points */
+    nmod_mat_window_init(Z, V, 0, 0, len, d);
+
+    nmod_mat_init(X, d, m*k, mod.n);
+    nmod_mat_init(YA, len, m*k, mod.n);
+    _fq_nmod_mat_get_coeffs(X, A);
+    nmod_mat_mul(YA, Z, X);
+    nmod_mat_clear(X);
+
+    nmod_mat_init(X, d, k*n, mod.n);
+    nmod_mat_init(YB, len, k*n, mod.n);
+    _fq_nmod_mat_get_coeffs(X, B);
+    nmod_mat_mul(YB, Z, X);
+    nmod_mat_clear(X);
+
+    nmod_mat_window_clear(Z);
+
+    /* the products at all points, row s of Z holding the product at s */
+    nmod_mat_init(Amod, m, k, mod.n);
+    nmod_mat_init(Bmod, k, n, mod.n);
+    nmod_mat_init(Cmod, m, n, mod.n);
+    nmod_mat_init(Z, len, m*n, mod.n);
+
+    for (s = 0; s < len; s++)
+    {
+        _nmod_mat_set_row(Amod, YA, s);
+        _nmod_mat_set_row(Bmod, YB, s);
+        nmod_mat_mul(Cmod, Amod, Bmod);
+
+        for (i = 0; i < m; i++)
+            _nmod_vec_set(Z->rows[s] + i*n, Cmod->rows[i], n);
+    }
+
+    nmod_mat_clear(Amod);
+    nmod_mat_clear(Bmod);
+    nmod_mat_clear(Cmod);
+    nmod_mat_clear(YA);
+    nmod_mat_clear(YB);
+
+    /* interpolate and reduce */
+    nmod_mat_init(X, d, m*n, mod.n);
+    nmod_mat_mul(X, W, Z);
+    nmod_mat_clear(Z);
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            fq_nmod_struct * c = fq_nmod_mat_entry(C, i, j);
+
+            nmod_poly_fit_length(c, d);
+
+            for (t = 0; t < d; t++)
+                c->coeffs[t] = nmod_mat_entry(X, t, i*n + j);
+
+            c->length = d;
+            _nmod_poly_normalise(c);
+        }
+    }
+
+    nmod_mat_clear(X);
+    nmod_mat_clear(V);
+    nmod_mat_clear(W);
+}
@@ -0,0 +1,96 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fq_nmod_mat.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_interpolate....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_mat_t A, B, C, D;
+        slong m, k, n;
+
+        fq_nmod_ctx_randtest(ctx, state);
+
+        if (ctx->mod.n < 2*fq_nmod_ctx_degree(ctx) - 1)
+        {
+            fq_nmod_ctx_clear(ctx);
+            continue;
+        }
+
+        m = n_randint(state, 30);
+        k = n_randint(state, 30);
+        n = n_randint(state, 30);
+
+        fq_nmod_mat_init(A, m, k, ctx);
+        fq_nmod_mat_init(B, k, n, ctx);
+        fq_nmod_mat_init(C, m, n, ctx);
+        fq_nmod_mat_init(D, m, n, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+        fq_nmod_mat_randtest(D, state, ctx);  /* noise in output */
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        fq_nmod_mat_mul_classical(C, A, B, ctx);
+        fq_nmod_mat_mul_interpolate(D, A, B, ctx);
+
+        if (!fq_nmod_mat_equal(C, D, ctx))
+        {
+            flint_printf("FAIL: results not equal\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("\nA:\n");
+            fq_nmod_mat_print(A, ctx);
+            flint_printf("B:\n");
+            fq_nmod_mat_print(B, ctx);
+            flint_printf("C:\n");
+            fq_nmod_mat_print(C, ctx);
+            flint_printf("D:\n");
+            fq_nmod_mat_print(D, ctx);
+            abort();
+        }
+
+        /* aliasing */
+        if (m == k)
+        {
+            fq_nmod_mat_mul_interpolate(B, A, B, ctx);
+
+            if (!fq_nmod_mat_equal(C, B, ctx))
+            {
+                flint_printf("FAIL: aliasing\n");
+                abort();
+            }
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(C, ctx);
+        fq_nmod_mat_clear(D, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2010,2011 Fredrik Johansson
     Copyright (C) 2014 Ashish Kedia
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -210,6 +211,28 @@ FLINT_DLL void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmo
 FLINT_DLL void _nmod_mat_mul_classical_op(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
 
+FLINT_DLL void _nmod_mat_mul_blocked_op(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op);
+
+FLINT_DLL void nmod_mat_mul_blocked(nmod_mat_t C, const nmod_mat_t A,
+                                                           const nmod_mat_t B);
+
+FLINT_DLL void _nmod_mat_blocked_kernel_d(slong kc, const double * Ap,
+                                               const double * Bp, double * T);
+
+FLINT_DLL void _nmod_mat_blocked_kernel_ui(slong kc, mp_srcptr Ap,
+                                       mp_srcptr Bp, mp_ptr lo, mp_ptr hi);
+
+#if NMOD_VEC_HAVE_SIMD
+
+FLINT_DLL void _nmod_mat_blocked_kernel_d_avx2(slong kc, const double * Ap,
+                                               const double * Bp, double * T);
+
+FLINT_DLL void _nmod_mat_blocked_kernel_ui_avx2(slong kc, mp_srcptr Ap,
+                                       mp_srcptr Bp, mp_ptr lo, mp_ptr hi);
+
+#endif
+
 FLINT_DLL void nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B);
 
@@ -388,6 +411,8 @@ FLINT_DLL void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
  * 
  * FLINT_DLL void nmod_mat_charpoly_danilevsky(nmod_poly_t p, const nmod_mat_t M);
  *
+ * FLINT_DLL void nmod_mat_charpoly_krylov(nmod_poly_t p, const nmod_mat_t M);
+ *
  * FLINT_DLL void nmod_mat_minpoly(nmod_poly_t p, const nmod_mat_t M);
 */
 
@@ -396,6 +421,19 @@ FLINT_DLL void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 /* Size at which pre-transposing becomes faster in classical multiplication */
 #define NMOD_MAT_MUL_TRANSPOSE_CUTOFF 20
 
+/* Tile of the blocked multiplication kernels */
+#define NMOD_MAT_BLOCKED_MR 4
+#define NMOD_MAT_BLOCKED_NR 8
+
+/* Moduli n with n - 1 < 2^bits use the double precision kernel */
+#define NMOD_MAT_BLOCKED_DOUBLE_BITS 23
+
+/* Dimension from which blocked multiplication beats the classical one */
+#define NMOD_MAT_MUL_BLOCKED_CUTOFF 32
+
+/* Dimension from which Strassen on top of blocked multiplication wins */
+#define NMOD_MAT_MUL_BLOCKED_STRASSEN_CUTOFF 512
+
 /* Cutoff between classical and recursive triangular solving */
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
 #define NMOD_MAT_SOLVE_TRI_COLS_CUTOFF 64
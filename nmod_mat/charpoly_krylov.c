@@ -0,0 +1,206 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+/*
+   Sets cp to the determinant of P, given by the matrix E whose row k holds
+   the coefficients of x^k in the entries of P, row by row. The determinant
+   is monic of degree n, so when the modulus exceeds n it is interpolated
+   from its values at 0, 1, ..., n, which are the determinants of the rows
+   of the product of a Vandermonde matrix with E.
+*/
+static void
+_nmod_mat_charpoly_krylov_det(nmod_poly_t cp, const nmod_mat_t E, slong b,
+                                                                     slong n)
+{
+    slong i, j, k, s, len = E->r;
+    nmod_t mod = E->mod;
+
+    if (mod.n <= (ulong) n)
+    {
+        nmod_poly_mat_t P;
+
+        nmod_poly_mat_init(P, b, b, mod.n);
+
+        for (k = 0; k < len; k++)
+            for (j = 0; j < b; j++)
+                for (i = 0; i < b; i++)
+                    nmod_poly_set_coeff_ui(nmod_poly_mat_entry(P, j, i), k,
+                                                nmod_mat_entry(E, k, j*b + i));
+
+        nmod_poly_mat_det(cp, P);
+        nmod_poly_mat_clear(P);
+    }
+    else
+    {
+        nmod_mat_t V, Y, Q;
+        mp_ptr xs, ys;
+
+        nmod_mat_init(V, n + 1, len, mod.n);
+        nmod_mat_init(Y, n + 1, b*b, mod.n);
+        nmod_mat_init(Q, b, b, mod.n);
+        xs = _nmod_vec_init(n + 1);
+        ys = _nmod_vec_init(n + 1);
+
+        for (s = 0; s <= n; s++)
+        {
+            xs[s] = s;
+            nmod_mat_entry(V, s, 0) = 1;
+            for (k = 1; k < len; k++)
+                nmod_mat_entry(V, s, k) =
+                    nmod_mul(nmod_mat_entry(V, s, k - 1), s, mod);
+        }
+
+        nmod_mat_mul(Y, V, E);
+
+        for (s = 0; s <= n; s++)
+        {
+            for (j = 0; j < b; j++)
+                _nmod_vec_set(Q->rows[j], Y->rows[s] + j*b, b);
+
+            ys[s] = nmod_mat_det(Q);
+        }
+
+        nmod_poly_interpolate_nmod_vec_fast(cp, xs, ys, n + 1);
+
+        _nmod_vec_clear(xs);
+        _nmod_vec_clear(ys);
+        nmod_mat_clear(V);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Q);
+    }
+}
+
+/*
+   Block Krylov method. For a random n x b matrix V with columns v_i, the
+   first n columns of [V, MV, M^2 V, ...] are A^k v_i for k < d_i, where
+   the d_i are n / b rounded up or down. If they form a nonsingular matrix
+   K, which is the case for most V unless M has more than b nontrivial
+   invariant factors, solving K C = R where R has the columns M^(d_i) v_i
+   expresses each M^(d_i) v_i in terms of the others. These relations give
+   a b x b polynomial matrix P presenting the module defined by M, with
+   column i equal to x^(d_i) e_i minus the relation for M^(d_i) v_i, and
+   the characteristic polynomial of M is det(P). All the work with n x n
+   matrices is done by n / b products with n x b matrices and one solve.
+*/
+static int
+_nmod_mat_charpoly_krylov(nmod_poly_t cp, const nmod_mat_t M, slong b,
+                                                        flint_rand_t state)
+{
+    slong n = M->r, m, r, i, j, k, col;
+    nmod_mat_t K, R, X, Y, C;
+    int result;
+
+    m = n / b;
+    r = n % b;
+
+    nmod_mat_init(K, n, n, M->mod.n);
+    nmod_mat_init(R, n, b, M->mod.n);
+    nmod_mat_init(X, n, b, M->mod.n);
+    nmod_mat_init(Y, n, b, M->mod.n);
+
+    nmod_mat_randfull(X, state);
+
+    /* X = M^k V, copied column by column into K and R */
+    for (k = 0; k <= m + (r != 0); k++)
+    {
+        for (j = 0; j < b; j++)
+        {
+            col = k*b + j;
+
+            if (col < n)
+            {
+                for (i = 0; i < n; i++)
+                    nmod_mat_entry(K, i, col) = nmod_mat_entry(X, i, j);
+            }
+            else if (k == m + (j < r))
+            {
+                for (i = 0; i < n; i++)
+                    nmod_mat_entry(R, i, j) = nmod_mat_entry(X, i, j);
+            }
+        }
+
+        if (k < m + (r != 0))
+        {
+            nmod_mat_mul(Y, M, X);
+            nmod_mat_swap(X, Y);
+        }
+    }
+
+    nmod_mat_clear(X);
+    nmod_mat_clear(Y);
+
+    nmod_mat_init(C, n, b, M->mod.n);
+    result = nmod_mat_solve(C, K, R);
+    nmod_mat_clear(K);
+    nmod_mat_clear(R);
+
+    if (result)
+    {
+        /* row k of E holds the coefficients of x^k in P, row by row */
+        nmod_mat_init(X, m + 2, b*b, M->mod.n);
+
+        for (col = 0; col < n; col++)
+        {
+            k = col / b;
+            j = col % b;
+
+            for (i = 0; i < b; i++)
+                nmod_mat_entry(X, k, j*b + i) =
+                                 nmod_neg(nmod_mat_entry(C, col, i), M->mod);
+        }
+
+        for (j = 0; j < b; j++)
+            nmod_mat_entry(X, m + (j < r), j*b + j) = 1;
+
+        _nmod_mat_charpoly_krylov_det(cp, X, b, n);
+        nmod_mat_clear(X);
+    }
+
+    nmod_mat_clear(C);
+
+    return result;
+}
+
+void
+nmod_mat_charpoly_krylov(nmod_poly_t cp, const nmod_mat_t M)
+{
+    slong n = M->r, b;
+    flint_rand_t state;
+    int result;
+
+    if (M->r != M->c)
+    {
+        flint_printf("Exception (nmod_mat_charpoly_krylov).  Non-square matrix.\n");
+        flint_abort();
+    }
+
+    b = FLINT_MIN(n / NMOD_MAT_CHARPOLY_KRYLOV_BLOCK_RATIO,
+                                               NMOD_MAT_CHARPOLY_KRYLOV_BLOCK);
+
+    if (b < 1)
+    {
+        nmod_mat_charpoly_danilevsky(cp, M);
+        return;
+    }
+
+    flint_randinit(state);
+    result = _nmod_mat_charpoly_krylov(cp, M, b, state);
+    flint_randclear(state);
+
+    if (!result)
+        nmod_mat_charpoly_danilevsky(cp, M);
+}
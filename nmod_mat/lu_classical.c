@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -15,7 +16,43 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "thread_support.h"
 
+/* number of entries updated per pivot from which rows are split over threads */
+#define LU_THREADED_CUTOFF 32768
+
+typedef struct
+{
+    mp_ptr * a;
+    slong row;
+    slong col;
+    slong rank;
+    slong length;
+    mp_limb_t d;
+    nmod_t mod;
+}
+_lu_eliminate_arg_struct;
+
+static void
+_lu_eliminate_worker(slong start, slong stop, void * varg)
+{
+    _lu_eliminate_arg_struct * arg = (_lu_eliminate_arg_struct *) varg;
+    mp_ptr * a = arg->a;
+    slong i, row = arg->row, col = arg->col, length = arg->length;
+    nmod_t mod = arg->mod;
+    mp_limb_t e;
+
+    for (i = start; i < stop; i++)
+    {
+        e = n_mulmod2_preinv(a[i][col], arg->d, mod.n, mod.ninv);
+        if (length != 0)
+            _nmod_vec_scalar_addmul_nmod(a[i] + col + 1,
+                a[row] + col + 1, length, nmod_neg(e, mod), mod);
+
+        a[i][col] = 0;
+        a[i][arg->rank - 1] = e;
+    }
+}
 
 static __inline__ int
 nmod_mat_pivot(nmod_mat_t A, slong * P, slong start_row, slong col)
@@ -48,9 +85,11 @@ nmod_mat_pivot(nmod_mat_t A, slong * P, slong start_row, slong col)
 slong 
 nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check)
 {
-    mp_limb_t d, e, **a;
+    _lu_eliminate_arg_struct arg;
+    mp_limb_t d, **a;
     nmod_t mod;
     slong i, m, n, rank, length, row, col;
+    slong num_threads = flint_get_num_threads();
 
     m = A->r;
     n = A->c;
@@ -59,6 +98,9 @@ nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check)
 
     rank = row = col = 0;
 
+    arg.a = a;
+    arg.mod = mod;
+
     for (i = 0; i < m; i++)
         P[i] = i;
 
@@ -78,16 +120,19 @@ nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check)
         d = n_invmod(d, mod.n);
         length = n - col - 1;
 
-        for (i = row + 1; i < m; i++)
-        {
-            e = n_mulmod2_preinv(a[i][col], d, mod.n, mod.ninv);
-            if (length != 0)
-                _nmod_vec_scalar_addmul_nmod(a[i] + col + 1,
-                    a[row] + col + 1, length, nmod_neg(e, mod), mod);
+        arg.row = row;
+        arg.col = col;
+        arg.rank = rank;
+        arg.length = length;
+        arg.d = d;
+
+        if (num_threads > 1 && (m - row - 1)*(length + 1) >= LU_THREADED_CUTOFF)
+            flint_parallel_for(row + 1, m,
+                FLINT_MAX(WORD(1), LU_THREADED_CUTOFF/(2*(length + 1))),
+                                   _lu_eliminate_worker, &arg, num_threads);
+        else
+            _lu_eliminate_worker(row + 1, m, &arg);
 
-            a[i][col] = 0;
-            a[i][rank - 1] = e;
-        }
         row++;
         col++;
     }
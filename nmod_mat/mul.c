@@ -2,6 +2,7 @@
     Copyright (C) 2010 Fredrik Johansson
     Copyright (C) 2020 William Hart
     Copyright (C) 2020 Daniel Schultz
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -79,6 +80,22 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
         return;
     }
 
+    if (FLINT_BITS == 64 && A->mod.n <= UWORD(0xffffffff))
+    {
+        if (min_dim < NMOD_MAT_MUL_BLOCKED_CUTOFF)
+        {
+            if (flint_num_threads > 1)
+                nmod_mat_mul_classical_threaded(C, A, B);
+            else
+                nmod_mat_mul_classical(C, A, B);
+        }
+        else if (min_dim < NMOD_MAT_MUL_BLOCKED_STRASSEN_CUTOFF)
+            nmod_mat_mul_blocked(C, A, B);
+        else
+            nmod_mat_mul_strassen(C, A, B);
+        return;
+    }
+
     if (FLINT_BITS == 64 && C->mod.n < 2048)
         cutoff = 400;
     else
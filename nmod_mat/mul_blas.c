@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2020 Daniel Schultz
+    Copyright (C) 2026 FLINT authors
     This file is part of FLINT.
     FLINT is free software: you can redistribute it and/or modify it under
     the terms of the GNU Lesser General Public License (LGPL) as published
@@ -10,9 +11,13 @@
 #include "nmod_mat.h"
 #include "thread_support.h"
 
-#if FLINT_USES_BLAS && FLINT_BITS == 64
+#if FLINT_BITS == 64
 
+#if FLINT_USES_BLAS
 #include "cblas.h"
+#else
+#include "d_mat.h"
+#endif
 
 /*
     This code is on the edge of disaster. Blas is used for dot products
@@ -32,6 +37,44 @@
 /* for sgemm */
 #define MAX_BLAS_SP_INT  (UWORD(1) << 24)
 
+/*
+    dC = dA*dB for row major m x k and k x n matrices, on the given threads
+    if BLAS is not available, or on threads requested here if there are none
+*/
+static void _dgemm(double * dC, double * dA, double * dB,
+                   slong m, slong k, slong n,
+                   thread_pool_handle * threads, slong num_threads)
+{
+#if FLINT_USES_BLAS
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                                       m, n, k, 1.0, dA, k, dB, n, 0.0, dC, n);
+#else
+    slong i;
+    double ** rows = FLINT_ARRAY_ALLOC(2*m + k, double *);
+    int own = (threads == NULL);
+
+    for (i = 0; i < m; i++)
+    {
+        rows[i] = dC + i*n;
+        rows[m + i] = dA + i*k;
+    }
+
+    for (i = 0; i < k; i++)
+        rows[2*m + i] = dB + i*n;
+
+    if (own)
+        num_threads = flint_request_threads(&threads, flint_get_num_threads());
+
+    _d_mat_mul_blocked_threaded_pool_op(rows, rows + m, rows + 2*m, m, k, n,
+                                                     0, threads, num_threads);
+
+    if (own)
+        flint_give_back_threads(threads, num_threads);
+
+    flint_free(rows);
+#endif
+}
+
 
 /* helper for distributing the input conversion work */
 static void _distribute_rows(
@@ -68,6 +111,9 @@ static void _distribute_rows(
 
 /************ small enough that a single sgemm suffices **********************/
 
+/* there is no built-in sgemm, so this needs BLAS */
+#if FLINT_USES_BLAS
+
 static void _lift_vec_sp(float * a, ulong * b, slong len, ulong n)
 {
     slong i;
@@ -241,6 +287,8 @@ static int _nmod_mat_mul_blas_sp(nmod_mat_t C,
     return 1;
 }
 
+#endif
+
 
 /******** handle larger larger moduli via several dgemm's and crt ************/
 
@@ -474,8 +522,7 @@ static int _nmod_mat_mul_blas_crt(nmod_mat_t C,
         for (i = 0; i < num_workers; i++)
             thread_pool_wait(global_thread_pool, handles[i]);
 
-        cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                                       1.0, dA, k, dB, n, 0.0, dC + pi*m*n, n);
+        _dgemm(dC + pi*m*n, dA, dB, m, k, n, handles, num_workers);
     }
 
     {
@@ -624,8 +671,10 @@ int nmod_mat_mul_blas(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     if (hi != 0 || lo >= MAX_BLAS_DP_INT)
         return _nmod_mat_mul_blas_crt(C, A, B);
 
+#if FLINT_USES_BLAS
     if (lo < MAX_BLAS_SP_INT)
         return _nmod_mat_mul_blas_sp(C, A, B);
+#endif
 
     dA = flint_malloc(m*k*sizeof(double));
     dB = flint_malloc(k*n*sizeof(double));
@@ -663,8 +712,7 @@ int nmod_mat_mul_blas(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
             thread_pool_wait(global_thread_pool, handles[i]);
     }
 
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                                                1.0, dA, k, dB, n, 0.0, dC, n);
+    _dgemm(dC, dA, dB, m, k, n, handles, num_workers);
 
     /* convert output */
 
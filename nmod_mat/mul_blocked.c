@@ -0,0 +1,325 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+/*
+   Blocking in the style of Goto and van de Geijn: B is packed kc x nc at
+   a time into panels of NR columns, then mc x kc blocks of A are packed
+   into panels of MR rows, one block per task, and a register tiled kernel
+   computes each MR x NR tile. The unreduced sums of a tile are reduced and
+   added to D once per kc block.
+
+   For n <= 2^NMOD_MAT_BLOCKED_DOUBLE_BITS the sums are formed in doubles,
+   which are exact as long as they stay below 2^53. For n < 2^32 the low
+   and high halves of the products are summed separately in words.
+*/
+
+#define MR NMOD_MAT_BLOCKED_MR
+#define NR NMOD_MAT_BLOCKED_NR
+#define KC 256
+#define MC 64
+#define NC 1024
+
+typedef struct
+{
+    mp_ptr * D;
+    mp_ptr * A;
+    slong m;
+    slong pc;
+    slong kc;
+    slong jc;
+    slong nc;
+    const mp_limb_t * Bp;
+    nmod_t mod;
+    int op;
+    int use_double;
+    int simd;
+}
+_blocked_arg_struct;
+
+/* the packed operands share one buffer type */
+#define DBL(x) ((double *) (x))
+#define CDBL(x) ((const double *) (x))
+
+static void
+_pack_B(mp_ptr Bp, mp_ptr * B, slong pc, slong kc, slong jc, slong nc,
+                                                               int use_double)
+{
+    slong jp, p, j, nr;
+
+    for (jp = 0; jp < nc; jp += NR)
+    {
+        nr = FLINT_MIN(NR, nc - jp);
+
+        for (p = 0; p < kc; p++, Bp += NR)
+        {
+            mp_srcptr b = B[pc + p] + jc + jp;
+
+            if (use_double)
+            {
+                for (j = 0; j < nr; j++)
+                    DBL(Bp)[j] = (double) b[j];
+                for ( ; j < NR; j++)
+                    DBL(Bp)[j] = 0.0;
+            }
+            else
+            {
+                for (j = 0; j < nr; j++)
+                    Bp[j] = b[j];
+                for ( ; j < NR; j++)
+                    Bp[j] = 0;
+            }
+        }
+    }
+}
+
+static void
+_pack_A(mp_ptr Ap, mp_ptr * A, slong ic, slong mc, slong pc, slong kc,
+                                                               int use_double)
+{
+    slong ip, p, i, mr;
+
+    for (ip = 0; ip < mc; ip += MR)
+    {
+        mr = FLINT_MIN(MR, mc - ip);
+
+        for (p = 0; p < kc; p++, Ap += MR)
+        {
+            if (use_double)
+            {
+                for (i = 0; i < mr; i++)
+                    DBL(Ap)[i] = (double) A[ic + ip + i][pc + p];
+                for ( ; i < MR; i++)
+                    DBL(Ap)[i] = 0.0;
+            }
+            else
+            {
+                for (i = 0; i < mr; i++)
+                    Ap[i] = A[ic + ip + i][pc + p];
+                for ( ; i < MR; i++)
+                    Ap[i] = 0;
+            }
+        }
+    }
+}
+
+void
+_nmod_mat_blocked_kernel_d(slong kc, const double * Ap, const double * Bp,
+                                                                  double * T)
+{
+    slong p, i, j;
+
+    for (i = 0; i < MR*NR; i++)
+        T[i] = 0.0;
+
+    for (p = 0; p < kc; p++, Ap += MR, Bp += NR)
+        for (i = 0; i < MR; i++)
+            for (j = 0; j < NR; j++)
+                T[i*NR + j] += Ap[i]*Bp[j];
+}
+
+void
+_nmod_mat_blocked_kernel_ui(slong kc, mp_srcptr Ap, mp_srcptr Bp,
+                                                         mp_ptr lo, mp_ptr hi)
+{
+    slong p, i, j;
+    mp_limb_t t;
+
+    for (i = 0; i < MR*NR; i++)
+        lo[i] = hi[i] = 0;
+
+    for (p = 0; p < kc; p++, Ap += MR, Bp += NR)
+    {
+        for (i = 0; i < MR; i++)
+        {
+            for (j = 0; j < NR; j++)
+            {
+                t = Ap[i]*Bp[j];
+                lo[i*NR + j] += (t & UWORD(0xffffffff));
+                hi[i*NR + j] += (t >> 32);
+            }
+        }
+    }
+}
+
+static void
+_blocked_worker(slong start, slong stop, void * varg)
+{
+    _blocked_arg_struct * arg = (_blocked_arg_struct *) varg;
+    mp_ptr * D = arg->D;
+    slong kc = arg->kc, jc = arg->jc, nc = arg->nc;
+    nmod_t mod = arg->mod;
+    slong b, ic, mc, ip, jp, mr, nr, i, j;
+    mp_limb_t lo[MR*NR], hi[MR*NR], x, y, h1, h0;
+    double T[MR*NR];
+    mp_ptr Ap;
+    TMP_INIT;
+
+    TMP_START;
+
+    Ap = TMP_ALLOC(MC*kc*sizeof(mp_limb_t));
+
+    for (b = start; b < stop; b++)
+    {
+        ic = b*MC;
+        mc = FLINT_MIN(MC, arg->m - ic);
+
+        _pack_A(Ap, arg->A, ic, mc, arg->pc, kc, arg->use_double);
+
+        for (jp = 0; jp < nc; jp += NR)
+        {
+            nr = FLINT_MIN(NR, nc - jp);
+
+            for (ip = 0; ip < mc; ip += MR)
+            {
+                mr = FLINT_MIN(MR, mc - ip);
+
+                if (arg->use_double)
+                {
+#if NMOD_VEC_HAVE_SIMD
+                    if (arg->simd)
+                        _nmod_mat_blocked_kernel_d_avx2(kc, CDBL(Ap + ip*kc),
+                                                   CDBL(arg->Bp + jp*kc), T);
+                    else
+#endif
+                        _nmod_mat_blocked_kernel_d(kc, CDBL(Ap + ip*kc),
+                                                   CDBL(arg->Bp + jp*kc), T);
+                }
+                else
+                {
+#if NMOD_VEC_HAVE_SIMD
+                    if (arg->simd)
+                        _nmod_mat_blocked_kernel_ui_avx2(kc, Ap + ip*kc,
+                                                   arg->Bp + jp*kc, lo, hi);
+                    else
+#endif
+                        _nmod_mat_blocked_kernel_ui(kc, Ap + ip*kc,
+                                                   arg->Bp + jp*kc, lo, hi);
+                }
+
+                for (i = 0; i < mr; i++)
+                {
+                    mp_ptr d = D[ic + ip + i] + jc + jp;
+
+                    for (j = 0; j < nr; j++)
+                    {
+                        if (arg->use_double)
+                        {
+                            x = (mp_limb_t) T[i*NR + j];
+                            NMOD_RED(x, x, mod);
+                        }
+                        else
+                        {
+                            y = hi[i*NR + j];
+                            h1 = y >> 32;
+                            h0 = y << 32;
+                            add_ssaaaa(h1, h0, h1, h0, 0, lo[i*NR + j]);
+                            NMOD2_RED2(x, h1, h0, mod);
+                        }
+
+                        d[j] = (arg->op >= 0) ? nmod_add(d[j], x, mod)
+                                              : nmod_sub(d[j], x, mod);
+                    }
+                }
+            }
+        }
+    }
+
+    TMP_END;
+}
+
+void
+_nmod_mat_mul_blocked_op(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op)
+{
+    _blocked_arg_struct arg;
+    slong m = A->r, k = A->c, n = B->c;
+    slong jc, pc, kc, kcmax;
+    mp_limb_t n1 = A->mod.n - 1;
+    mp_ptr Bp;
+
+    if (FLINT_BITS != 64 || n1 >= UWORD(0xffffffff) || k == 0)
+    {
+        _nmod_mat_mul_classical_op(D, C, A, B, op);
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (op == 0)
+        nmod_mat_zero(D);
+    else if (D != C)
+        nmod_mat_set(D, C);
+
+    arg.D = D->rows;
+    arg.A = A->rows;
+    arg.m = m;
+    arg.mod = A->mod;
+    arg.op = op;
+    arg.use_double = (n1 < (UWORD(1) << NMOD_MAT_BLOCKED_DOUBLE_BITS));
+#if NMOD_VEC_HAVE_SIMD
+    arg.simd = (_nmod_vec_simd_level() >= NMOD_VEC_SIMD_AVX2);
+#else
+    arg.simd = 0;
+#endif
+
+    /* keep the unreduced sums below 2^53 */
+    kcmax = KC;
+    if (arg.use_double && n1 > 1)
+        kcmax = FLINT_MIN(kcmax, (UWORD(1) << 53) / (n1*n1));
+
+    Bp = flint_malloc(kcmax*(FLINT_MIN(NC, n) + NR)*sizeof(mp_limb_t));
+    arg.Bp = Bp;
+
+    for (jc = 0; jc < n; jc += NC)
+    {
+        arg.jc = jc;
+        arg.nc = FLINT_MIN(NC, n - jc);
+
+        for (pc = 0; pc < k; pc += kc)
+        {
+            kc = FLINT_MIN(kcmax, k - pc);
+
+            arg.pc = pc;
+            arg.kc = kc;
+
+            _pack_B(Bp, B->rows, pc, kc, jc, arg.nc, arg.use_double);
+
+            flint_parallel_for(0, (m + MC - 1)/MC, 1, _blocked_worker, &arg,
+                                                     flint_get_num_threads());
+        }
+    }
+
+    flint_free(Bp);
+}
+
+void
+nmod_mat_mul_blocked(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    if (C == A || C == B)
+    {
+        nmod_mat_t T;
+        nmod_mat_init(T, A->r, B->c, A->mod.n);
+        _nmod_mat_mul_blocked_op(T, NULL, A, B, 0);
+        nmod_mat_swap_entrywise(C, T);
+        nmod_mat_clear(T);
+        return;
+    }
+
+    _nmod_mat_mul_blocked_op(C, NULL, A, B, 0);
+}
@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+#if NMOD_MAT_BLOCKED_MR != 4 || NMOD_MAT_BLOCKED_NR != 8
+#error "the AVX2 kernels are written for 4 x 8 tiles"
+#endif
+
+/* 4 x 8 tile in eight accumulators, one broadcast and two loads per step */
+AVX2_TARGET void
+_nmod_mat_blocked_kernel_d_avx2(slong kc, const double * Ap,
+                                             const double * Bp, double * T)
+{
+    __m256d c00, c01, c10, c11, c20, c21, c30, c31, a, b0, b1;
+    slong p;
+
+    c00 = c01 = c10 = c11 = _mm256_setzero_pd();
+    c20 = c21 = c30 = c31 = _mm256_setzero_pd();
+
+    for (p = 0; p < kc; p++, Ap += 4, Bp += 8)
+    {
+        b0 = _mm256_loadu_pd(Bp);
+        b1 = _mm256_loadu_pd(Bp + 4);
+
+        a = _mm256_broadcast_sd(Ap + 0);
+        c00 = _mm256_fmadd_pd(a, b0, c00);
+        c01 = _mm256_fmadd_pd(a, b1, c01);
+
+        a = _mm256_broadcast_sd(Ap + 1);
+        c10 = _mm256_fmadd_pd(a, b0, c10);
+        c11 = _mm256_fmadd_pd(a, b1, c11);
+
+        a = _mm256_broadcast_sd(Ap + 2);
+        c20 = _mm256_fmadd_pd(a, b0, c20);
+        c21 = _mm256_fmadd_pd(a, b1, c21);
+
+        a = _mm256_broadcast_sd(Ap + 3);
+        c30 = _mm256_fmadd_pd(a, b0, c30);
+        c31 = _mm256_fmadd_pd(a, b1, c31);
+    }
+
+    _mm256_storeu_pd(T + 0, c00);
+    _mm256_storeu_pd(T + 4, c01);
+    _mm256_storeu_pd(T + 8, c10);
+    _mm256_storeu_pd(T + 12, c11);
+    _mm256_storeu_pd(T + 16, c20);
+    _mm256_storeu_pd(T + 20, c21);
+    _mm256_storeu_pd(T + 24, c30);
+    _mm256_storeu_pd(T + 28, c31);
+}
+
+/*
+   Entries are below 2^32, so _mm256_mul_epu32 gives the full products.
+   The low and high halves are summed separately, and the 4 x 8 tile is
+   done as two 4 x 4 halves to keep the accumulators in registers.
+*/
+AVX2_TARGET void
+_nmod_mat_blocked_kernel_ui_avx2(slong kc, mp_srcptr Ap, mp_srcptr Bp,
+                                                         mp_ptr lo, mp_ptr hi)
+{
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i l0, l1, l2, l3, h0, h1, h2, h3, b, t;
+    mp_srcptr A, B;
+    slong p, half;
+
+    for (half = 0; half < 2; half++)
+    {
+        l0 = l1 = l2 = l3 = _mm256_setzero_si256();
+        h0 = h1 = h2 = h3 = _mm256_setzero_si256();
+
+        A = Ap;
+        B = Bp + 4*half;
+
+        for (p = 0; p < kc; p++, A += 4, B += 8)
+        {
+            b = _mm256_loadu_si256((const __m256i *) B);
+
+            t = _mm256_mul_epu32(_mm256_set1_epi64x(A[0]), b);
+            l0 = _mm256_add_epi64(l0, _mm256_and_si256(t, mask));
+            h0 = _mm256_add_epi64(h0, _mm256_srli_epi64(t, 32));
+
+            t = _mm256_mul_epu32(_mm256_set1_epi64x(A[1]), b);
+            l1 = _mm256_add_epi64(l1, _mm256_and_si256(t, mask));
+            h1 = _mm256_add_epi64(h1, _mm256_srli_epi64(t, 32));
+
+            t = _mm256_mul_epu32(_mm256_set1_epi64x(A[2]), b);
+            l2 = _mm256_add_epi64(l2, _mm256_and_si256(t, mask));
+            h2 = _mm256_add_epi64(h2, _mm256_srli_epi64(t, 32));
+
+            t = _mm256_mul_epu32(_mm256_set1_epi64x(A[3]), b);
+            l3 = _mm256_add_epi64(l3, _mm256_and_si256(t, mask));
+            h3 = _mm256_add_epi64(h3, _mm256_srli_epi64(t, 32));
+        }
+
+        _mm256_storeu_si256((__m256i *) (lo + 0 + 4*half), l0);
+        _mm256_storeu_si256((__m256i *) (lo + 8 + 4*half), l1);
+        _mm256_storeu_si256((__m256i *) (lo + 16 + 4*half), l2);
+        _mm256_storeu_si256((__m256i *) (lo + 24 + 4*half), l3);
+        _mm256_storeu_si256((__m256i *) (hi + 0 + 4*half), h0);
+        _mm256_storeu_si256((__m256i *) (hi + 8 + 4*half), h1);
+        _mm256_storeu_si256((__m256i *) (hi + 16 + 4*half), h2);
+        _mm256_storeu_si256((__m256i *) (hi + 24 + 4*half), h3);
+    }
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    slong dim;
+    mp_limb_t modulus;
+    int algorithm;
+} mat_lu_t;
+
+void sample(void * arg, ulong count)
+{
+    mat_lu_t * params = (mat_lu_t *) arg;
+    int algorithm = params->algorithm;
+    nmod_mat_t A, B, X;
+    slong * P;
+    ulong i;
+    flint_rand_t state;
+
+    flint_randinit(state);
+
+    nmod_mat_init(A, params->dim, params->dim, params->modulus);
+    nmod_mat_init(B, params->dim, params->dim, params->modulus);
+    nmod_mat_init(X, params->dim, params->dim, params->modulus);
+    P = flint_malloc(params->dim*sizeof(slong));
+
+    nmod_mat_randfull(A, state);
+    nmod_mat_randfull(B, state);
+
+    prof_start();
+
+    if (algorithm == 0)
+    {
+        for (i = 0; i < count; i++)
+        {
+            nmod_mat_set(X, A);
+            nmod_mat_lu(P, X, 0);
+        }
+    }
+    else if (algorithm == 1)
+    {
+        for (i = 0; i < count; i++)
+            nmod_mat_rank(A);
+    }
+    else
+    {
+        for (i = 0; i < count; i++)
+            nmod_mat_solve(X, A, B);
+    }
+
+    prof_stop();
+
+    flint_free(P);
+    nmod_mat_clear(A);
+    nmod_mat_clear(B);
+    nmod_mat_clear(X);
+
+    flint_randclear(state);
+}
+
+int main(void)
+{
+    double min, max;
+    mat_lu_t params;
+    slong dim, num_threads;
+
+    flint_printf("nmod_mat_lu, nmod_mat_rank, nmod_mat_solve:\n");
+
+    for (dim = 100; dim <= 3200; dim *= 2)
+    {
+        for (num_threads = 1; num_threads <= 8; num_threads *= 2)
+        {
+            flint_set_num_threads(num_threads);
+
+            params.dim = dim;
+            params.modulus = n_nextprime(UWORD(1) << 20, 0);
+
+            flint_printf("dim = %wd, threads = %wd:", dim, num_threads);
+
+            params.algorithm = 0;
+            prof_repeat(&min, &max, sample, &params);
+            flint_printf(" lu %.2f ms", min/1000);
+
+            params.algorithm = 1;
+            prof_repeat(&min, &max, sample, &params);
+            flint_printf(" rank %.2f ms", min/1000);
+
+            params.algorithm = 2;
+            prof_repeat(&min, &max, sample, &params);
+            flint_printf(" solve %.2f ms\n", min/1000);
+            fflush(stdout);
+        }
+    }
+
+    flint_set_num_threads(1);
+
+    return 0;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010,2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -14,33 +15,38 @@
 #include "flint.h"
 #include "nmod_mat.h"
 #include "nmod_vec.h"
+#include "thread_support.h"
 
-void
-nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U,
-                                                const nmod_mat_t B, int unit)
+/* number of multiplications from which the columns are split over threads */
+#define SOLVE_THREADED_CUTOFF 65536
+
+typedef struct
 {
+    nmod_mat_struct * X;
+    const nmod_mat_struct * U;
+    const nmod_mat_struct * B;
+    mp_srcptr inv;
     int nlimbs;
-    slong i, j, n, m;
-    nmod_t mod;
-    mp_ptr inv, tmp;
-
-    n = U->r;
-    m = B->c;
-    mod = U->mod;
+}
+_solve_triu_arg_struct;
 
-    if (!unit)
-    {
-        inv = _nmod_vec_init(n);
-        for (i = 0; i < n; i++)
-            inv[i] = n_invmod(nmod_mat_entry(U, i, i), mod.n);
-    }
-    else
-        inv = NULL;
+/* solve for the columns start, ..., stop - 1 of X */
+static void
+_solve_triu_worker(slong start, slong stop, void * varg)
+{
+    _solve_triu_arg_struct * arg = (_solve_triu_arg_struct *) varg;
+    nmod_mat_struct * X = arg->X;
+    const nmod_mat_struct * U = arg->U;
+    const nmod_mat_struct * B = arg->B;
+    mp_srcptr inv = arg->inv;
+    int nlimbs = arg->nlimbs;
+    nmod_t mod = U->mod;
+    slong i, j, n = U->r;
+    mp_ptr tmp;
 
-    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
     tmp = _nmod_vec_init(n);
 
-    for (i = 0; i < m; i++)
+    for (i = start; i < stop; i++)
     {
         for (j = 0; j < n; j++)
             tmp[j] = nmod_mat_entry(X, j, i);
@@ -51,7 +57,7 @@ nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U,
             s = _nmod_vec_dot(U->rows[j] + j + 1,
                               tmp + j + 1, n - j - 1, mod, nlimbs);
             s = nmod_sub(nmod_mat_entry(B, j, i), s, mod);
-            if (!unit)
+            if (inv != NULL)
                 s = n_mulmod2_preinv(s, inv[j], mod.n, mod.ninv);
             tmp[j] = s;
         }
@@ -61,6 +67,43 @@ nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U,
     }
 
     _nmod_vec_clear(tmp);
+}
+
+void
+nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U,
+                                                const nmod_mat_t B, int unit)
+{
+    _solve_triu_arg_struct arg;
+    slong i, n, m;
+    nmod_t mod;
+    mp_ptr inv;
+
+    n = U->r;
+    m = B->c;
+    mod = U->mod;
+
+    if (!unit)
+    {
+        inv = _nmod_vec_init(n);
+        for (i = 0; i < n; i++)
+            inv[i] = n_invmod(nmod_mat_entry(U, i, i), mod.n);
+    }
+    else
+        inv = NULL;
+
+    arg.X = X;
+    arg.U = U;
+    arg.B = B;
+    arg.inv = inv;
+    arg.nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+
+    if (m > 1 && n*n*m >= SOLVE_THREADED_CUTOFF && flint_get_num_threads() > 1)
+        flint_parallel_for(0, m,
+            FLINT_MAX(WORD(1), SOLVE_THREADED_CUTOFF/(4*n*n + 1)),
+                     _solve_triu_worker, &arg, flint_get_num_threads());
+    else
+        _solve_triu_worker(0, m, &arg);
+
     if (!unit)
         _nmod_vec_clear(inv);
 }
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -25,6 +26,14 @@ nmod_mat_submul(nmod_mat_t D, const nmod_mat_t C,
     k = A->c;
     n = B->c;
 
+    if (FLINT_BITS == 64 && A->mod.n <= UWORD(0xffffffff)
+        && FLINT_MIN(FLINT_MIN(m, k), n) >= NMOD_MAT_MUL_BLOCKED_CUTOFF
+        && FLINT_MAX(FLINT_MAX(m, k), n) < NMOD_MAT_MUL_BLOCKED_STRASSEN_CUTOFF)
+    {
+        _nmod_mat_mul_blocked_op(D, C, A, B, -1);
+        return;
+    }
+
     if (FLINT_BITS == 64 && C->mod.n < 2048)
         cutoff = 400;
     else
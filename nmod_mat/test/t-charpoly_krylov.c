@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong n, rep, i, j, c;
+    ulong mod;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("charpoly_krylov....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 200 * flint_test_multiplier(); rep++)
+    {
+        nmod_mat_t A;
+        nmod_poly_t f, g;
+
+        n = n_randint(state, 80);
+
+        if (n_randint(state, 2))
+            mod = n_randprime(state, 6, 0);
+        else
+            mod = n_randtest_prime(state, 0);
+
+        nmod_mat_init(A, n, n, mod);
+        nmod_poly_init(f, mod);
+        nmod_poly_init(g, mod);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                nmod_mat_randtest(A, state);
+                break;
+            case 1:
+                /* many repeated invariant factors */
+                for (i = 0; i < n; i++)
+                    nmod_mat_entry(A, i, i) = n_randint(state, 3);
+                for (i = 0; i < 4 && n != 0; i++)
+                    nmod_mat_similarity(A, n_randint(state, n),
+                                                     n_randint(state, mod));
+                break;
+            case 2:
+                /* block diagonal with small cyclic blocks */
+                j = n_randint(state, 4) + 1;
+                for (i = 0; i < n; i++)
+                {
+                    c = (i % j == j - 1 || i == n - 1) ? i - i % j : i + 1;
+                    nmod_mat_entry(A, i, c) = n_randint(state, mod);
+                }
+                break;
+            default:
+                nmod_mat_randrank(A, state, n_randint(state, n + 1));
+        }
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        nmod_mat_charpoly_danilevsky(f, A);
+        nmod_mat_charpoly_krylov(g, A);
+
+        if (!nmod_poly_equal(f, g))
+        {
+            flint_printf("FAIL: charpoly_krylov != charpoly_danilevsky.\n");
+            flint_printf("Matrix A:\n"), nmod_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("f = "), nmod_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("g = "), nmod_poly_print_pretty(g, "X"), flint_printf("\n");
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
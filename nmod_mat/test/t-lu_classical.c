@@ -16,6 +16,7 @@
 #include "nmod_vec.h"
 #include "nmod_mat.h"
 #include "ulong_extras.h"
+#include "thread_support.h"
 
 void perm(nmod_mat_t A, slong * P)
 {
@@ -148,6 +149,44 @@ main(void)
         }
     }
 
+    /* large enough for the elimination to be split over threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, LU;
+        mp_limb_t mod;
+        slong m, n, r, rank;
+        slong * P;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        m = n_randint(state, 300);
+        n = n_randint(state, 300);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_randrank(A, state, r);
+        nmod_mat_randops(A, n_randint(state, 2*m*n + 1), state);
+
+        nmod_mat_init_set(LU, A);
+        P = flint_malloc(sizeof(slong) * m);
+
+        rank = nmod_mat_lu_classical(P, LU, 0);
+
+        if (r != rank)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong rank (threaded)!\n");
+            abort();
+        }
+
+        check(P, LU, A, rank);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(LU);
+        flint_free(P);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
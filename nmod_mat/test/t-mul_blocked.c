@@ -0,0 +1,136 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_blocked....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D, E;
+        mp_limb_t mod;
+        slong m, k, n;
+        int op;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                mod = n_randtest_not_zero(state) % 64 + 1;
+                break;
+            case 1:
+                mod = n_randtest_bits(state,
+                          n_randint(state, NMOD_MAT_BLOCKED_DOUBLE_BITS) + 1);
+                break;
+            case 2:
+                mod = n_randtest_bits(state, n_randint(state,
+                           32 - NMOD_MAT_BLOCKED_DOUBLE_BITS)
+                                         + NMOD_MAT_BLOCKED_DOUBLE_BITS + 1);
+                break;
+            default:
+                mod = n_randtest_not_zero(state);
+        }
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 150);
+            k = n_randint(state, 600);
+            n = n_randint(state, 150);
+        }
+        else
+        {
+            m = n_randint(state, 50);
+            k = n_randint(state, 50);
+            n = n_randint(state, 50);
+        }
+
+        nmod_mat_init(A, m, k, mod);
+        nmod_mat_init(B, k, n, mod);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+        nmod_mat_init(E, m, n, mod);
+
+        if (n_randint(state, 2))
+        {
+            nmod_mat_randtest(A, state);
+            nmod_mat_randtest(B, state);
+        }
+        else
+        {
+            nmod_mat_randfull(A, state);
+            nmod_mat_randfull(B, state);
+        }
+
+        nmod_mat_randtest(C, state);
+        nmod_mat_randtest(D, state);
+
+        op = (int) n_randint(state, 3) - 1;
+
+        _nmod_mat_mul_classical_op(E, C, A, B, op);
+
+        if (n_randint(state, 2))
+        {
+            _nmod_mat_mul_blocked_op(D, C, A, B, op);
+        }
+        else
+        {
+            /* aliasing of D and C */
+            nmod_mat_set(D, C);
+            _nmod_mat_mul_blocked_op(D, D, A, B, op);
+        }
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, mod = %wu, op = %d\n",
+                                                           m, k, n, mod, op);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_mul_blocked(D, A, B);
+        nmod_mat_mul_classical(E, A, B);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: results not equal (mul)\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, mod = %wu\n",
+                                                               m, k, n, mod);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -4,6 +4,7 @@
     Copyright (C) 2011 Sebastian Pancratz
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2014 Ashish Kedia
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -47,6 +48,13 @@
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+#define NMOD_POLY_NTT_MUL_CUTOFF 8000           /* mul: KS -> NTT             */
+#define NMOD_POLY_SMALL_NTT_MUL_CUTOFF 32000    /* mul (small n): KS -> NTT   */
+#define NMOD_POLY_NTT_MULLOW_CUTOFF 2000        /* mullow: KS -> NTT          */
+#define NMOD_POLY_SMALL_NTT_MULLOW_CUTOFF 64000 /* mullow (small n): KS -> NTT */
+#define NMOD_POLY_MULMOD_PRECACHE_CUTOFF 512    /* mulmod: plain -> precached NTT */
+#define NMOD_POLY_SMALL_MULMOD_PRECACHE_CUTOFF 1024 /* mulmod (small n): plain -> precached NTT */
+
 NMOD_POLY_INLINE
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
 {
@@ -521,6 +529,99 @@ FLINT_DLL void nmod_poly_bit_pack(fmpz_t f, const nmod_poly_t poly,
 
 FLINT_DLL void nmod_poly_bit_unpack(nmod_poly_t poly, const fmpz_t f, flint_bitcnt_t bit_size);
 
+/* Number theoretic transforms  *********************************************/
+
+#define NMOD_POLY_NTT_NUM_PRIMES 3
+#define NMOD_POLY_NTT_PRIME_BITS 61  /* each prime exceeds 2^61 */
+#define NMOD_POLY_NTT_MAX_DEPTH 54
+
+FLINT_DLL extern const mp_limb_t nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES];
+
+typedef struct
+{
+    mp_limb_t p;
+    mp_limb_t pinv;
+    flint_bitcnt_t depth;
+    mp_ptr w;       /* twiddle factors in bit reversed order */
+    mp_ptr wpre;    /* precomputed quotients for Shoup multiplication */
+} nmod_poly_ntt_struct;
+
+typedef nmod_poly_ntt_struct nmod_poly_ntt_t[1];
+
+FLINT_DLL void nmod_poly_ntt_init(nmod_poly_ntt_t F, slong i,
+                                                        flint_bitcnt_t depth);
+
+FLINT_DLL void nmod_poly_ntt_init_prime(nmod_poly_ntt_t F, mp_limb_t p,
+                                                        flint_bitcnt_t depth);
+
+FLINT_DLL void nmod_poly_ntt_clear(nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_ntt_fwd(mp_ptr a, slong len,
+                             flint_bitcnt_t depth, const nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_ntt_inv(mp_ptr a,
+                             flint_bitcnt_t depth, const nmod_poly_ntt_t F);
+
+FLINT_DLL slong _nmod_poly_ntt_num_primes(flint_bitcnt_t bits, slong len);
+
+FLINT_DLL void _nmod_poly_ntt_mul(mp_ptr r, mp_srcptr poly1, slong len1,
+                       mp_srcptr poly2, slong len2, mp_ptr t,
+                       flint_bitcnt_t depth, const nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_ntt_crt(mp_ptr res, mp_ptr * r, slong np,
+                                                      slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_ntt_precache(mp_ptr b, mp_srcptr poly, slong len,
+                             flint_bitcnt_t depth, const nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_ntt_mul_precache(mp_ptr r, mp_srcptr poly1,
+       slong len1, mp_srcptr b, flint_bitcnt_t depth, const nmod_poly_ntt_t F);
+
+/* NTT precached multiplication  *********************************************/
+
+typedef struct
+{
+    slong len1;     /* maximum length of the other operand */
+    slong len2;
+    slong np;
+    flint_bitcnt_t depth;
+    nmod_poly_ntt_struct F[NMOD_POLY_NTT_NUM_PRIMES];
+    mp_ptr b[NMOD_POLY_NTT_NUM_PRIMES]; /* transforms of poly2 */
+    mp_ptr r[NMOD_POLY_NTT_NUM_PRIMES]; /* products before the CRT */
+    nmod_poly_t poly2;
+} nmod_poly_mul_precache_struct;
+
+typedef nmod_poly_mul_precache_struct nmod_poly_mul_precache_t[1];
+
+FLINT_DLL void _nmod_poly_mul_NTT_precache_init(nmod_poly_mul_precache_t pre,
+                      slong len1, mp_srcptr poly2, slong len2,
+                                            flint_bitcnt_t depth, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mul_NTT_precache_init(nmod_poly_mul_precache_t pre,
+                                       slong len1, const nmod_poly_t poly2);
+
+FLINT_DLL void nmod_poly_mul_precache_clear(nmod_poly_mul_precache_t pre);
+
+FLINT_DLL void _nmod_poly_mul_NTT_precache_cyclic(mp_ptr res, mp_srcptr poly1,
+                                 slong len1, nmod_poly_mul_precache_t pre);
+
+FLINT_DLL void _nmod_poly_mullow_NTT_precache(mp_ptr res, mp_srcptr poly1,
+                       slong len1, nmod_poly_mul_precache_t pre, slong n);
+
+FLINT_DLL void nmod_poly_mullow_NTT_precache(nmod_poly_t res,
+             const nmod_poly_t poly1, nmod_poly_mul_precache_t pre, slong n);
+
+typedef struct
+{
+    nmod_poly_t f;
+    nmod_poly_t finv;
+    nmod_poly_mul_precache_t pre_f;    /* f modulo x^L - 1, L >= lenf - 1 */
+    nmod_poly_mul_precache_t pre_finv; /* finv truncated to lenf - 2 terms */
+    int use_ntt; /* whether pre_f and pre_finv are initialised */
+} nmod_poly_mulmod_precache_struct;
+
+typedef nmod_poly_mulmod_precache_struct nmod_poly_mulmod_precache_t[1];
+
 /* Multiplication  ***********************************************************/
 
 FLINT_DLL void _nmod_poly_mul_classical(mp_ptr res, mp_srcptr poly1, slong len1, 
@@ -565,6 +666,18 @@ FLINT_DLL void _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
 FLINT_DLL void nmod_poly_mullow_KS(nmod_poly_t res, const nmod_poly_t poly1, 
                              const nmod_poly_t poly2, flint_bitcnt_t bits, slong n);
 
+FLINT_DLL void _nmod_poly_mul_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mul_NTT(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void _nmod_poly_mullow_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                           mp_srcptr poly2, slong len2, slong n, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mullow_NTT(nmod_poly_t res, const nmod_poly_t poly1,
+                                          const nmod_poly_t poly2, slong n);
+
 FLINT_DLL void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1, 
                                        mp_srcptr poly2, slong len2, nmod_t mod);
 
@@ -598,6 +711,20 @@ FLINT_DLL void nmod_poly_mulmod_preinv(nmod_poly_t res, const nmod_poly_t poly1,
                         const nmod_poly_t poly2, const nmod_poly_t f,
                         const nmod_poly_t finv);
 
+FLINT_DLL void nmod_poly_mulmod_precache_init(nmod_poly_mulmod_precache_t pre,
+                            const nmod_poly_t f, const nmod_poly_t finv);
+
+FLINT_DLL void nmod_poly_mulmod_precache_clear(
+                                          nmod_poly_mulmod_precache_t pre);
+
+FLINT_DLL void _nmod_poly_mulmod_preinv_precache(mp_ptr res,
+                 mp_srcptr poly1, slong len1, mp_srcptr poly2, slong len2,
+                                          nmod_poly_mulmod_precache_t pre);
+
+FLINT_DLL void nmod_poly_mulmod_preinv_precache(nmod_poly_t res,
+                       const nmod_poly_t poly1, const nmod_poly_t poly2,
+                                          nmod_poly_mulmod_precache_t pre);
+
 FLINT_DLL int _nmod_poly_invmod(mp_limb_t *A, 
                       const mp_limb_t *B, slong lenB, 
                       const mp_limb_t *P, slong lenP, const nmod_t mod);
@@ -1400,12 +1527,26 @@ FLINT_DLL void nmod_poly_inflate(nmod_poly_t result, const nmod_poly_t input,
 
 /* Characteristic polynomial and minimal polynomial */
 
+#define NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF 150
+#define NMOD_MAT_CHARPOLY_KRYLOV_SMALL_CUTOFF 64
+#define NMOD_MAT_CHARPOLY_KRYLOV_BLOCK 32
+#define NMOD_MAT_CHARPOLY_KRYLOV_BLOCK_RATIO 8
+
 FLINT_DLL void nmod_mat_charpoly_danilevsky(nmod_poly_t p, const nmod_mat_t M);
 
+FLINT_DLL void nmod_mat_charpoly_krylov(nmod_poly_t p, const nmod_mat_t M);
+
 NMOD_POLY_INLINE
 void nmod_mat_charpoly(nmod_poly_t p, const nmod_mat_t M)
 {
-   nmod_mat_charpoly_danilevsky(p, M);
+   slong cutoff = (M->mod.norm >= FLINT_BITS/2)
+                ? NMOD_MAT_CHARPOLY_KRYLOV_SMALL_CUTOFF
+                : NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF;
+
+   if (M->r >= cutoff)
+      nmod_mat_charpoly_krylov(p, M);
+   else
+      nmod_mat_charpoly_danilevsky(p, M);
 }
 
 FLINT_DLL void nmod_mat_minpoly_with_gens(nmod_poly_t p, 
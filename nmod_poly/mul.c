@@ -32,6 +32,9 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (3 * cutoff_len < 2 * FLINT_MAX(bits, 10))
         _nmod_poly_mul_classical(res, poly1, len1, poly2, len2, mod);
+    else if (cutoff_len >= (bits < 16 ? NMOD_POLY_SMALL_NTT_MUL_CUTOFF
+                                      : NMOD_POLY_NTT_MUL_CUTOFF))
+        _nmod_poly_mul_NTT(res, poly1, len1, poly2, len2, mod);
     else if (cutoff_len * bits < 800)
         _nmod_poly_mul_KS(res, poly1, len1, poly2, len2, 0, mod);
     else if (cutoff_len * (bits + 1) * (bits + 1) < 100000)
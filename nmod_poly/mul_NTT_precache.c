@@ -0,0 +1,142 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_mul_NTT_precache_init(nmod_poly_mul_precache_t pre,
+                      slong len1, mp_srcptr poly2, slong len2,
+                                             flint_bitcnt_t depth, nmod_t mod)
+{
+    slong i, n, terms;
+
+    depth = FLINT_MAX(depth, 1);
+    n = WORD(1) << depth;
+
+    FLINT_ASSERT(len1 <= n);
+    FLINT_ASSERT(depth <= NMOD_POLY_NTT_MAX_DEPTH);
+
+    /*
+        Each coefficient of the cyclic product is a sum of at most this
+        many products of coefficients of the inputs.
+    */
+    terms = FLINT_MIN(len1*((len2 + n - 1)/n), len2);
+
+    pre->len1 = len1;
+    pre->len2 = len2;
+    pre->depth = depth;
+    pre->np = _nmod_poly_ntt_num_primes(FLINT_BITS - mod.norm,
+                                                     FLINT_MAX(terms, 1));
+
+    FLINT_ASSERT(pre->np <= NMOD_POLY_NTT_NUM_PRIMES);
+
+    pre->b[0] = (mp_ptr) flint_malloc(2*pre->np*n*sizeof(mp_limb_t));
+    for (i = 0; i < pre->np; i++)
+    {
+        pre->b[i] = pre->b[0] + 2*i*n;
+        pre->r[i] = pre->b[i] + n;
+
+        nmod_poly_ntt_init(pre->F + i, i, depth);
+        _nmod_poly_ntt_precache(pre->b[i], poly2, len2, depth, pre->F + i);
+    }
+
+    nmod_poly_init2_preinv(pre->poly2, mod.n, mod.ninv, len2);
+    _nmod_vec_set(pre->poly2->coeffs, poly2, len2);
+    pre->poly2->length = len2;
+    _nmod_poly_normalise(pre->poly2);
+}
+
+void nmod_poly_mul_NTT_precache_init(nmod_poly_mul_precache_t pre,
+                                        slong len1, const nmod_poly_t poly2)
+{
+    const slong len2 = poly2->length;
+
+    _nmod_poly_mul_NTT_precache_init(pre, len1, poly2->coeffs, len2,
+              FLINT_CLOG2(FLINT_MAX(len1 + len2 - 1, 1)), poly2->mod);
+}
+
+void nmod_poly_mul_precache_clear(nmod_poly_mul_precache_t pre)
+{
+    slong i;
+
+    for (i = 0; i < pre->np; i++)
+        nmod_poly_ntt_clear(pre->F + i);
+
+    flint_free(pre->b[0]);
+    nmod_poly_clear(pre->poly2);
+}
+
+void _nmod_poly_mul_NTT_precache_cyclic(mp_ptr res, mp_srcptr poly1,
+                                  slong len1, nmod_poly_mul_precache_t pre)
+{
+    slong i;
+
+    FLINT_ASSERT(len1 <= pre->len1);
+
+    for (i = 0; i < pre->np; i++)
+        _nmod_poly_ntt_mul_precache(pre->r[i], poly1, len1, pre->b[i],
+                                                     pre->depth, pre->F + i);
+
+    _nmod_poly_ntt_crt(res, pre->r, pre->np, WORD(1) << pre->depth,
+                                                            pre->poly2->mod);
+}
+
+void _nmod_poly_mullow_NTT_precache(mp_ptr res, mp_srcptr poly1,
+                       slong len1, nmod_poly_mul_precache_t pre, slong n)
+{
+    slong i, lenr = len1 + pre->len2 - 1;
+
+    FLINT_ASSERT(len1 <= pre->len1);
+    FLINT_ASSERT(lenr <= (WORD(1) << pre->depth));
+
+    for (i = 0; i < pre->np; i++)
+        _nmod_poly_ntt_mul_precache(pre->r[i], poly1, len1, pre->b[i],
+                                                     pre->depth, pre->F + i);
+
+    _nmod_poly_ntt_crt(res, pre->r, pre->np, FLINT_MIN(n, lenr),
+                                                            pre->poly2->mod);
+
+    if (n > lenr)
+        flint_mpn_zero(res + lenr, n - lenr);
+}
+
+void nmod_poly_mullow_NTT_precache(nmod_poly_t res, const nmod_poly_t poly1,
+                                       nmod_poly_mul_precache_t pre, slong n)
+{
+    slong len1 = poly1->length, len_out;
+
+    len_out = len1 + pre->len2 - 1;
+    if (n > len_out)
+        n = len_out;
+
+    if (len1 == 0 || pre->len2 == 0 || n <= 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    /* the precached transform is too short for this product */
+    if (len1 > pre->len1 || len_out > (WORD(1) << pre->depth))
+    {
+        nmod_poly_mullow(res, poly1, pre->poly2, n);
+        return;
+    }
+
+    /* the inputs are transformed before the output is written */
+    nmod_poly_fit_length(res, n);
+    _nmod_poly_mullow_NTT_precache(res->coeffs, poly1->coeffs, len1, pre, n);
+
+    res->length = n;
+    _nmod_poly_normalise(res);
+}
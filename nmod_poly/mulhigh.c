@@ -18,7 +18,7 @@
 void _nmod_poly_mulhigh(mp_ptr res, mp_srcptr poly1, slong len1, 
                              mp_srcptr poly2, slong len2, slong n, nmod_t mod)
 {
-    slong bits, bits2;
+    slong bits, bits2, cutoff_len;
 
     if (len1 + len2 <= 6)
     {
@@ -29,8 +29,13 @@ void _nmod_poly_mulhigh(mp_ptr res, mp_srcptr poly1, slong len1,
     bits = FLINT_BITS - (slong) mod.norm;
     bits2 = FLINT_BIT_COUNT(len1);
 
+    cutoff_len = FLINT_MIN(len1, 2 * len2);
+
     if (2 * bits + bits2 <= FLINT_BITS && len1 + len2 < 16)
         _nmod_poly_mulhigh_classical(res, poly1, len1, poly2, len2, n, mod);
+    else if (cutoff_len >= (bits < 16 ? NMOD_POLY_SMALL_NTT_MUL_CUTOFF
+                                      : NMOD_POLY_NTT_MUL_CUTOFF))
+        _nmod_poly_mul_NTT(res, poly1, len1, poly2, len2, mod);
     else
         _nmod_poly_mul_KS(res, poly1, len1, poly2, len2, 0, mod);
 }
@@ -34,6 +34,9 @@ void _nmod_poly_mullow(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (n < 10 + bits * bits / 10)
         _nmod_poly_mullow_classical(res, poly1, len1, poly2, len2, n, mod);
+    else if (n >= (bits < 16 ? NMOD_POLY_SMALL_NTT_MULLOW_CUTOFF
+                             : NMOD_POLY_NTT_MULLOW_CUTOFF))
+        _nmod_poly_mullow_NTT(res, poly1, len1, poly2, len2, n, mod);
     else
         _nmod_poly_mullow_KS(res, poly1, len1, poly2, len2, 0, n, mod);
 }
@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_mullow_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                        mp_srcptr poly2, slong len2, slong n, nmod_t mod)
+{
+    slong i, np, lenr;
+    flint_bitcnt_t depth;
+    mp_ptr r[NMOD_POLY_NTT_NUM_PRIMES], t;
+    nmod_poly_ntt_t F;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+    lenr = len1 + len2 - 1;
+    depth = FLINT_MAX(FLINT_CLOG2(lenr), 1);
+
+    np = _nmod_poly_ntt_num_primes(FLINT_BITS - mod.norm,
+                                                    FLINT_MIN(len1, len2));
+
+    FLINT_ASSERT(np <= NMOD_POLY_NTT_NUM_PRIMES);
+    FLINT_ASSERT(depth <= NMOD_POLY_NTT_MAX_DEPTH);
+
+    r[0] = (mp_ptr) flint_malloc(((np + 1) << depth)*sizeof(mp_limb_t));
+    for (i = 1; i < np; i++)
+        r[i] = r[i - 1] + (WORD(1) << depth);
+    t = r[np - 1] + (WORD(1) << depth);
+
+    for (i = 0; i < np; i++)
+    {
+        nmod_poly_ntt_init(F, i, depth);
+        _nmod_poly_ntt_mul(r[i], poly1, len1, poly2, len2, t, depth, F);
+        nmod_poly_ntt_clear(F);
+    }
+
+    _nmod_poly_ntt_crt(res, r, np, FLINT_MIN(n, lenr), mod);
+
+    if (n > lenr)
+        flint_mpn_zero(res + lenr, n - lenr);
+
+    flint_free(r[0]);
+}
+
+void nmod_poly_mullow_NTT(nmod_poly_t res, const nmod_poly_t poly1,
+                                        const nmod_poly_t poly2, slong n)
+{
+    slong len1, len2, len_out;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    len_out = len1 + len2 - 1;
+    if (n > len_out)
+        n = len_out;
+
+    if (len1 == 0 || len2 == 0 || n <= 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+
+        nmod_poly_init2(temp, poly1->mod.n, n);
+
+        _nmod_poly_mullow_NTT(temp->coeffs, poly1->coeffs, len1,
+                              poly2->coeffs, len2, n, poly1->mod);
+
+        nmod_poly_swap(temp, res);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, n);
+
+        _nmod_poly_mullow_NTT(res->coeffs, poly1->coeffs, len1,
+                              poly2->coeffs, len2, n, poly1->mod);
+    }
+
+    res->length = n;
+    _nmod_poly_normalise(res);
+}
@@ -0,0 +1,151 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void nmod_poly_mulmod_precache_init(nmod_poly_mulmod_precache_t pre,
+                                const nmod_poly_t f, const nmod_poly_t finv)
+{
+    const slong lenf = f->length;
+    slong leninv, bits, cutoff;
+
+    nmod_poly_init_preinv(pre->f, f->mod.n, f->mod.ninv);
+    nmod_poly_init_preinv(pre->finv, f->mod.n, f->mod.ninv);
+    nmod_poly_set(pre->f, f);
+    nmod_poly_set(pre->finv, finv);
+
+    bits = FLINT_BITS - (slong) f->mod.norm;
+    cutoff = (bits < 16) ? NMOD_POLY_SMALL_MULMOD_PRECACHE_CUTOFF
+                         : NMOD_POLY_MULMOD_PRECACHE_CUTOFF;
+
+    pre->use_ntt = (lenf >= FLINT_MAX(cutoff, 3));
+
+    if (pre->use_ntt)
+    {
+        /*
+            The quotient has at most lenf - 2 terms, so only that many
+            terms of finv are needed. The remainder is recovered from the
+            product of the quotient and f modulo x^L - 1 for L >= lenf - 1.
+        */
+        leninv = FLINT_MIN(finv->length, lenf - 2);
+
+        _nmod_poly_mul_NTT_precache_init(pre->pre_finv, lenf - 2,
+                     finv->coeffs, leninv, FLINT_CLOG2(lenf + leninv - 3),
+                                                                   f->mod);
+        _nmod_poly_mul_NTT_precache_init(pre->pre_f, lenf - 2,
+                     f->coeffs, lenf, FLINT_CLOG2(lenf - 1), f->mod);
+    }
+}
+
+void nmod_poly_mulmod_precache_clear(nmod_poly_mulmod_precache_t pre)
+{
+    if (pre->use_ntt)
+    {
+        nmod_poly_mul_precache_clear(pre->pre_f);
+        nmod_poly_mul_precache_clear(pre->pre_finv);
+    }
+
+    nmod_poly_clear(pre->f);
+    nmod_poly_clear(pre->finv);
+}
+
+void _nmod_poly_mulmod_preinv_precache(mp_ptr res, mp_srcptr poly1,
+                       slong len1, mp_srcptr poly2, slong len2,
+                                          nmod_poly_mulmod_precache_t pre)
+{
+    const slong lenf = pre->f->length;
+    const nmod_t mod = pre->f->mod;
+    mp_ptr T, Q, C;
+    slong lenT, lenQ, L;
+
+    if (!pre->use_ntt)
+    {
+        _nmod_poly_mulmod_preinv(res, poly1, len1, poly2, len2,
+             pre->f->coeffs, lenf, pre->finv->coeffs, pre->finv->length, mod);
+        return;
+    }
+
+    lenT = len1 + len2 - 1;
+    lenQ = lenT - lenf + 1;
+    L = WORD(1) << pre->pre_f->depth;
+
+    T = _nmod_vec_init(lenT + lenQ + L);
+    Q = T + lenT;
+    C = Q + lenQ;
+
+    if (len1 >= len2)
+        _nmod_poly_mul(T, poly1, len1, poly2, len2, mod);
+    else
+        _nmod_poly_mul(T, poly2, len2, poly1, len1, mod);
+
+    /* Q = rev(rev(T)*finv mod x^lenQ) */
+    _nmod_poly_reverse(Q, T + lenT - lenQ, lenQ, lenQ);
+    _nmod_poly_mullow_NTT_precache(Q, Q, lenQ, pre->pre_finv, lenQ);
+    _nmod_poly_reverse(Q, Q, lenQ, lenQ);
+
+    /*
+        C = Q*f mod x^L - 1. As Q*f = T - res agrees with T from x^(lenf - 1)
+        on and lenT <= 2L, the coefficient of x^j in C is Q*f[j] + T[j + L]
+        for j < lenf - 1.
+    */
+    _nmod_poly_mul_NTT_precache_cyclic(C, Q, lenQ, pre->pre_f);
+
+    _nmod_vec_sub(res, T, C, lenf - 1, mod);
+    if (lenT > L)
+        _nmod_vec_add(res, res, T + L, lenT - L, mod);
+
+    _nmod_vec_clear(T);
+}
+
+void
+nmod_poly_mulmod_preinv_precache(nmod_poly_t res, const nmod_poly_t poly1,
+                     const nmod_poly_t poly2, nmod_poly_mulmod_precache_t pre)
+{
+    slong len1, len2, lenf;
+
+    lenf = pre->f->length;
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    if (lenf == 0)
+    {
+        flint_printf("Exception (nmod_poly_mulmod_preinv_precache). Divide by zero.\n");
+        flint_abort();
+    }
+
+    if (lenf <= len1 || lenf <= len2)
+    {
+        flint_printf("Exception (nmod_poly_mulmod_preinv_precache). Input larger than modulus.\n");
+        flint_abort();
+    }
+
+    if (lenf == 1 || len1 == 0 || len2 == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    if (len1 + len2 - lenf > 0)
+    {
+        nmod_poly_fit_length(res, lenf - 1);
+        _nmod_poly_mulmod_preinv_precache(res->coeffs, poly1->coeffs, len1,
+                                                 poly2->coeffs, len2, pre);
+        res->length = lenf - 1;
+        _nmod_poly_normalise(res);
+    }
+    else
+    {
+        nmod_poly_mul(res, poly1, poly2);
+    }
+}
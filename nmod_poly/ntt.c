@@ -0,0 +1,563 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Primes p = c*2^k + 1 with 2^61 < p < 2^62 and k >= NMOD_POLY_NTT_MAX_DEPTH,
+    together with a quadratic nonresidue modulo each prime. Since 4p < 2^64
+    the butterflies below may keep their values in [0, 4p) without overflow.
+    The first prime is less than twice each of the others, which simplifies
+    the CRT.
+*/
+const mp_limb_t nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(0x3a00000000000001), UWORD(0x2280000000000001),
+    UWORD(0x2c40000000000001)
+};
+
+static const mp_limb_t nmod_poly_ntt_nonresidues[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    3, 5, 7
+};
+
+/*
+    The forward transform evaluates a polynomial of length 2^depth at the
+    roots of x^(2^depth) - 1 and writes the values in bit reversed order.
+    The block with index b at any level of the transform splits its
+    modulus x^(2m) - w[b]^2 into x^m - w[b] and x^m + w[b], where
+    w[b] = r^brev(b) for a primitive 2^depth-th root of unity r. The
+    table w is thus independent of the level and is generated via
+    w[2^j + i] = w[i]*w[2^j].
+
+    The entries w[2^j], ..., w[2^(j+1) - 1] are the odd powers of the
+    primitive 2^(j+2)-th root of unity w[2^j], whence the inverse of
+    w[2^j + i] is -w[2^(j+1) - 1 - i] and no separate table of inverses
+    is required.
+*/
+static void
+_nmod_poly_ntt_init(nmod_poly_ntt_t F, mp_limb_t p, mp_limb_t a,
+                                                        flint_bitcnt_t depth)
+{
+    mp_limb_t pinv, pnorm, r, g, gpre, rem;
+    slong j, k, half;
+    flint_bitcnt_t norm;
+
+    depth = FLINT_MAX(depth, 1);
+    half = WORD(1) << (depth - 1);
+
+    pinv = n_preinvert_limb(p);
+    count_leading_zeros(norm, p);
+    pnorm = p << norm;
+
+    F->p = p;
+    F->pinv = pinv;
+    F->depth = depth;
+    F->w = (mp_ptr) flint_malloc(2*half*sizeof(mp_limb_t));
+    F->wpre = F->w + half;
+
+    /* primitive 2^depth-th root of unity */
+    r = n_powmod2_ui_preinv(a, (p - 1) >> depth, p, pinv);
+
+    F->w[0] = 1;
+    F->wpre[0] = n_mulmod_precomp_shoup(1, p);
+
+    for (j = 1; j < half; j *= 2)
+    {
+        /* w[j] is a primitive 4j-th root of unity */
+        g = r;
+        for (k = 4*j; k < (WORD(1) << depth); k *= 2)
+            g = n_mulmod2_preinv(g, g, p, pinv);
+
+        gpre = n_mulmod_precomp_shoup(g, p);
+
+        for (k = 0; k < j; k++)
+        {
+            F->w[j + k] = n_mulmod_shoup(g, F->w[k], gpre, p);
+
+            /* wpre = floor(w*2^FLINT_BITS/p) */
+            udiv_qrnnd_preinv(F->wpre[j + k], rem,
+                              F->w[j + k] << norm, UWORD(0), pnorm, pinv);
+        }
+    }
+}
+
+void nmod_poly_ntt_init(nmod_poly_ntt_t F, slong i, flint_bitcnt_t depth)
+{
+    FLINT_ASSERT(i >= 0 && i < NMOD_POLY_NTT_NUM_PRIMES);
+    FLINT_ASSERT(depth <= NMOD_POLY_NTT_MAX_DEPTH);
+
+    _nmod_poly_ntt_init(F, nmod_poly_ntt_primes[i],
+                                        nmod_poly_ntt_nonresidues[i], depth);
+}
+
+void nmod_poly_ntt_init_prime(nmod_poly_ntt_t F, mp_limb_t p,
+                                                        flint_bitcnt_t depth)
+{
+    mp_limb_t a, pinv = n_preinvert_limb(p);
+
+    FLINT_ASSERT(p > (UWORD(1) << (FLINT_BITS - 3)));
+    FLINT_ASSERT(p < (UWORD(1) << (FLINT_BITS - 2)));
+    FLINT_ASSERT(((p - 1) & ((UWORD(1) << FLINT_MAX(depth, 1)) - 1)) == 0);
+
+    /* a quadratic nonresidue */
+    for (a = 3; n_powmod2_ui_preinv(a, (p - 1)/2, p, pinv) == 1; a++) ;
+
+    _nmod_poly_ntt_init(F, p, a, depth);
+}
+
+void nmod_poly_ntt_clear(nmod_poly_ntt_t F)
+{
+    flint_free(F->w);
+}
+
+/* t = w*y mod p, in [0, 2p), for any y < 2^FLINT_BITS */
+#define NTT_MULMOD_SHOUP_LAZY(t, w, wpre, y, p)  \
+    do {                                         \
+        mp_limb_t __q, __lo;                     \
+        umul_ppmm(__q, __lo, (wpre), (y));       \
+        (t) = (w)*(y) - __q*(p);                 \
+    } while (0)
+
+/* transforms of at most this length are done breadth first */
+#define NTT_BLOCK_LEN 1024
+
+/*
+    Forward butterflies (Cooley-Tukey), inputs and outputs in [0, 4p):
+
+        x, y  ->  x + w*y, x - w*y
+*/
+static void
+_ntt_fwd_iter(mp_ptr a, slong n, slong b, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    slong m, j, k, nb;
+
+    for (m = n/2, nb = 1; m >= 1; m /= 2, nb *= 2, b *= 2)
+    {
+        for (k = 0; k < nb; k++)
+        {
+            mp_ptr x = a + 2*k*m, y = x + m;
+            const mp_limb_t w = F->w[b + k], wpre = F->wpre[b + k];
+
+            if (b + k == 0)
+            {
+                for (j = 0; j < m; j++)
+                {
+                    mp_limb_t u = x[j], t = y[j];
+                    u -= (u >= p2) ? p2 : 0;
+                    t -= (t >= p2) ? p2 : 0;
+                    x[j] = u + t;
+                    y[j] = u - t + p2;
+                }
+            }
+            else
+            {
+                for (j = 0; j < m; j++)
+                {
+                    mp_limb_t u = x[j], t;
+                    u -= (u >= p2) ? p2 : 0;
+                    NTT_MULMOD_SHOUP_LAZY(t, w, wpre, y[j], p);
+                    x[j] = u + t;
+                    y[j] = u - t + p2;
+                }
+            }
+        }
+    }
+}
+
+static void
+_ntt_fwd_rec(mp_ptr a, slong n, slong len, slong b, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    const mp_limb_t w = F->w[b], wpre = F->wpre[b];
+    mp_ptr y;
+    slong j, m;
+
+    if (n <= NTT_BLOCK_LEN)
+    {
+        flint_mpn_zero(a + len, n - len);
+        _ntt_fwd_iter(a, n, b, F);
+        return;
+    }
+
+    m = n/2;
+    y = a + m;
+
+    if (len <= m)
+    {
+        /* the top half is zero, so the butterflies only copy */
+        flint_mpn_copyi(y, a, len);
+        _ntt_fwd_rec(a, m, len, 2*b, F);
+        _ntt_fwd_rec(y, m, len, 2*b + 1, F);
+        return;
+    }
+
+    if (n >= 4*NTT_BLOCK_LEN)
+    {
+        /* two layers at once, to halve the passes over memory */
+        const slong q = n/4;
+        const mp_limb_t w2 = F->w[2*b], w2pre = F->wpre[2*b];
+        const mp_limb_t w3 = F->w[2*b + 1], w3pre = F->wpre[2*b + 1];
+
+        flint_mpn_zero(a + len, n - len);
+
+        for (j = 0; j < q; j++)
+        {
+            mp_limb_t x0 = a[j], x1 = a[j + q], x2, x3, t;
+
+            x0 -= (x0 >= p2) ? p2 : 0;
+            x1 -= (x1 >= p2) ? p2 : 0;
+            NTT_MULMOD_SHOUP_LAZY(t, w, wpre, a[j + 2*q], p);
+            x2 = x0 - t + p2;
+            x0 = x0 + t;
+            NTT_MULMOD_SHOUP_LAZY(t, w, wpre, a[j + 3*q], p);
+            x3 = x1 - t + p2;
+            x1 = x1 + t;
+
+            x0 -= (x0 >= p2) ? p2 : 0;
+            x2 -= (x2 >= p2) ? p2 : 0;
+            NTT_MULMOD_SHOUP_LAZY(t, w2, w2pre, x1, p);
+            a[j] = x0 + t;
+            a[j + q] = x0 - t + p2;
+            NTT_MULMOD_SHOUP_LAZY(t, w3, w3pre, x3, p);
+            a[j + 2*q] = x2 + t;
+            a[j + 3*q] = x2 - t + p2;
+        }
+
+        for (j = 0; j < 4; j++)
+            _ntt_fwd_rec(a + j*q, q, q, 4*b + j, F);
+
+        return;
+    }
+
+    for (j = 0; j < len - m; j++)
+    {
+        mp_limb_t u = a[j], t;
+        u -= (u >= p2) ? p2 : 0;
+        NTT_MULMOD_SHOUP_LAZY(t, w, wpre, y[j], p);
+        a[j] = u + t;
+        y[j] = u - t + p2;
+    }
+
+    for ( ; j < m; j++)
+        y[j] = a[j];
+
+    _ntt_fwd_rec(a, m, m, 2*b, F);
+    _ntt_fwd_rec(y, m, m, 2*b + 1, F);
+}
+
+void _nmod_poly_ntt_fwd(mp_ptr a, slong len, flint_bitcnt_t depth,
+                                                      const nmod_poly_ntt_t F)
+{
+    FLINT_ASSERT(depth <= F->depth);
+    FLINT_ASSERT(len <= (WORD(1) << depth));
+
+    _ntt_fwd_rec(a, WORD(1) << depth, len, 0, F);
+}
+
+/*
+    Inverse butterflies (Gentleman-Sande), inputs and outputs in [0, 2p):
+
+        x, y  ->  x + y, (x - y)/w[b] = (y - x)*w[_ntt_inv_index(b)]
+*/
+static __inline__ slong
+_ntt_inv_index(slong b)
+{
+    slong h = WORD(1) << (FLINT_BIT_COUNT(b) - 1);
+    return 3*h - 1 - b;
+}
+
+static void
+_ntt_inv_iter(mp_ptr a, slong n, slong b, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    slong m, j, k, nb;
+
+    for (m = 1, nb = n/2; nb >= 1; m *= 2, nb /= 2)
+    {
+        const slong bb = b*nb;
+
+        for (k = 0; k < nb; k++)
+        {
+            mp_ptr x = a + 2*k*m, y = x + m;
+
+            if (bb + k == 0)
+            {
+                for (j = 0; j < m; j++)
+                {
+                    mp_limb_t u = x[j], v = y[j], s, t;
+                    s = u + v;
+                    s -= (s >= p2) ? p2 : 0;
+                    t = u - v + p2;
+                    t -= (t >= p2) ? p2 : 0;
+                    x[j] = s;
+                    y[j] = t;
+                }
+            }
+            else
+            {
+                const slong c = _ntt_inv_index(bb + k);
+                const mp_limb_t w = F->w[c], wpre = F->wpre[c];
+
+                for (j = 0; j < m; j++)
+                {
+                    mp_limb_t u = x[j], v = y[j], s, t;
+                    s = u + v;
+                    s -= (s >= p2) ? p2 : 0;
+                    x[j] = s;
+                    NTT_MULMOD_SHOUP_LAZY(t, w, wpre, v - u + p2, p);
+                    y[j] = t;
+                }
+            }
+        }
+    }
+}
+
+/* inverse twiddle for block b, negated unless b = 0 where it is -1 */
+static __inline__ void
+_ntt_inv_twiddle(mp_limb_t * w, mp_limb_t * wpre, slong b,
+                                                      const nmod_poly_ntt_t F)
+{
+    if (b == 0)
+    {
+        *w = F->p - 1;
+        *wpre = n_mulmod_precomp_shoup(F->p - 1, F->p);
+    }
+    else
+    {
+        *w = F->w[_ntt_inv_index(b)];
+        *wpre = F->wpre[_ntt_inv_index(b)];
+    }
+}
+
+static void
+_ntt_inv_rec(mp_ptr a, slong n, slong b, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    mp_limb_t w, wpre;
+    mp_ptr y;
+    slong j, m;
+
+    if (n <= NTT_BLOCK_LEN)
+    {
+        _ntt_inv_iter(a, n, b, F);
+        return;
+    }
+
+    _ntt_inv_twiddle(&w, &wpre, b, F);
+
+    if (n >= 4*NTT_BLOCK_LEN)
+    {
+        const slong q = n/4;
+        mp_limb_t w2, w2pre, w3, w3pre;
+
+        _ntt_inv_twiddle(&w2, &w2pre, 2*b, F);
+        _ntt_inv_twiddle(&w3, &w3pre, 2*b + 1, F);
+
+        for (j = 0; j < 4; j++)
+            _ntt_inv_rec(a + j*q, q, 4*b + j, F);
+
+        for (j = 0; j < q; j++)
+        {
+            mp_limb_t x0 = a[j], x1 = a[j + q], x2 = a[j + 2*q],
+                      x3 = a[j + 3*q], s, t, u, v;
+
+            s = x0 + x1;
+            s -= (s >= p2) ? p2 : 0;
+            NTT_MULMOD_SHOUP_LAZY(t, w2, w2pre, x1 - x0 + p2, p);
+            u = x2 + x3;
+            u -= (u >= p2) ? p2 : 0;
+            NTT_MULMOD_SHOUP_LAZY(v, w3, w3pre, x3 - x2 + p2, p);
+
+            x0 = s + u;
+            a[j] = x0 - ((x0 >= p2) ? p2 : 0);
+            NTT_MULMOD_SHOUP_LAZY(a[j + 2*q], w, wpre, u - s + p2, p);
+            x1 = t + v;
+            a[j + q] = x1 - ((x1 >= p2) ? p2 : 0);
+            NTT_MULMOD_SHOUP_LAZY(a[j + 3*q], w, wpre, v - t + p2, p);
+        }
+
+        return;
+    }
+
+    m = n/2;
+    y = a + m;
+
+    _ntt_inv_rec(a, m, 2*b, F);
+    _ntt_inv_rec(y, m, 2*b + 1, F);
+
+    for (j = 0; j < m; j++)
+    {
+        mp_limb_t u = a[j], v = y[j], s, t;
+        s = u + v;
+        s -= (s >= p2) ? p2 : 0;
+        a[j] = s;
+        NTT_MULMOD_SHOUP_LAZY(t, w, wpre, v - u + p2, p);
+        y[j] = t;
+    }
+}
+
+void _nmod_poly_ntt_inv(mp_ptr a, flint_bitcnt_t depth,
+                                                      const nmod_poly_ntt_t F)
+{
+    FLINT_ASSERT(depth <= F->depth);
+
+    _ntt_inv_rec(a, WORD(1) << depth, 0, F);
+}
+
+slong _nmod_poly_ntt_num_primes(flint_bitcnt_t bits, slong len)
+{
+    flint_bitcnt_t b = 2*bits + FLINT_CLOG2(len);
+    slong np = (b + NMOD_POLY_NTT_PRIME_BITS - 1)/NMOD_POLY_NTT_PRIME_BITS;
+
+    return FLINT_MAX(np, 1);
+}
+
+/*
+    Sets r to poly1*poly2 modulo the prime of F, with coefficients reduced
+    to [0, p). The array r must have space for 2^depth coefficients and t
+    is scratch space for 2^depth coefficients, where 2^depth >= len1 +
+    len2 - 1. The inputs may have arbitrary word sized coefficients.
+*/
+void _nmod_poly_ntt_mul(mp_ptr r, mp_srcptr poly1, slong len1,
+                        mp_srcptr poly2, slong len2, mp_ptr t,
+                        flint_bitcnt_t depth, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    const slong n = WORD(1) << depth;
+    const int sqr = (poly1 == poly2 && len1 == len2);
+    mp_limb_t one_pre, s, spre;
+    nmod_t mod;
+    slong i;
+
+    FLINT_ASSERT(len1 + len2 - 1 <= n);
+
+    nmod_init(&mod, p);
+    one_pre = n_mulmod_precomp_shoup(1, p);
+
+    /* scale by 2^-depth after the pointwise products */
+    s = n_invmod(n_powmod2_ui_preinv(2, depth, p, F->pinv), p);
+    spre = n_mulmod_precomp_shoup(s, p);
+
+    for (i = 0; i < len1; i++)
+        NTT_MULMOD_SHOUP_LAZY(r[i], UWORD(1), one_pre, poly1[i], p);
+
+    _nmod_poly_ntt_fwd(r, len1, depth, F);
+
+    if (!sqr)
+    {
+        for (i = 0; i < len2; i++)
+            NTT_MULMOD_SHOUP_LAZY(t[i], UWORD(1), one_pre, poly2[i], p);
+
+        _nmod_poly_ntt_fwd(t, len2, depth, F);
+    }
+    else
+        t = r;
+
+    for (i = 0; i < n; i++)
+    {
+        mp_limb_t u = r[i], v = t[i], hi, lo;
+
+        u -= (u >= p2) ? p2 : 0;
+        u -= (u >= p) ? p : 0;
+        v -= (v >= p2) ? p2 : 0;
+        v -= (v >= p) ? p : 0;
+        umul_ppmm(hi, lo, u, v);
+        NMOD_RED2(u, hi, lo, mod);
+        NTT_MULMOD_SHOUP_LAZY(r[i], s, spre, u, p);
+    }
+
+    _nmod_poly_ntt_inv(r, depth, F);
+
+    for (i = 0; i < len1 + len2 - 1; i++)
+        r[i] -= (r[i] >= p) ? p : 0;
+}
+
+/*
+    Sets b to the transform of (poly, len) reduced modulo x^(2^depth) - 1,
+    scaled by 2^-depth and with values in [0, p), as required by
+    _nmod_poly_ntt_mul_precache. The array b must have space for 2^depth
+    coefficients. The input may have arbitrary word sized coefficients.
+*/
+void _nmod_poly_ntt_precache(mp_ptr b, mp_srcptr poly, slong len,
+                             flint_bitcnt_t depth, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p;
+    const slong n = WORD(1) << depth;
+    mp_limb_t one_pre, s, spre, t;
+    slong i;
+
+    one_pre = n_mulmod_precomp_shoup(1, p);
+
+    s = n_invmod(n_powmod2_ui_preinv(2, depth, p, F->pinv), p);
+    spre = n_mulmod_precomp_shoup(s, p);
+
+    flint_mpn_zero(b, n);
+
+    for (i = 0; i < len; i++)
+    {
+        NTT_MULMOD_SHOUP_LAZY(t, UWORD(1), one_pre, poly[i], p);
+        t -= (t >= p) ? p : 0;
+        t = b[i & (n - 1)] + t;
+        b[i & (n - 1)] = t - ((t >= p) ? p : 0);
+    }
+
+    _nmod_poly_ntt_fwd(b, FLINT_MIN(len, n), depth, F);
+
+    for (i = 0; i < n; i++)
+        b[i] = n_mulmod_shoup(s, b[i], spre, p);
+}
+
+/*
+    Sets r to the product of (poly1, len1) by the polynomial whose transform
+    was computed by _nmod_poly_ntt_precache, modulo x^(2^depth) - 1 and the
+    prime of F. All 2^depth coefficients of r are reduced to [0, p). We
+    require len1 <= 2^depth.
+*/
+void _nmod_poly_ntt_mul_precache(mp_ptr r, mp_srcptr poly1, slong len1,
+              mp_srcptr b, flint_bitcnt_t depth, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    const slong n = WORD(1) << depth;
+    mp_limb_t one_pre;
+    nmod_t mod;
+    slong i;
+
+    FLINT_ASSERT(len1 <= n);
+
+    nmod_init(&mod, p);
+    one_pre = n_mulmod_precomp_shoup(1, p);
+
+    for (i = 0; i < len1; i++)
+        NTT_MULMOD_SHOUP_LAZY(r[i], UWORD(1), one_pre, poly1[i], p);
+
+    _nmod_poly_ntt_fwd(r, len1, depth, F);
+
+    for (i = 0; i < n; i++)
+    {
+        mp_limb_t u = r[i], hi, lo;
+
+        u -= (u >= p2) ? p2 : 0;
+        u -= (u >= p) ? p : 0;
+        umul_ppmm(hi, lo, u, b[i]);
+        NMOD_RED2(r[i], hi, lo, mod);
+    }
+
+    _nmod_poly_ntt_inv(r, depth, F);
+
+    for (i = 0; i < n; i++)
+        r[i] -= (r[i] >= p) ? p : 0;
+}
@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Sets res[i] to the residue modulo mod.n of the integer with residues
+    r[j][i] modulo the first np NTT primes, for 0 <= i < len, using Garner's
+    algorithm. The integer is recovered as r0 + p0*t1 + p0*p1*t2, which is
+    then reduced modulo mod.n without being formed explicitly. We rely on
+    p0 < 2*p1 and p0 < 2*p2, so that r0 is reduced by a single subtraction.
+*/
+void _nmod_poly_ntt_crt(mp_ptr res, mp_ptr * r, slong np, slong len,
+                                                                   nmod_t mod)
+{
+    const mp_limb_t * p = nmod_poly_ntt_primes;
+    slong i;
+
+    if (np == 1)
+    {
+        for (i = 0; i < len; i++)
+            NMOD_RED(res[i], r[0][i], mod);
+    }
+    else if (np == 2)
+    {
+        mp_limb_t c1, c1pre, p0n, hi, lo;
+
+        c1 = n_invmod(p[0] % p[1], p[1]);
+        c1pre = n_mulmod_precomp_shoup(c1, p[1]);
+        NMOD_RED(p0n, p[0], mod);
+
+        for (i = 0; i < len; i++)
+        {
+            mp_limb_t a0 = r[0][i], t1;
+
+            t1 = r[1][i] + p[1] - (a0 - ((a0 >= p[1]) ? p[1] : 0));
+            t1 = n_mulmod_shoup(c1, t1, c1pre, p[1]);
+
+            umul_ppmm(hi, lo, p0n, t1);
+            add_ssaaaa(hi, lo, hi, lo, UWORD(0), a0);
+            NMOD_RED2(res[i], hi, lo, mod);
+        }
+    }
+    else
+    {
+        mp_limb_t c1, c1pre, c2, c2pre, p0p2, p0p2pre, p0n, p0p1n, hi, lo;
+
+        FLINT_ASSERT(np == 3);
+
+        c1 = n_invmod(p[0] % p[1], p[1]);
+        c1pre = n_mulmod_precomp_shoup(c1, p[1]);
+        p0p2 = p[0] % p[2];
+        p0p2pre = n_mulmod_precomp_shoup(p0p2, p[2]);
+        c2 = n_invmod(n_mulmod2(p0p2, p[1] % p[2], p[2]), p[2]);
+        c2pre = n_mulmod_precomp_shoup(c2, p[2]);
+        NMOD_RED(p0n, p[0], mod);
+        p0p1n = nmod_mul(p0n, n_mod2_preinv(p[1], mod.n, mod.ninv), mod);
+
+        for (i = 0; i < len; i++)
+        {
+            mp_limb_t a0 = r[0][i], t1, t2, u;
+
+            t1 = r[1][i] + p[1] - (a0 - ((a0 >= p[1]) ? p[1] : 0));
+            t1 = n_mulmod_shoup(c1, t1, c1pre, p[1]);
+
+            u = a0 - ((a0 >= p[2]) ? p[2] : 0);
+            u += n_mulmod_shoup(p0p2, t1, p0p2pre, p[2]);
+            u -= (u >= p[2]) ? p[2] : 0;
+            t2 = r[2][i] + p[2] - u;
+            t2 = n_mulmod_shoup(c2, t2, c2pre, p[2]);
+
+            umul_ppmm(hi, lo, p0n, t1);
+            add_ssaaaa(hi, lo, hi, lo, UWORD(0), a0);
+            NMOD_RED2(u, hi, lo, mod);
+            umul_ppmm(hi, lo, p0p1n, t2);
+            add_ssaaaa(hi, lo, hi, lo, UWORD(0), u);
+            NMOD_RED2(res[i], hi, lo, mod);
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mullow_NTT_precache....");
+    fflush(stdout);
+
+    /* Compare with mullow_classical, several products for each precache */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, d;
+        nmod_poly_mul_precache_t pre;
+        mp_limb_t n = n_randtest_not_zero(state);
+        slong len1, trunc, k;
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+
+        len1 = 1 + n_randint(state, 300);
+        nmod_poly_randtest(c, state, n_randint(state, 300));
+
+        nmod_poly_mul_NTT_precache_init(pre, len1, c);
+
+        for (k = 0; k < 3; k++)
+        {
+            /* occasionally longer than the precache allows */
+            nmod_poly_randtest(b, state, n_randint(state, len1 + 10));
+            trunc = n_randint(state, b->length + c->length + 1);
+
+            nmod_poly_mullow_classical(a, b, c, trunc);
+
+            if (n_randint(state, 2))
+            {
+                nmod_poly_mullow_NTT_precache(d, b, pre, trunc);
+            }
+            else
+            {
+                nmod_poly_set(d, b);
+                nmod_poly_mullow_NTT_precache(d, d, pre, trunc);
+            }
+
+            result = (nmod_poly_equal(a, d));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("len1 = %wd, trunc = %wd\n", len1, trunc);
+                nmod_poly_print(a), flint_printf("\n\n");
+                nmod_poly_print(d), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_poly_mul_precache_clear(pre);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+    }
+
+    /* Check the cyclic product */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c;
+        nmod_poly_mul_precache_t pre;
+        mp_limb_t n = n_randtest_not_zero(state);
+        flint_bitcnt_t depth = n_randint(state, 9);
+        slong L = WORD(1) << FLINT_MAX(depth, 1), j;
+        mp_ptr r;
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+
+        nmod_poly_randtest(b, state, 1 + n_randint(state, L));
+        nmod_poly_randtest(c, state, n_randint(state, 3*L));
+
+        _nmod_poly_mul_NTT_precache_init(pre, L, c->coeffs, c->length,
+                                                                depth, c->mod);
+
+        r = _nmod_vec_init(L);
+        _nmod_poly_mul_NTT_precache_cyclic(r, b->coeffs, b->length, pre);
+
+        nmod_poly_mul_classical(a, b, c);
+        for (j = L; j < a->length; j++)
+            a->coeffs[j % L] = nmod_add(a->coeffs[j % L], a->coeffs[j], a->mod);
+        if (a->length > L)
+        {
+            a->length = L;
+            _nmod_poly_normalise(a);
+        }
+
+        for (j = 0; j < L; j++)
+        {
+            if (r[j] != (j < a->length ? a->coeffs[j] : 0))
+            {
+                flint_printf("FAIL (cyclic):\n");
+                flint_printf("depth = %wu, j = %wd\n", depth, j);
+                abort();
+            }
+        }
+
+        _nmod_vec_clear(r);
+        nmod_poly_mul_precache_clear(pre);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmod_preinv_precache....");
+    fflush(stdout);
+
+    /* Compare with mulmod, several products for each precache */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, res1, res2, f, finv;
+        nmod_poly_mulmod_precache_t pre;
+        mp_limb_t n = n_randtest_prime(state, 0);
+        slong lenf, k;
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+        nmod_poly_init(res1, n);
+        nmod_poly_init(res2, n);
+
+        lenf = 1 + n_randint(state, n_randint(state, 2) ? 50 : 1500);
+        do {
+            nmod_poly_randtest(f, state, lenf);
+        } while (nmod_poly_is_zero(f));
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_mulmod_precache_init(pre, f, finv);
+
+        for (k = 0; k < 3; k++)
+        {
+            nmod_poly_randtest(a, state, n_randint(state, f->length));
+            nmod_poly_randtest(b, state, n_randint(state, f->length));
+
+            nmod_poly_mulmod(res1, a, b, f);
+            nmod_poly_mulmod_preinv_precache(res2, a, b, pre);
+
+            result = (nmod_poly_equal(res1, res2));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+                flint_printf("b:\n"); nmod_poly_print(b), flint_printf("\n\n");
+                flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+                flint_printf("res1:\n"); nmod_poly_print(res1), flint_printf("\n\n");
+                flint_printf("res2:\n"); nmod_poly_print(res2), flint_printf("\n\n");
+                abort();
+            }
+
+            /* aliasing res and a */
+            nmod_poly_mulmod_preinv_precache(a, a, b, pre);
+
+            result = (nmod_poly_equal(res1, a));
+            if (!result)
+            {
+                flint_printf("FAIL (aliasing):\n");
+                flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+                flint_printf("res1:\n"); nmod_poly_print(res1), flint_printf("\n\n");
+                flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_poly_mulmod_precache_clear(pre);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+        nmod_poly_clear(res1);
+        nmod_poly_clear(res2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
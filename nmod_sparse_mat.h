@@ -0,0 +1,188 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Compressed sparse row storage: the nonzero entries of row i are
+    entries[rows[i]], ..., entries[rows[i + 1] - 1], in the columns
+    cols[rows[i]], ..., cols[rows[i + 1] - 1], which are increasing.
+*/
+typedef struct
+{
+    slong r;
+    slong c;
+    slong nnz;
+    slong alloc;
+    slong * rows;
+    slong * cols;
+    mp_ptr entries;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t M)
+{
+    return M->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t M)
+{
+    return M->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t M)
+{
+    return M->nnz;
+}
+
+NMOD_SPARSE_MAT_INLINE
+void nmod_sparse_mat_swap(nmod_sparse_mat_t M1, nmod_sparse_mat_t M2)
+{
+    nmod_sparse_mat_struct t = *M1;
+    *M1 = *M2;
+    *M2 = t;
+}
+
+/* Memory management */
+
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t M,
+                                            slong r, slong c, mp_limb_t n);
+
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t M);
+
+FLINT_DLL void nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t M, slong nnz);
+
+/* Assignment and conversions */
+
+FLINT_DLL void nmod_sparse_mat_zero(nmod_sparse_mat_t M);
+
+FLINT_DLL void nmod_sparse_mat_set(nmod_sparse_mat_t M,
+                                                 const nmod_sparse_mat_t A);
+
+FLINT_DLL void nmod_sparse_mat_set_entries(nmod_sparse_mat_t M,
+                const slong * rows, const slong * cols, mp_srcptr vals,
+                                                                   slong len);
+
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t M,
+                                                          const nmod_mat_t A);
+
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t A,
+                                                 const nmod_sparse_mat_t M);
+
+FLINT_DLL void nmod_sparse_mat_transpose(nmod_sparse_mat_t B,
+                                                 const nmod_sparse_mat_t A);
+
+/* Comparison */
+
+FLINT_DLL int nmod_sparse_mat_equal(const nmod_sparse_mat_t A,
+                                                 const nmod_sparse_mat_t B);
+
+/* Random generation */
+
+FLINT_DLL void nmod_sparse_mat_randtest(nmod_sparse_mat_t M,
+                                     flint_rand_t state, slong max_row_nnz);
+
+/* Multiplication */
+
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A,
+                                                                 mp_srcptr x);
+
+FLINT_DLL void nmod_sparse_mat_mul_nmod_mat(nmod_mat_t Y,
+                               const nmod_sparse_mat_t A, const nmod_mat_t X);
+
+/* Structured Gaussian elimination */
+
+typedef struct
+{
+    slong r;
+    slong c;
+    slong num_pivots;
+    slong * pivot_cols;
+    nmod_sparse_mat_t U;
+    mp_ptr Ub;
+    nmod_mat_t S;
+    slong * S_cols;
+    mp_ptr Sb;
+    slong num_free;
+    slong * free_cols;
+    int consistent;
+}
+nmod_sparse_mat_sge_struct;
+
+typedef nmod_sparse_mat_sge_struct nmod_sparse_mat_sge_t[1];
+
+FLINT_DLL void nmod_sparse_mat_sge_init(nmod_sparse_mat_sge_t E,
+             const nmod_sparse_mat_t A, mp_srcptr b, slong max_weight);
+
+FLINT_DLL void nmod_sparse_mat_sge_clear(nmod_sparse_mat_sge_t E);
+
+FLINT_DLL void nmod_sparse_mat_sge_backsub(mp_ptr x,
+                const nmod_sparse_mat_sge_t E, mp_srcptr y, mp_srcptr z);
+
+/* Rank, nullspace and solving */
+
+FLINT_DLL slong nmod_sparse_mat_rank(const nmod_sparse_mat_t A);
+
+FLINT_DLL slong nmod_sparse_mat_nullspace(nmod_mat_t X,
+                                                 const nmod_sparse_mat_t A);
+
+FLINT_DLL int nmod_sparse_mat_solve(mp_ptr x, const nmod_sparse_mat_t A,
+                                                                 mp_srcptr b);
+
+FLINT_DLL int nmod_sparse_mat_solve_wiedemann(mp_ptr x,
+                                      const nmod_sparse_mat_t A, mp_srcptr b);
+
+FLINT_DLL int nmod_sparse_mat_nullvector_wiedemann(mp_ptr x,
+                            const nmod_sparse_mat_t A, flint_rand_t state);
+
+/* Tuning */
+
+/* Columns of at most this weight are eliminated before going dense */
+#define NMOD_SPARSE_MAT_SGE_MAX_WEIGHT 4
+
+/* Number of nonzero entries from which products are split over threads */
+#define NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF 16384
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_clear(nmod_sparse_mat_t M)
+{
+    flint_free(M->rows);
+
+    if (M->alloc != 0)
+    {
+        flint_free(M->cols);
+        flint_free(M->entries);
+    }
+}
@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+int
+nmod_sparse_mat_equal(const nmod_sparse_mat_t A, const nmod_sparse_mat_t B)
+{
+    slong i;
+
+    if (A->r != B->r || A->c != B->c || A->nnz != B->nnz)
+        return 0;
+
+    for (i = 0; i <= A->r; i++)
+        if (A->rows[i] != B->rows[i])
+            return 0;
+
+    for (i = 0; i < A->nnz; i++)
+        if (A->cols[i] != B->cols[i] || A->entries[i] != B->entries[i])
+            return 0;
+
+    return 1;
+}
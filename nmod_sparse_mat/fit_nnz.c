@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t M, slong nnz)
+{
+    if (nnz > M->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2*M->alloc);
+
+        if (M->alloc == 0)
+        {
+            M->cols = (slong *) flint_malloc(nnz*sizeof(slong));
+            M->entries = (mp_ptr) flint_malloc(nnz*sizeof(mp_limb_t));
+        }
+        else
+        {
+            M->cols = (slong *) flint_realloc(M->cols, nnz*sizeof(slong));
+            M->entries = (mp_ptr) flint_realloc(M->entries,
+                                                      nnz*sizeof(mp_limb_t));
+        }
+
+        M->alloc = nnz;
+    }
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_get_nmod_mat(nmod_mat_t A, const nmod_sparse_mat_t M)
+{
+    slong i, k;
+
+    nmod_mat_zero(A);
+
+    for (i = 0; i < M->r; i++)
+        for (k = M->rows[i]; k < M->rows[i + 1]; k++)
+            nmod_mat_entry(A, i, M->cols[k]) = M->entries[k];
+}
@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    nmod_mat_struct * Y;
+    const nmod_sparse_mat_struct * A;
+    const nmod_mat_struct * X;
+}
+_mul_mat_arg_struct;
+
+/* row i of Y is a combination of the rows of X picked out by row i of A */
+static void
+_mul_mat_worker(slong start, slong stop, void * varg)
+{
+    _mul_mat_arg_struct * arg = (_mul_mat_arg_struct *) varg;
+    const nmod_sparse_mat_struct * A = arg->A;
+    const nmod_mat_struct * X = arg->X;
+    nmod_mat_struct * Y = arg->Y;
+    slong i, k, m = X->c;
+
+    for (i = start; i < stop; i++)
+    {
+        _nmod_vec_zero(Y->rows[i], m);
+
+        for (k = A->rows[i]; k < A->rows[i + 1]; k++)
+            _nmod_vec_scalar_addmul_nmod(Y->rows[i], X->rows[A->cols[k]], m,
+                                                      A->entries[k], A->mod);
+    }
+}
+
+void
+nmod_sparse_mat_mul_nmod_mat(nmod_mat_t Y, const nmod_sparse_mat_t A,
+                                                            const nmod_mat_t X)
+{
+    _mul_mat_arg_struct arg;
+
+    if (Y == X)
+    {
+        nmod_mat_t T;
+        nmod_mat_init(T, A->r, X->c, A->mod.n);
+        nmod_sparse_mat_mul_nmod_mat(T, A, X);
+        nmod_mat_swap_entrywise(Y, T);
+        nmod_mat_clear(T);
+        return;
+    }
+
+    if (X->c == 0)
+        return;
+
+    arg.Y = Y;
+    arg.A = A;
+    arg.X = X;
+
+    if (A->nnz*X->c >= NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF &&
+                                               flint_get_num_threads() > 1)
+    {
+        slong grain = FLINT_MAX(WORD(1),
+           A->r*(NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF/4)/(A->nnz*X->c));
+
+        flint_parallel_for(0, A->r, grain, _mul_mat_worker, &arg,
+                                                     flint_get_num_threads());
+    }
+    else
+    {
+        _mul_mat_worker(0, A->r, &arg);
+    }
+}
@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr x;
+    int nlimbs;
+}
+_mul_vec_arg_struct;
+
+static void
+_mul_vec_worker(slong start, slong stop, void * varg)
+{
+    _mul_vec_arg_struct * arg = (_mul_vec_arg_struct *) varg;
+    const nmod_sparse_mat_struct * A = arg->A;
+    mp_srcptr x = arg->x;
+    nmod_t mod = A->mod;
+    int nlimbs = arg->nlimbs;
+    slong i, k, len;
+    const slong * c;
+    mp_srcptr e;
+
+    for (i = start; i < stop; i++)
+    {
+        c = A->cols + A->rows[i];
+        e = A->entries + A->rows[i];
+        len = A->rows[i + 1] - A->rows[i];
+
+        NMOD_VEC_DOT(arg->y[i], k, len, e[k], x[c[k]], mod, nlimbs);
+    }
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    _mul_vec_arg_struct arg;
+    slong i, max_len;
+
+    max_len = 0;
+    for (i = 0; i < A->r; i++)
+        max_len = FLINT_MAX(max_len, A->rows[i + 1] - A->rows[i]);
+
+    arg.y = y;
+    arg.A = A;
+    arg.x = x;
+    arg.nlimbs = _nmod_vec_dot_bound_limbs(max_len, A->mod);
+
+    if (A->nnz >= NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF &&
+                                               flint_get_num_threads() > 1)
+    {
+        /* rows holding about NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF/4 entries */
+        slong grain = FLINT_MAX(WORD(1),
+               A->r*(NMOD_SPARSE_MAT_MUL_THREADED_CUTOFF/4)/A->nnz);
+
+        flint_parallel_for(0, A->r, grain, _mul_vec_worker, &arg,
+                                                     flint_get_num_threads());
+    }
+    else
+    {
+        _mul_vec_worker(0, A->r, &arg);
+    }
+}
@@ -0,0 +1,67 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_nullspace(nmod_mat_t X, const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_sge_t E;
+    nmod_mat_t Y;
+    mp_ptr x, y, z;
+    slong i, k, nullity, dense_nullity;
+
+    nmod_sparse_mat_sge_init(E, A, NULL, NMOD_SPARSE_MAT_SGE_MAX_WEIGHT);
+
+    nmod_mat_init(Y, E->S->c, E->S->c, A->mod.n);
+    dense_nullity = nmod_mat_nullspace(Y, E->S);
+    nullity = dense_nullity + E->num_free;
+
+    nmod_mat_clear(X);
+    nmod_mat_init(X, A->c, nullity, A->mod.n);
+
+    x = _nmod_vec_init(A->c + 1);
+    y = _nmod_vec_init(E->S->c + 1);
+    z = _nmod_vec_init(E->num_free + 1);
+
+    for (k = 0; k < dense_nullity; k++)
+    {
+        for (i = 0; i < E->S->c; i++)
+            y[i] = nmod_mat_entry(Y, i, k);
+
+        nmod_sparse_mat_sge_backsub(x, E, y, NULL);
+
+        for (i = 0; i < A->c; i++)
+            nmod_mat_entry(X, i, k) = x[i];
+    }
+
+    _nmod_vec_zero(z, E->num_free);
+
+    for (k = 0; k < E->num_free; k++)
+    {
+        z[k] = 1;
+        nmod_sparse_mat_sge_backsub(x, E, NULL, z);
+        z[k] = 0;
+
+        for (i = 0; i < A->c; i++)
+            nmod_mat_entry(X, i, dense_nullity + k) = x[i];
+    }
+
+    _nmod_vec_clear(x);
+    _nmod_vec_clear(y);
+    _nmod_vec_clear(z);
+    nmod_mat_clear(Y);
+    nmod_sparse_mat_sge_clear(E);
+
+    return nullity;
+}
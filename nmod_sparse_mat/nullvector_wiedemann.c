@@ -0,0 +1,123 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   With b = A y for random y, the minimal polynomial of the sequence
+   u^T A^i b is with high probability f = x^k g with g(0) != 0 such that
+   A^(k + 1) g(A) y = 0. Unless g(A) y is zero, one of the vectors
+   A^i g(A) y, i <= k, is then a nonzero vector in the kernel.
+*/
+
+#define WIEDEMANN_TRIES 3
+
+int
+nmod_sparse_mat_nullvector_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                                          flint_rand_t state)
+{
+    nmod_berlekamp_massey_t B;
+    const nmod_poly_struct * f;
+    mp_ptr u, v, w, y;
+    slong i, k, n = A->r, try;
+    nmod_t mod = A->mod;
+    int nlimbs, success = 0;
+
+    if (A->r != A->c)
+        flint_throw(FLINT_ERROR, "Exception (nmod_sparse_mat_nullvector_"
+                                    "wiedemann). Non-square matrix.\n");
+
+    if (n == 0)
+        return 0;
+
+    nmod_berlekamp_massey_init(B, mod.n);
+
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    y = _nmod_vec_init(n);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+
+    for (try = 0; try < WIEDEMANN_TRIES && !success; try++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            u[i] = n_randint(state, mod.n);
+            y[i] = n_randint(state, mod.n);
+        }
+
+        nmod_sparse_mat_mul_vec(v, A, y);
+
+        if (_nmod_vec_is_zero(v, n))
+        {
+            if (!_nmod_vec_is_zero(y, n))
+            {
+                _nmod_vec_set(x, y, n);
+                success = 1;
+            }
+            continue;
+        }
+
+        nmod_berlekamp_massey_start_over(B);
+
+        for (i = 0; i < 2*n; i++)
+        {
+            nmod_berlekamp_massey_add_point(B,
+                                       _nmod_vec_dot(u, v, n, mod, nlimbs));
+            nmod_sparse_mat_mul_vec(w, A, v);
+            MP_PTR_SWAP(v, w);
+        }
+
+        nmod_berlekamp_massey_reduce(B);
+        f = nmod_berlekamp_massey_V_poly(B);
+
+        for (k = 0; k < f->length && f->coeffs[k] == 0; k++) ;
+
+        if (k == f->length)
+            continue;
+
+        /* Horner: v = g(A) y */
+        _nmod_vec_scalar_mul_nmod(v, y, n, f->coeffs[f->length - 1], mod);
+        for (i = f->length - 2; i >= k; i--)
+        {
+            nmod_sparse_mat_mul_vec(w, A, v);
+            _nmod_vec_scalar_addmul_nmod(w, y, n, f->coeffs[i], mod);
+            MP_PTR_SWAP(v, w);
+        }
+
+        for (i = 0; i <= k && !_nmod_vec_is_zero(v, n); i++)
+        {
+            nmod_sparse_mat_mul_vec(w, A, v);
+
+            if (_nmod_vec_is_zero(w, n))
+            {
+                _nmod_vec_set(x, v, n);
+                success = 1;
+                break;
+            }
+
+            MP_PTR_SWAP(v, w);
+        }
+    }
+
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(y);
+    nmod_berlekamp_massey_clear(B);
+
+    return success;
+}
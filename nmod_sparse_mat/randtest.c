@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t M, flint_rand_t state,
+                                                           slong max_row_nnz)
+{
+    slong * rows, * cols;
+    mp_ptr vals;
+    slong i, j, len, alloc;
+
+    if (M->c == 0)
+    {
+        nmod_sparse_mat_zero(M);
+        return;
+    }
+
+    alloc = M->r*max_row_nnz + 1;
+    rows = (slong *) flint_malloc(alloc*sizeof(slong));
+    cols = (slong *) flint_malloc(alloc*sizeof(slong));
+    vals = _nmod_vec_init(alloc);
+
+    len = 0;
+    for (i = 0; i < M->r; i++)
+    {
+        slong k = n_randint(state, max_row_nnz + 1);
+
+        for (j = 0; j < k; j++)
+        {
+            rows[len] = i;
+            cols[len] = n_randint(state, M->c);
+            vals[len] = n_randtest(state) % M->mod.n;
+            len++;
+        }
+    }
+
+    nmod_sparse_mat_set_entries(M, rows, cols, vals, len);
+
+    flint_free(rows);
+    flint_free(cols);
+    _nmod_vec_clear(vals);
+}
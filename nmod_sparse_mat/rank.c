@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_rank(const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_sge_t E;
+    slong rank;
+
+    nmod_sparse_mat_sge_init(E, A, NULL, NMOD_SPARSE_MAT_SGE_MAX_WEIGHT);
+    rank = E->num_pivots + nmod_mat_rank(E->S);
+    nmod_sparse_mat_sge_clear(E);
+
+    return rank;
+}
@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set(nmod_sparse_mat_t M, const nmod_sparse_mat_t A)
+{
+    slong i;
+
+    if (M == A)
+        return;
+
+    nmod_sparse_mat_fit_nnz(M, A->nnz);
+
+    for (i = 0; i <= A->r; i++)
+        M->rows[i] = A->rows[i];
+
+    for (i = 0; i < A->nnz; i++)
+    {
+        M->cols[i] = A->cols[i];
+        M->entries[i] = A->entries[i];
+    }
+
+    M->nnz = A->nnz;
+}
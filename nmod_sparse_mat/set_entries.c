@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   The entries are bucketed by row, each row is sorted by column, and
+   repeated positions are summed. Entries summing to zero are dropped.
+*/
+
+typedef struct
+{
+    slong col;
+    mp_limb_t val;
+}
+_entry_struct;
+
+static int
+_entry_cmp(const void * a, const void * b)
+{
+    slong x = ((const _entry_struct *) a)->col;
+    slong y = ((const _entry_struct *) b)->col;
+
+    return (x > y) - (x < y);
+}
+
+void
+nmod_sparse_mat_set_entries(nmod_sparse_mat_t M, const slong * rows,
+                          const slong * cols, mp_srcptr vals, slong len)
+{
+    _entry_struct * T;
+    slong * start;
+    slong i, k, nnz, pos;
+    mp_limb_t v;
+
+    start = (slong *) flint_calloc(M->r + 1, sizeof(slong));
+    T = (_entry_struct *) flint_malloc((len + 1)*sizeof(_entry_struct));
+
+    for (k = 0; k < len; k++)
+        start[rows[k] + 1]++;
+
+    for (i = 0; i < M->r; i++)
+        start[i + 1] += start[i];
+
+    for (k = 0; k < len; k++)
+    {
+        pos = start[rows[k]]++;
+        T[pos].col = cols[k];
+        NMOD_RED(T[pos].val, vals[k], M->mod);
+    }
+
+    nmod_sparse_mat_fit_nnz(M, len);
+
+    nnz = 0;
+    pos = 0;
+
+    for (i = 0; i < M->r; i++)
+    {
+        M->rows[i] = nnz;
+
+        qsort(T + pos, start[i] - pos, sizeof(_entry_struct), _entry_cmp);
+
+        while (pos < start[i])
+        {
+            k = T[pos].col;
+            v = T[pos].val;
+
+            for (pos++; pos < start[i] && T[pos].col == k; pos++)
+                v = nmod_add(v, T[pos].val, M->mod);
+
+            if (v != 0)
+            {
+                M->cols[nnz] = k;
+                M->entries[nnz] = v;
+                nnz++;
+            }
+        }
+    }
+
+    M->rows[M->r] = nnz;
+    M->nnz = nnz;
+
+    flint_free(start);
+    flint_free(T);
+}
@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   A pivot row only contains its own pivot column, the pivot columns of
+   later pivot rows and columns that were never pivots, so going through
+   the pivot rows backwards determines every pivot variable.
+*/
+void
+nmod_sparse_mat_sge_backsub(mp_ptr x, const nmod_sparse_mat_sge_t E,
+                                                   mp_srcptr y, mp_srcptr z)
+{
+    const nmod_sparse_mat_struct * U = E->U;
+    nmod_t mod = U->mod;
+    slong i, j, k;
+    mp_limb_t s, d;
+
+    for (k = 0; k < E->S->c; k++)
+        x[E->S_cols[k]] = (y != NULL) ? y[k] : 0;
+
+    for (k = 0; k < E->num_free; k++)
+        x[E->free_cols[k]] = (z != NULL) ? z[k] : 0;
+
+    for (i = E->num_pivots - 1; i >= 0; i--)
+    {
+        j = E->pivot_cols[i];
+        s = (E->Ub != NULL) ? E->Ub[i] : 0;
+        d = 0;
+
+        for (k = U->rows[i]; k < U->rows[i + 1]; k++)
+        {
+            if (U->cols[k] == j)
+                d = U->entries[k];
+            else
+                s = nmod_sub(s, nmod_mul(U->entries[k], x[U->cols[k]], mod),
+                                                                         mod);
+        }
+
+        x[j] = nmod_mul(s, n_invmod(d, mod.n), mod);
+    }
+}
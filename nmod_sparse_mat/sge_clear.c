@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_sge_clear(nmod_sparse_mat_sge_t E)
+{
+    flint_free(E->pivot_cols);
+    nmod_sparse_mat_clear(E->U);
+    nmod_mat_clear(E->S);
+    flint_free(E->S_cols);
+    flint_free(E->free_cols);
+
+    if (E->Ub != NULL)
+        _nmod_vec_clear(E->Ub);
+    if (E->Sb != NULL)
+        _nmod_vec_clear(E->Sb);
+}
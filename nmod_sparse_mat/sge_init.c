@@ -0,0 +1,452 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   Structured Gaussian elimination. The rows are held as growable sparse
+   vectors and each column keeps a list of the rows that may contain it,
+   which is allowed to hold stale entries. The weight of a column is the
+   number of active (not yet pivot) rows containing it.
+
+   Columns are taken lightest first through buckets indexed by weight,
+   which again may hold stale entries. Columns of weight one never cause
+   fill-in; heavier ones are used while the weight is at most max_weight
+   and the number of nonzero entries has not grown too much. The pivot row
+   for a column is its shortest active row, which is then subtracted from
+   the other active rows containing the column.
+
+   Whatever is left over is a set of active rows on columns that were
+   never pivots, and these are copied into a dense matrix.
+*/
+
+typedef struct
+{
+    slong * cols;
+    mp_ptr vals;
+    slong len;
+    slong alloc;
+}
+_srow_struct;
+
+typedef struct
+{
+    slong * data;
+    slong len;
+    slong alloc;
+}
+_slist_struct;
+
+static void
+_slist_push(_slist_struct * L, slong x)
+{
+    if (L->len == L->alloc)
+    {
+        L->alloc = FLINT_MAX(4, 2*L->alloc);
+        L->data = (slong *) flint_realloc(L->data, L->alloc*sizeof(slong));
+    }
+
+    L->data[L->len++] = x;
+}
+
+static void
+_srow_fit_length(_srow_struct * R, slong len)
+{
+    if (len > R->alloc)
+    {
+        len = FLINT_MAX(len, 2*R->alloc);
+        R->cols = (slong *) flint_realloc(R->cols, len*sizeof(slong));
+        R->vals = (mp_ptr) flint_realloc(R->vals, len*sizeof(mp_limb_t));
+        R->alloc = len;
+    }
+}
+
+/* position of column j in R, or -1 */
+static slong
+_srow_find(const _srow_struct * R, slong j)
+{
+    slong lo = 0, hi = R->len - 1, mid;
+
+    while (lo <= hi)
+    {
+        mid = lo + (hi - lo)/2;
+
+        if (R->cols[mid] == j)
+            return mid;
+        else if (R->cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+
+    return -1;
+}
+
+typedef struct
+{
+    _srow_struct * R;
+    _slist_struct * clist;
+    _slist_struct * bucket;
+    slong * weight;
+    slong max_weight;
+    _srow_struct tmp;
+    slong nnz;
+    nmod_t mod;
+}
+_sge_struct;
+
+static void
+_sge_set_weight(_sge_struct * G, slong j, slong w)
+{
+    G->weight[j] = w;
+
+    if (w >= 1 && w <= G->max_weight)
+        _slist_push(G->bucket + w, j);
+}
+
+/*
+   R_i -= f*R_p where column j of R_i is cancelled, keeping the weights and
+   the column lists up to date
+*/
+static void
+_sge_row_sub(_sge_struct * G, slong i, slong p, slong j, mp_limb_t f)
+{
+    _srow_struct * Ri = G->R + i;
+    const _srow_struct * Rp = G->R + p;
+    _srow_struct * T = &G->tmp;
+    nmod_t mod = G->mod;
+    slong a, b, len, k;
+    mp_limb_t v;
+
+    _srow_fit_length(T, Ri->len + Rp->len);
+
+    a = b = len = 0;
+
+    while (a < Ri->len || b < Rp->len)
+    {
+        if (b == Rp->len || (a < Ri->len && Ri->cols[a] < Rp->cols[b]))
+        {
+            T->cols[len] = Ri->cols[a];
+            T->vals[len] = Ri->vals[a];
+            len++;
+            a++;
+        }
+        else if (a == Ri->len || Rp->cols[b] < Ri->cols[a])
+        {
+            k = Rp->cols[b];
+            v = nmod_neg(nmod_mul(f, Rp->vals[b], mod), mod);
+
+            if (v != 0)
+            {
+                T->cols[len] = k;
+                T->vals[len] = v;
+                len++;
+                _sge_set_weight(G, k, G->weight[k] + 1);
+                _slist_push(G->clist + k, i);
+            }
+
+            b++;
+        }
+        else
+        {
+            k = Ri->cols[a];
+            v = (k == j) ? 0 : nmod_sub(Ri->vals[a],
+                                          nmod_mul(f, Rp->vals[b], mod), mod);
+
+            if (v != 0)
+            {
+                T->cols[len] = k;
+                T->vals[len] = v;
+                len++;
+            }
+            else
+            {
+                _sge_set_weight(G, k, G->weight[k] - 1);
+            }
+
+            a++;
+            b++;
+        }
+    }
+
+    G->nnz += len - Ri->len;
+
+    {
+        slong * t = Ri->cols;
+        Ri->cols = T->cols;
+        T->cols = t;
+    }
+    MP_PTR_SWAP(Ri->vals, T->vals);
+    SLONG_SWAP(Ri->alloc, T->alloc);
+    Ri->len = len;
+}
+
+void
+nmod_sparse_mat_sge_init(nmod_sparse_mat_sge_t E, const nmod_sparse_mat_t A,
+                                             mp_srcptr b, slong max_weight)
+{
+    _sge_struct G[1];
+    slong r = A->r, c = A->c;
+    slong i, j, k, w, p, pos, nnz_limit, num_S_rows, num_S_cols;
+    slong * pivot_rows, * col_map, * mark;
+    char * is_pivot_row, * is_pivot_col;
+    mp_ptr rhs = NULL;
+    mp_limb_t f, d;
+    nmod_t mod = A->mod;
+
+    max_weight = FLINT_MAX(max_weight, 1);
+
+    G->mod = mod;
+    G->max_weight = max_weight;
+    G->R = (_srow_struct *) flint_calloc(r + 1, sizeof(_srow_struct));
+    G->clist = (_slist_struct *) flint_calloc(c + 1, sizeof(_slist_struct));
+    G->bucket = (_slist_struct *) flint_calloc(max_weight + 1,
+                                                       sizeof(_slist_struct));
+    G->weight = (slong *) flint_calloc(c + 1, sizeof(slong));
+    G->tmp.cols = NULL;
+    G->tmp.vals = NULL;
+    G->tmp.len = G->tmp.alloc = 0;
+    G->nnz = A->nnz;
+
+    pivot_rows = (slong *) flint_malloc((FLINT_MIN(r, c) + 1)*sizeof(slong));
+    mark = (slong *) flint_malloc((r + 1)*sizeof(slong));
+    is_pivot_row = (char *) flint_calloc(r + 1, 1);
+    is_pivot_col = (char *) flint_calloc(c + 1, 1);
+
+    if (b != NULL)
+    {
+        rhs = _nmod_vec_init(r + 1);
+        _nmod_vec_set(rhs, b, r);
+    }
+
+    for (i = 0; i < r; i++)
+    {
+        _srow_struct * R = G->R + i;
+
+        R->len = A->rows[i + 1] - A->rows[i];
+        _srow_fit_length(R, R->len);
+
+        for (k = 0; k < R->len; k++)
+        {
+            j = A->cols[A->rows[i] + k];
+            R->cols[k] = j;
+            R->vals[k] = A->entries[A->rows[i] + k];
+            G->weight[j]++;
+            _slist_push(G->clist + j, i);
+        }
+
+        mark[i] = -1;
+    }
+
+    for (j = 0; j < c; j++)
+        if (G->weight[j] >= 1 && G->weight[j] <= max_weight)
+            _slist_push(G->bucket + G->weight[j], j);
+
+    nnz_limit = 2*A->nnz + r + c;
+
+    E->num_pivots = 0;
+    E->pivot_cols = (slong *) flint_malloc((FLINT_MIN(r, c) + 1)*sizeof(slong));
+
+    for (w = 1; w <= max_weight; )
+    {
+        if (G->bucket[w].len == 0)
+        {
+            w++;
+            continue;
+        }
+
+        j = G->bucket[w].data[--G->bucket[w].len];
+
+        if (is_pivot_col[j] || G->weight[j] != w)
+            continue;
+
+        if (w > 1 && G->nnz > nnz_limit)
+            break;
+
+        /* the shortest active row containing column j */
+        p = -1;
+        pos = 0;
+        for (k = 0; k < G->clist[j].len; k++)
+        {
+            i = G->clist[j].data[k];
+
+            if (is_pivot_row[i] || mark[i] == j || _srow_find(G->R + i, j) < 0)
+                continue;
+
+            mark[i] = j;
+            G->clist[j].data[pos++] = i;
+
+            if (p == -1 || G->R[i].len < G->R[p].len)
+                p = i;
+        }
+        G->clist[j].len = pos;
+
+        /* p is now frozen, so it no longer counts towards the weights */
+        is_pivot_row[p] = 1;
+        is_pivot_col[j] = 1;
+        for (k = 0; k < G->R[p].len; k++)
+            if (!is_pivot_col[G->R[p].cols[k]])
+                _sge_set_weight(G, G->R[p].cols[k],
+                                           G->weight[G->R[p].cols[k]] - 1);
+
+        pivot_rows[E->num_pivots] = p;
+        E->pivot_cols[E->num_pivots] = j;
+        E->num_pivots++;
+
+        d = G->R[p].vals[_srow_find(G->R + p, j)];
+        d = n_invmod(d, mod.n);
+
+        for (k = 0; k < G->clist[j].len; k++)
+        {
+            i = G->clist[j].data[k];
+
+            if (i == p)
+                continue;
+
+            f = nmod_mul(G->R[i].vals[_srow_find(G->R + i, j)], d, mod);
+            _sge_row_sub(G, i, p, j, f);
+
+            if (rhs != NULL)
+                rhs[i] = nmod_sub(rhs[i], nmod_mul(f, rhs[p], mod), mod);
+        }
+
+        G->weight[j] = 0;
+        G->clist[j].len = 0;
+
+        /* lighter columns may have appeared */
+        w = 1;
+    }
+
+    E->r = r;
+    E->c = c;
+
+    /* the pivot rows in elimination order */
+    k = 0;
+    for (i = 0; i < E->num_pivots; i++)
+        k += G->R[pivot_rows[i]].len;
+
+    nmod_sparse_mat_init(E->U, E->num_pivots, c, mod.n);
+    nmod_sparse_mat_fit_nnz(E->U, k);
+    E->Ub = (rhs != NULL) ? _nmod_vec_init(E->num_pivots + 1) : NULL;
+
+    pos = 0;
+    for (i = 0; i < E->num_pivots; i++)
+    {
+        _srow_struct * R = G->R + pivot_rows[i];
+
+        E->U->rows[i] = pos;
+        for (k = 0; k < R->len; k++)
+        {
+            E->U->cols[pos] = R->cols[k];
+            E->U->entries[pos] = R->vals[k];
+            pos++;
+        }
+
+        if (rhs != NULL)
+            E->Ub[i] = rhs[pivot_rows[i]];
+    }
+    E->U->rows[E->num_pivots] = pos;
+    E->U->nnz = pos;
+
+    /* the remaining columns are either in the dense part or free */
+    col_map = (slong *) flint_malloc((c + 1)*sizeof(slong));
+    num_S_cols = 0;
+    E->num_free = 0;
+    for (j = 0; j < c; j++)
+    {
+        col_map[j] = -1;
+
+        if (is_pivot_col[j])
+            continue;
+
+        if (G->weight[j] > 0)
+            col_map[j] = num_S_cols++;
+        else
+            E->num_free++;
+    }
+
+    E->S_cols = (slong *) flint_malloc((num_S_cols + 1)*sizeof(slong));
+    E->free_cols = (slong *) flint_malloc((E->num_free + 1)*sizeof(slong));
+    num_S_cols = 0;
+    E->num_free = 0;
+    for (j = 0; j < c; j++)
+    {
+        if (is_pivot_col[j])
+            continue;
+
+        if (col_map[j] >= 0)
+            E->S_cols[num_S_cols++] = j;
+        else
+            E->free_cols[E->num_free++] = j;
+    }
+
+    /* active rows, the zero ones only matter for consistency */
+    E->consistent = 1;
+    num_S_rows = 0;
+    for (i = 0; i < r; i++)
+    {
+        if (is_pivot_row[i])
+            continue;
+
+        if (G->R[i].len != 0)
+            num_S_rows++;
+        else if (rhs != NULL && rhs[i] != 0)
+            E->consistent = 0;
+    }
+
+    nmod_mat_init(E->S, num_S_rows, num_S_cols, mod.n);
+    E->Sb = (rhs != NULL) ? _nmod_vec_init(num_S_rows + 1) : NULL;
+
+    num_S_rows = 0;
+    for (i = 0; i < r; i++)
+    {
+        _srow_struct * R = G->R + i;
+
+        if (is_pivot_row[i] || R->len == 0)
+            continue;
+
+        for (k = 0; k < R->len; k++)
+            nmod_mat_entry(E->S, num_S_rows, col_map[R->cols[k]]) = R->vals[k];
+
+        if (rhs != NULL)
+            E->Sb[num_S_rows] = rhs[i];
+
+        num_S_rows++;
+    }
+
+    for (i = 0; i < r; i++)
+    {
+        flint_free(G->R[i].cols);
+        flint_free(G->R[i].vals);
+    }
+    for (j = 0; j < c; j++)
+        flint_free(G->clist[j].data);
+    for (w = 0; w <= max_weight; w++)
+        flint_free(G->bucket[w].data);
+
+    flint_free(G->R);
+    flint_free(G->clist);
+    flint_free(G->bucket);
+    flint_free(G->weight);
+    flint_free(G->tmp.cols);
+    flint_free(G->tmp.vals);
+    flint_free(pivot_rows);
+    flint_free(mark);
+    flint_free(is_pivot_row);
+    flint_free(is_pivot_col);
+    flint_free(col_map);
+
+    if (rhs != NULL)
+        _nmod_vec_clear(rhs);
+}
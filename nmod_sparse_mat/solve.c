@@ -0,0 +1,61 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+int
+nmod_sparse_mat_solve(mp_ptr x, const nmod_sparse_mat_t A, mp_srcptr b)
+{
+    nmod_sparse_mat_sge_t E;
+    nmod_mat_t Y, B;
+    slong i;
+    int success;
+
+    nmod_sparse_mat_sge_init(E, A, b, NMOD_SPARSE_MAT_SGE_MAX_WEIGHT);
+
+    success = E->consistent;
+
+    if (success && E->S->r != 0)
+    {
+        nmod_mat_init(Y, E->S->c, 1, A->mod.n);
+        nmod_mat_init(B, E->S->r, 1, A->mod.n);
+
+        for (i = 0; i < E->S->r; i++)
+            nmod_mat_entry(B, i, 0) = E->Sb[i];
+
+        success = nmod_mat_can_solve(Y, E->S, B);
+
+        if (success)
+        {
+            mp_ptr y = _nmod_vec_init(E->S->c);
+
+            for (i = 0; i < E->S->c; i++)
+                y[i] = nmod_mat_entry(Y, i, 0);
+
+            nmod_sparse_mat_sge_backsub(x, E, y, NULL);
+
+            _nmod_vec_clear(y);
+        }
+
+        nmod_mat_clear(Y);
+        nmod_mat_clear(B);
+    }
+    else if (success)
+    {
+        nmod_sparse_mat_sge_backsub(x, E, NULL, NULL);
+    }
+
+    nmod_sparse_mat_sge_clear(E);
+
+    return success;
+}
@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   Scalar Wiedemann: with random u, the minimal polynomial f of the
+   sequence u^T A^i b, i < 2n, is with high probability that of b under A.
+   If f(0) != 0 then x = -(f(A) - f(0))/(f(0) A) b solves A x = b.
+*/
+
+#define WIEDEMANN_TRIES 3
+
+int
+nmod_sparse_mat_solve_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                                                 mp_srcptr b)
+{
+    nmod_berlekamp_massey_t B;
+    const nmod_poly_struct * f;
+    flint_rand_t state;
+    mp_ptr u, v, w;
+    slong i, n = A->r, try;
+    nmod_t mod = A->mod;
+    mp_limb_t c;
+    int nlimbs, success = 0;
+
+    if (A->r != A->c)
+        flint_throw(FLINT_ERROR, "Exception (nmod_sparse_mat_solve_wiedemann)."
+                                                  " Non-square matrix.\n");
+
+    if (_nmod_vec_is_zero(b, n))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    flint_randinit(state);
+    nmod_berlekamp_massey_init(B, mod.n);
+
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+
+    for (try = 0; try < WIEDEMANN_TRIES && !success; try++)
+    {
+        for (i = 0; i < n; i++)
+            u[i] = n_randint(state, mod.n);
+
+        nmod_berlekamp_massey_start_over(B);
+
+        _nmod_vec_set(v, b, n);
+        for (i = 0; i < 2*n; i++)
+        {
+            nmod_berlekamp_massey_add_point(B,
+                                       _nmod_vec_dot(u, v, n, mod, nlimbs));
+            nmod_sparse_mat_mul_vec(w, A, v);
+            MP_PTR_SWAP(v, w);
+        }
+
+        nmod_berlekamp_massey_reduce(B);
+        f = nmod_berlekamp_massey_V_poly(B);
+
+        c = nmod_poly_get_coeff_ui(f, 0);
+        if (f->length < 2 || c == 0)
+            continue;
+
+        /* Horner: v = sum_{i >= 1} f_i A^(i - 1) b */
+        _nmod_vec_scalar_mul_nmod(v, b, n, f->coeffs[f->length - 1], mod);
+        for (i = f->length - 2; i >= 1; i--)
+        {
+            nmod_sparse_mat_mul_vec(w, A, v);
+            _nmod_vec_scalar_addmul_nmod(w, b, n, f->coeffs[i], mod);
+            MP_PTR_SWAP(v, w);
+        }
+
+        c = nmod_neg(n_invmod(c, mod.n), mod);
+        _nmod_vec_scalar_mul_nmod(x, v, n, c, mod);
+
+        nmod_sparse_mat_mul_vec(w, A, x);
+        success = _nmod_vec_equal(w, b, n);
+    }
+
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    nmod_berlekamp_massey_clear(B);
+    flint_randclear(state);
+
+    return success;
+}
@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_nmod_mat....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, X, Y, Z;
+        slong r, c, m, max_row_nnz;
+        mp_limb_t n;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        if (n_randint(state, 20) == 0)
+        {
+            r = n_randint(state, 1000);
+            c = n_randint(state, 1000) + 1;
+            m = n_randint(state, 40);
+            max_row_nnz = n_randint(state, 30);
+        }
+        else
+        {
+            r = n_randint(state, 30);
+            c = n_randint(state, 30) + 1;
+            m = n_randint(state, 30);
+            max_row_nnz = n_randint(state, 10);
+        }
+
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, r, c, n);
+        nmod_mat_init(A, r, c, n);
+        nmod_mat_init(X, c, m, n);
+        nmod_mat_init(Y, r, m, n);
+        nmod_mat_init(Z, r, m, n);
+
+        nmod_sparse_mat_randtest(M, state, max_row_nnz);
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        nmod_mat_randtest(X, state);
+        nmod_mat_randtest(Y, state);
+
+        nmod_sparse_mat_mul_nmod_mat(Y, M, X);
+        nmod_mat_mul(Z, A, X);
+
+        if (!nmod_mat_equal(Y, Z))
+        {
+            flint_printf("FAIL\n");
+            flint_printf("r = %wd, c = %wd, m = %wd, n = %wu\n", r, c, m, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* aliasing */
+        if (r == c)
+        {
+            nmod_sparse_mat_mul_nmod_mat(X, M, X);
+
+            if (!nmod_mat_equal(X, Z))
+            {
+                flint_printf("FAIL: aliasing\n");
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
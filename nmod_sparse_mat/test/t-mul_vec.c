@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, X, Y;
+        mp_ptr x, y;
+        slong r, c, i, max_row_nnz;
+        mp_limb_t n;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        if (n_randint(state, 20) == 0)
+        {
+            r = n_randint(state, 3000);
+            c = n_randint(state, 3000) + 1;
+            max_row_nnz = n_randint(state, 30);
+        }
+        else
+        {
+            r = n_randint(state, 40);
+            c = n_randint(state, 40) + 1;
+            max_row_nnz = n_randint(state, 10);
+        }
+
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, r, c, n);
+        nmod_mat_init(A, r, c, n);
+        nmod_mat_init(X, c, 1, n);
+        nmod_mat_init(Y, r, 1, n);
+        x = _nmod_vec_init(c);
+        y = _nmod_vec_init(r + 1);
+
+        nmod_sparse_mat_randtest(M, state, max_row_nnz);
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        for (i = 0; i < c; i++)
+            x[i] = nmod_mat_entry(X, i, 0) = n_randtest(state) % n;
+
+        nmod_sparse_mat_mul_vec(y, M, x);
+        nmod_mat_mul(Y, A, X);
+
+        for (i = 0; i < r; i++)
+        {
+            if (y[i] != nmod_mat_entry(Y, i, 0))
+            {
+                flint_printf("FAIL\n");
+                flint_printf("r = %wd, c = %wd, n = %wu\n", r, c, n);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
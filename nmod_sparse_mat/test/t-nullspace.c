@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, X, Z;
+        slong r, c, nullity, rank;
+        mp_limb_t p;
+
+        if (n_randint(state, 20) == 0)
+        {
+            r = n_randint(state, 300);
+            c = n_randint(state, 300);
+        }
+        else
+        {
+            r = n_randint(state, 30);
+            c = n_randint(state, 30);
+        }
+
+        p = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(M, r, c, p);
+        nmod_mat_init(A, r, c, p);
+        nmod_mat_init(X, 0, 0, p);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 2) ?
+                               n_randint(state, 5) : n_randint(state, c + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        nullity = nmod_sparse_mat_nullspace(X, M);
+        rank = nmod_mat_rank(A);
+
+        if (nullity + rank != c || X->r != c || X->c != nullity ||
+                                                  nmod_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL: wrong nullity\n");
+            flint_printf("r = %wd, c = %wd, p = %wu, nullity %wd, rank %wd\n",
+                                                   r, c, p, nullity, rank);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_init(Z, r, nullity, p);
+        nmod_mat_mul(Z, A, X);
+
+        if (!nmod_mat_is_zero(Z))
+        {
+            flint_printf("FAIL: AX != 0\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
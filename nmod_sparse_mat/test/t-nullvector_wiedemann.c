@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullvector_wiedemann....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        mp_ptr x, y;
+        slong n, i, j;
+        mp_limb_t p;
+        int success;
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        n = n_randint(state, 60) + 1;
+        p = n_randprime(state, 20 + n_randint(state, FLINT_BITS - 20), 1);
+
+        nmod_sparse_mat_init(M, n, n, p);
+        nmod_mat_init(A, n, n, p);
+        x = _nmod_vec_init(n);
+        y = _nmod_vec_init(n);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 6));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        /* make it singular by clearing a row */
+        j = n_randint(state, n);
+        for (i = 0; i < n; i++)
+            nmod_mat_entry(A, j, i) = 0;
+        nmod_sparse_mat_set_nmod_mat(M, A);
+
+        success = nmod_sparse_mat_nullvector_wiedemann(x, M, state);
+
+        if (!success)
+        {
+            flint_printf("FAIL: no kernel vector found\n");
+            flint_printf("n = %wd, p = %wu\n", n, p);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_mul_vec(y, M, x);
+
+        if (!_nmod_vec_is_zero(y, n) || _nmod_vec_is_zero(x, n))
+        {
+            flint_printf("FAIL: not a kernel vector\n");
+            flint_printf("n = %wd, p = %wu\n", n, p);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
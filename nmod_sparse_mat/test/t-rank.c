@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        slong r, c, rank1, rank2;
+        mp_limb_t p;
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        if (n_randint(state, 20) == 0)
+        {
+            r = n_randint(state, 400);
+            c = n_randint(state, 400);
+        }
+        else
+        {
+            r = n_randint(state, 40);
+            c = n_randint(state, 40);
+        }
+
+        p = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(M, r, c, p);
+        nmod_mat_init(A, r, c, p);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 2) ?
+                               n_randint(state, 5) : n_randint(state, c + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        rank1 = nmod_sparse_mat_rank(M);
+        rank2 = nmod_mat_rank(A);
+
+        if (rank1 != rank2)
+        {
+            flint_printf("FAIL\n");
+            flint_printf("r = %wd, c = %wd, p = %wu, rank %wd, %wd\n",
+                                                  r, c, p, rank1, rank2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_entries....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M, N;
+        nmod_mat_t A, B;
+        slong r, c, len, i, k;
+        slong * rows, * cols;
+        mp_ptr vals;
+        mp_limb_t n;
+
+        r = n_randint(state, 20);
+        c = n_randint(state, 20) + 1;
+        n = n_randtest_not_zero(state);
+        len = n_randint(state, 3*r*c + 1);
+
+        rows = flint_malloc((len + 1)*sizeof(slong));
+        cols = flint_malloc((len + 1)*sizeof(slong));
+        vals = _nmod_vec_init(len + 1);
+
+        nmod_sparse_mat_init(M, r, c, n);
+        nmod_sparse_mat_init(N, r, c, n);
+        nmod_mat_init(A, r, c, n);
+        nmod_mat_init(B, r, c, n);
+
+        for (k = 0; k < len; k++)
+        {
+            rows[k] = n_randint(state, r);
+            cols[k] = n_randint(state, c);
+            vals[k] = n_randtest(state);
+
+            nmod_mat_entry(A, rows[k], cols[k]) = nmod_add(
+                nmod_mat_entry(A, rows[k], cols[k]),
+                n_mod2_preinv(vals[k], A->mod.n, A->mod.ninv), A->mod);
+        }
+
+        nmod_sparse_mat_set_entries(M, rows, cols, vals, len);
+        nmod_sparse_mat_get_nmod_mat(B, M);
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL: set_entries\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (i = 0; i < r; i++)
+        {
+            for (k = M->rows[i]; k < M->rows[i + 1]; k++)
+            {
+                if (M->entries[k] == 0 ||
+                    (k + 1 < M->rows[i + 1] && M->cols[k] >= M->cols[k + 1]))
+                {
+                    flint_printf("FAIL: not canonical\n");
+                    fflush(stdout);
+                    flint_abort();
+                }
+            }
+        }
+
+        nmod_sparse_mat_set_nmod_mat(N, A);
+
+        if (!nmod_sparse_mat_equal(M, N))
+        {
+            flint_printf("FAIL: set_nmod_mat\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(N);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        flint_free(rows);
+        flint_free(cols);
+        _nmod_vec_clear(vals);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A, B, X;
+        mp_ptr x, b, y;
+        slong r, c, i;
+        mp_limb_t p;
+        int consistent, success;
+
+        if (n_randint(state, 20) == 0)
+        {
+            r = n_randint(state, 300);
+            c = n_randint(state, 300);
+        }
+        else
+        {
+            r = n_randint(state, 30);
+            c = n_randint(state, 30);
+        }
+
+        p = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(M, r, c, p);
+        nmod_mat_init(A, r, c, p);
+        nmod_mat_init(B, r, 1, p);
+        nmod_mat_init(X, c, 1, p);
+        x = _nmod_vec_init(c + 1);
+        b = _nmod_vec_init(r + 1);
+        y = _nmod_vec_init(r + 1);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 2) ?
+                               n_randint(state, 5) : n_randint(state, c + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        if (n_randint(state, 2))
+        {
+            for (i = 0; i < c; i++)
+                x[i] = n_randint(state, p);
+            nmod_sparse_mat_mul_vec(b, M, x);
+            consistent = 1;
+        }
+        else
+        {
+            for (i = 0; i < r; i++)
+                b[i] = nmod_mat_entry(B, i, 0) = n_randint(state, p);
+            consistent = nmod_mat_can_solve(X, A, B);
+        }
+
+        success = nmod_sparse_mat_solve(x, M, b);
+
+        if (success != consistent)
+        {
+            flint_printf("FAIL: wrong consistency\n");
+            flint_printf("r = %wd, c = %wd, p = %wu\n", r, c, p);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (success)
+        {
+            nmod_sparse_mat_mul_vec(y, M, x);
+
+            if (!_nmod_vec_equal(y, b, r))
+            {
+                flint_printf("FAIL: Ax != b\n");
+                flint_printf("r = %wd, c = %wd, p = %wu\n", r, c, p);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(X);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_wiedemann....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        mp_ptr x, b, y;
+        slong n, i;
+        mp_limb_t p;
+        int success;
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        n = n_randint(state, 60);
+        p = n_randprime(state, 20 + n_randint(state, FLINT_BITS - 20), 1);
+
+        nmod_sparse_mat_init(M, n, n, p);
+        nmod_mat_init(A, n, n, p);
+        x = _nmod_vec_init(n + 1);
+        b = _nmod_vec_init(n + 1);
+        y = _nmod_vec_init(n + 1);
+
+        /* a random sparse matrix plus a random diagonal */
+        for (i = 0; i < n; i++)
+            y[i] = n_randint(state, p);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 5));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        for (i = 0; i < n; i++)
+            nmod_mat_entry(A, i, i) = nmod_add(nmod_mat_entry(A, i, i),
+                                                         y[i], A->mod);
+        nmod_sparse_mat_set_nmod_mat(M, A);
+
+        for (i = 0; i < n; i++)
+            b[i] = n_randint(state, p);
+
+        success = nmod_sparse_mat_solve_wiedemann(x, M, b);
+
+        if (!success && nmod_mat_rank(A) == n)
+        {
+            flint_printf("FAIL: no solution found\n");
+            flint_printf("n = %wd, p = %wu\n", n, p);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (success)
+        {
+            nmod_sparse_mat_mul_vec(y, M, x);
+
+            if (!_nmod_vec_equal(y, b, n))
+            {
+                flint_printf("FAIL: Ax != b\n");
+                flint_printf("n = %wd, p = %wu\n", n, p);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
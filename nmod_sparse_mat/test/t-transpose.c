@@ -0,0 +1,83 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+#include "thread_support.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M, T, U;
+        nmod_mat_t A, B, C;
+        slong r, c;
+        mp_limb_t n;
+
+        r = n_randint(state, 30);
+        c = n_randint(state, 30);
+        n = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(M, r, c, n);
+        nmod_sparse_mat_init(T, c, r, n);
+        nmod_sparse_mat_init(U, r, c, n);
+        nmod_mat_init(A, r, c, n);
+        nmod_mat_init(B, c, r, n);
+        nmod_mat_init(C, c, r, n);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 10));
+        nmod_sparse_mat_transpose(T, M);
+
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        nmod_sparse_mat_get_nmod_mat(B, T);
+        nmod_mat_transpose(C, A);
+
+        if (!nmod_mat_equal(B, C))
+        {
+            flint_printf("FAIL: transpose\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        /* transposing twice gives back the same canonical form */
+        nmod_sparse_mat_transpose(U, T);
+
+        if (!nmod_sparse_mat_equal(U, M))
+        {
+            flint_printf("FAIL: transpose twice\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(T);
+        nmod_sparse_mat_clear(U);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
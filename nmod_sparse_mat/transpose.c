@@ -0,0 +1,59 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/* counting sort by column, which keeps the columns of B increasing */
+void
+nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong i, k, pos;
+    slong * count;
+
+    if (B == A)
+    {
+        nmod_sparse_mat_t T;
+        nmod_sparse_mat_init(T, A->c, A->r, A->mod.n);
+        nmod_sparse_mat_transpose(T, A);
+        nmod_sparse_mat_swap(B, T);
+        nmod_sparse_mat_clear(T);
+        return;
+    }
+
+    nmod_sparse_mat_fit_nnz(B, A->nnz);
+
+    count = (slong *) flint_calloc(A->c + 1, sizeof(slong));
+
+    for (k = 0; k < A->nnz; k++)
+        count[A->cols[k] + 1]++;
+
+    for (i = 0; i < A->c; i++)
+        count[i + 1] += count[i];
+
+    for (i = 0; i <= A->c; i++)
+        B->rows[i] = count[i];
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->rows[i]; k < A->rows[i + 1]; k++)
+        {
+            pos = count[A->cols[k]]++;
+            B->cols[pos] = i;
+            B->entries[pos] = A->entries[k];
+        }
+    }
+
+    B->nnz = A->nnz;
+
+    flint_free(count);
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_zero(nmod_sparse_mat_t M)
+{
+    slong i;
+
+    for (i = 0; i <= M->r; i++)
+        M->rows[i] = 0;
+
+    M->nnz = 0;
+}
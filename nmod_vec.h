@@ -339,6 +339,79 @@ FLINT_DLL mp_limb_t _nmod_vec_dot_rev(mp_srcptr vec1, mp_srcptr vec2,
 FLINT_DLL mp_limb_t _nmod_vec_dot_ptr(mp_srcptr vec1, const mp_ptr * vec2, slong offset,
     slong len, nmod_t mod, int nlimbs);
 
+/* SIMD kernels **************************************************************/
+
+/*
+   Vectorised kernels for x86-64, compiled with per function target
+   attributes and selected at runtime from the CPU features. Windows is
+   excluded since GCC does not align 256/512 bit spills there.
+*/
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__amd64__)) \
+    && !defined(_WIN32) && !defined(FLINT_NO_SIMD) \
+    && (defined(__clang__) || __GNUC__ >= 6)
+#define NMOD_VEC_HAVE_SIMD 1
+#else
+#define NMOD_VEC_HAVE_SIMD 0
+#endif
+
+#define NMOD_VEC_SIMD_NONE   0
+#define NMOD_VEC_SIMD_AVX2   1    /* AVX2 and FMA */
+#define NMOD_VEC_SIMD_AVX512 2    /* AVX-512 F and DQ */
+
+/* shorter vectors are handled by the scalar loops */
+#define NMOD_VEC_SIMD_CUTOFF 16
+
+/* largest modulus for which the double precision kernels are exact */
+#define NMOD_VEC_SIMD_FMA_MAX_BITS 50
+
+FLINT_DLL int _nmod_vec_simd_level(void);
+
+#if NMOD_VEC_HAVE_SIMD
+
+FLINT_DLL void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_neg_avx2(mp_ptr res, mp_srcptr vec,
+                                            slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_reduce_avx2(mp_ptr res, mp_srcptr vec,
+                                            slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                                            slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_neg_avx512(mp_ptr res, mp_srcptr vec,
+                                            slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_reduce_avx512(mp_ptr res, mp_srcptr vec,
+                                            slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_avx512(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                                            slong len, nmod_t mod);
+
+#endif
+
 
 /* discrete logs a la Pohlig - Hellman ***************************************/
 
@@ -20,6 +20,24 @@ void _nmod_vec_add(mp_ptr res, mp_srcptr vec1,
 {
     slong i;
 
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF)
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+        {
+            _nmod_vec_add_avx512(res, vec1, vec2, len, mod);
+            return;
+        }
+        else if (level == NMOD_VEC_SIMD_AVX2)
+        {
+            _nmod_vec_add_avx2(res, vec1, vec2, len, mod);
+            return;
+        }
+    }
+#endif
+
     if (mod.norm)
     {
         for (i = 0 ; i < len; i++)
@@ -20,6 +20,21 @@ _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod, int nlimbs)
 {
     mp_limb_t res;
     slong i;
+
+#if NMOD_VEC_HAVE_SIMD
+    /* the products fit in a limb and are accumulated in 32-bit halves */
+    if (len >= NMOD_VEC_SIMD_CUTOFF && mod.n <= (UWORD(1) << 32)
+            && len <= (WORD(1) << 31))
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+            return _nmod_vec_dot_avx512(vec1, vec2, len, mod);
+        else if (level == NMOD_VEC_SIMD_AVX2)
+            return _nmod_vec_dot_avx2(vec1, vec2, len, mod);
+    }
+#endif
+
     NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i], mod, nlimbs);
     return res;
 }
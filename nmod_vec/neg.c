@@ -18,6 +18,25 @@
 void _nmod_vec_neg(mp_ptr res, mp_srcptr vec, slong len, nmod_t mod)
 {
     slong i;
+
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF)
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+        {
+            _nmod_vec_neg_avx512(res, vec, len, mod);
+            return;
+        }
+        else if (level == NMOD_VEC_SIMD_AVX2)
+        {
+            _nmod_vec_neg_avx2(res, vec, len, mod);
+            return;
+        }
+    }
+#endif
+
     for (i = 0 ; i < len; i++)
         res[i] = nmod_neg(vec[i], mod);
 }
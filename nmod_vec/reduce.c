@@ -18,6 +18,26 @@
 void _nmod_vec_reduce(mp_ptr res, mp_srcptr vec, slong len, nmod_t mod)
 {
     slong i;
+
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF
+            && mod.norm >= FLINT_BITS - NMOD_VEC_SIMD_FMA_MAX_BITS)
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+        {
+            _nmod_vec_reduce_avx512(res, vec, len, mod);
+            return;
+        }
+        else if (level == NMOD_VEC_SIMD_AVX2)
+        {
+            _nmod_vec_reduce_avx2(res, vec, len, mod);
+            return;
+        }
+    }
+#endif
+
     for (i = 0 ; i < len; i++)
         NMOD_RED(res[i], vec[i], mod);
 }
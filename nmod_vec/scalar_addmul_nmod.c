@@ -18,6 +18,25 @@
 void _nmod_vec_scalar_addmul_nmod(mp_ptr res, mp_srcptr vec, 
 				             slong len, mp_limb_t c, nmod_t mod)
 {
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF
+            && mod.norm >= FLINT_BITS - NMOD_VEC_SIMD_FMA_MAX_BITS)
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+        {
+            _nmod_vec_scalar_addmul_nmod_avx512(res, vec, len, c, mod);
+            return;
+        }
+        else if (level == NMOD_VEC_SIMD_AVX2)
+        {
+            _nmod_vec_scalar_addmul_nmod_avx2(res, vec, len, c, mod);
+            return;
+        }
+    }
+#endif
+
     if (mod.norm >= FLINT_BITS/2) /* addmul will fit in a limb */
     {
         mpn_addmul_1(res, vec, len, c);
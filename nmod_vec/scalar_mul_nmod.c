@@ -21,6 +21,25 @@ void _nmod_vec_scalar_mul_nmod(mp_ptr res, mp_srcptr vec,
     if (len < 1)
         return;
 
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF
+            && mod.norm >= FLINT_BITS - NMOD_VEC_SIMD_FMA_MAX_BITS)
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+        {
+            _nmod_vec_scalar_mul_nmod_avx512(res, vec, len, c, mod);
+            return;
+        }
+        else if (level == NMOD_VEC_SIMD_AVX2)
+        {
+            _nmod_vec_scalar_mul_nmod_avx2(res, vec, len, c, mod);
+            return;
+        }
+    }
+#endif
+
     if (len > 10 && mod.n < UWORD_HALF)
     {
         _nmod_vec_scalar_mul_nmod_shoup(res, vec, len, c, mod);
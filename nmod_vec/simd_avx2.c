@@ -0,0 +1,339 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+#define AVX2_INLINE static __inline__ AVX2_TARGET
+
+/*
+   Integers 0 <= x < 2^52 are converted to and from doubles by placing
+   them in the mantissa of 2^52.
+*/
+#define MAGIC_BITS 0x4330000000000000LL
+
+AVX2_INLINE __m256d
+vec4n_to_vec4d(__m256i a)
+{
+    const __m256i m = _mm256_set1_epi64x(MAGIC_BITS);
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(a, m)),
+                         _mm256_castsi256_pd(m));
+}
+
+AVX2_INLINE __m256i
+vec4d_to_vec4n(__m256d a)
+{
+    const __m256i m = _mm256_set1_epi64x(MAGIC_BITS);
+    return _mm256_xor_si256(
+            _mm256_castpd_si256(_mm256_add_pd(a, _mm256_castsi256_pd(m))), m);
+}
+
+/* unsigned comparison a < b, done as a signed comparison with flipped sign */
+AVX2_INLINE __m256i
+vec4n_cmplt(__m256i a, __m256i b)
+{
+    const __m256i s = _mm256_set1_epi64x(WORD_MIN);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, s), _mm256_xor_si256(a, s));
+}
+
+/*
+   Returns a*b mod n in [0, n) for integers a, b given as doubles, where
+   n < 2^50 and a*b/n < 2^50. The product is split exactly into h + l
+   with an fma, the quotient rounded to nearest is then off by at most
+   one, and the remainder h - q*n + l is computed exactly.
+*/
+AVX2_INLINE __m256d
+vec4d_mulmod(__m256d a, __m256d b, __m256d n, __m256d ninv)
+{
+    __m256d h, l, q, r;
+
+    h = _mm256_mul_pd(a, b);
+    l = _mm256_fmsub_pd(a, b, h);
+    q = _mm256_round_pd(_mm256_mul_pd(h, ninv),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm256_add_pd(_mm256_fnmadd_pd(q, n, h), l);
+
+    return _mm256_add_pd(r, _mm256_and_pd(n,
+                  _mm256_cmp_pd(r, _mm256_setzero_pd(), _CMP_LT_OQ)));
+}
+
+/* reduces r in [0, 2n) to [0, n) */
+AVX2_INLINE __m256d
+vec4d_reduce_2n(__m256d r, __m256d n)
+{
+    return _mm256_sub_pd(r, _mm256_and_pd(n, _mm256_cmp_pd(r, n, _CMP_GE_OQ)));
+}
+
+/*
+   Returns a*c mod n for a, c, n < 2^32 using Shoup's algorithm with 32-bit
+   words, where cp = floor(c*2^32/n). The remainder before correction lies
+   in [0, 2n) and so fits comfortably in the 64-bit lanes.
+*/
+AVX2_INLINE __m256i
+vec4n_mulmod_shoup32(__m256i a, __m256i c, __m256i cp,
+                                                __m256i n, __m256i nm1)
+{
+    __m256i q, r;
+
+    q = _mm256_srli_epi64(_mm256_mul_epu32(a, cp), 32);
+    r = _mm256_sub_epi64(_mm256_mul_epu32(a, c), _mm256_mul_epu32(q, n));
+
+    return _mm256_sub_epi64(r, _mm256_and_si256(n, _mm256_cmpgt_epi64(r, nm1)));
+}
+
+AVX2_TARGET void
+_nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    __m256i a, b, t;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+        b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+        t = vec4n_cmplt(a, _mm256_sub_epi64(n, b));
+        a = _mm256_add_epi64(a, b);
+        a = _mm256_sub_epi64(a, _mm256_andnot_si256(t, n));
+        _mm256_storeu_si256((__m256i *) (res + i), a);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_add(vec1[i], vec2[i], mod);
+}
+
+AVX2_TARGET void
+_nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    __m256i a, b, t;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+        b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+        t = vec4n_cmplt(a, b);
+        a = _mm256_sub_epi64(a, b);
+        a = _mm256_add_epi64(a, _mm256_and_si256(t, n));
+        _mm256_storeu_si256((__m256i *) (res + i), a);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_sub(vec1[i], vec2[i], mod);
+}
+
+AVX2_TARGET void
+_nmod_vec_neg_avx2(mp_ptr res, mp_srcptr vec, slong len, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i z = _mm256_setzero_si256();
+    __m256i a, t;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec + i));
+        t = _mm256_cmpeq_epi64(a, z);
+        a = _mm256_andnot_si256(t, _mm256_sub_epi64(n, a));
+        _mm256_storeu_si256((__m256i *) (res + i), a);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_neg(vec[i], mod);
+}
+
+/* requires n < 2^50; the input limbs are arbitrary */
+AVX2_TARGET void
+_nmod_vec_reduce_avx2(mp_ptr res, mp_srcptr vec, slong len, nmod_t mod)
+{
+    const __m256i lo32 = _mm256_set1_epi64x(UWORD(0xffffffff));
+    const __m256d n = _mm256_set1_pd((double) mod.n);
+    const __m256d ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+    const __m256d c = _mm256_set1_pd((double) n_mod2_preinv(
+                                     UWORD(1) << 32, mod.n, mod.ninv));
+    __m256i a;
+    __m256d h, l, q;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec + i));
+
+        /* a = h*2^32 + l and h*(2^32 mod n) + l is reduced */
+        h = vec4n_to_vec4d(_mm256_srli_epi64(a, 32));
+        l = vec4n_to_vec4d(_mm256_and_si256(a, lo32));
+        h = vec4d_mulmod(h, c, n, ninv);
+
+        q = _mm256_round_pd(_mm256_mul_pd(l, ninv),
+                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        l = _mm256_fnmadd_pd(q, n, l);
+        l = _mm256_add_pd(l, _mm256_and_pd(n,
+                  _mm256_cmp_pd(l, _mm256_setzero_pd(), _CMP_LT_OQ)));
+
+        h = vec4d_reduce_2n(_mm256_add_pd(h, l), n);
+        _mm256_storeu_si256((__m256i *) (res + i), vec4d_to_vec4n(h));
+    }
+
+    for ( ; i < len; i++)
+        NMOD_RED(res[i], vec[i], mod);
+}
+
+/* requires n < 2^50 */
+AVX2_TARGET void
+_nmod_vec_scalar_mul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod)
+{
+    slong i = 0;
+
+    if (mod.norm >= FLINT_BITS / 2)
+    {
+        const __m256i n = _mm256_set1_epi64x(mod.n);
+        const __m256i nm1 = _mm256_set1_epi64x(mod.n - 1);
+        const __m256i cc = _mm256_set1_epi64x(c);
+        const __m256i cp = _mm256_set1_epi64x((c << 32) / mod.n);
+        __m256i a;
+
+        for ( ; i + 4 <= len; i += 4)
+        {
+            a = _mm256_loadu_si256((const __m256i *) (vec + i));
+            a = vec4n_mulmod_shoup32(a, cc, cp, n, nm1);
+            _mm256_storeu_si256((__m256i *) (res + i), a);
+        }
+    }
+    else
+    {
+        const __m256d n = _mm256_set1_pd((double) mod.n);
+        const __m256d ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+        const __m256d cc = _mm256_set1_pd((double) c);
+        __m256d a;
+
+        for ( ; i + 4 <= len; i += 4)
+        {
+            a = vec4n_to_vec4d(_mm256_loadu_si256((const __m256i *) (vec + i)));
+            a = vec4d_mulmod(a, cc, n, ninv);
+            _mm256_storeu_si256((__m256i *) (res + i), vec4d_to_vec4n(a));
+        }
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_mul(vec[i], c, mod);
+}
+
+/* requires n < 2^50 */
+AVX2_TARGET void
+_nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod)
+{
+    slong i = 0;
+
+    if (mod.norm >= FLINT_BITS / 2)
+    {
+        const __m256i n = _mm256_set1_epi64x(mod.n);
+        const __m256i nm1 = _mm256_set1_epi64x(mod.n - 1);
+        const __m256i cc = _mm256_set1_epi64x(c);
+        const __m256i cp = _mm256_set1_epi64x((c << 32) / mod.n);
+        __m256i a;
+
+        for ( ; i + 4 <= len; i += 4)
+        {
+            a = _mm256_loadu_si256((const __m256i *) (vec + i));
+            a = vec4n_mulmod_shoup32(a, cc, cp, n, nm1);
+            a = _mm256_add_epi64(a,
+                        _mm256_loadu_si256((const __m256i *) (res + i)));
+            a = _mm256_sub_epi64(a,
+                        _mm256_and_si256(n, _mm256_cmpgt_epi64(a, nm1)));
+            _mm256_storeu_si256((__m256i *) (res + i), a);
+        }
+    }
+    else
+    {
+        const __m256d n = _mm256_set1_pd((double) mod.n);
+        const __m256d ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+        const __m256d cc = _mm256_set1_pd((double) c);
+        __m256d a;
+
+        for ( ; i + 4 <= len; i += 4)
+        {
+            a = vec4n_to_vec4d(_mm256_loadu_si256((const __m256i *) (vec + i)));
+            a = vec4d_mulmod(a, cc, n, ninv);
+            a = _mm256_add_pd(a, vec4n_to_vec4d(
+                        _mm256_loadu_si256((const __m256i *) (res + i))));
+            a = vec4d_reduce_2n(a, n);
+            _mm256_storeu_si256((__m256i *) (res + i), vec4d_to_vec4n(a));
+        }
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_addmul(res[i], vec[i], c, mod);
+}
+
+/*
+   Requires n <= 2^32 and len < 2^32. The 64-bit products are split into
+   32-bit halves which are accumulated separately, so that no lane can
+   overflow.
+*/
+AVX2_TARGET mp_limb_t
+_nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m256i lo32 = _mm256_set1_epi64x(UWORD(0xffffffff));
+    __m256i p, q, s0, s1, t0, t1;
+    mp_limb_t u[4], lo, hi, r1, r0, res;
+    slong i;
+
+    s0 = s1 = t0 = t1 = _mm256_setzero_si256();
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        p = _mm256_mul_epu32(_mm256_loadu_si256((const __m256i *) (vec1 + i)),
+                             _mm256_loadu_si256((const __m256i *) (vec2 + i)));
+        q = _mm256_mul_epu32(
+                _mm256_loadu_si256((const __m256i *) (vec1 + i + 4)),
+                _mm256_loadu_si256((const __m256i *) (vec2 + i + 4)));
+        s0 = _mm256_add_epi64(s0, _mm256_and_si256(p, lo32));
+        s1 = _mm256_add_epi64(s1, _mm256_srli_epi64(p, 32));
+        t0 = _mm256_add_epi64(t0, _mm256_and_si256(q, lo32));
+        t1 = _mm256_add_epi64(t1, _mm256_srli_epi64(q, 32));
+    }
+
+    s0 = _mm256_add_epi64(s0, t0);
+    s1 = _mm256_add_epi64(s1, t1);
+
+    _mm256_storeu_si256((__m256i *) u, s0);
+    lo = u[0] + u[1] + u[2] + u[3];
+    _mm256_storeu_si256((__m256i *) u, s1);
+    hi = u[0] + u[1] + u[2] + u[3];
+
+    for ( ; i < len; i++)
+    {
+        mp_limb_t t = vec1[i] * vec2[i];
+        lo += t & UWORD(0xffffffff);
+        hi += t >> 32;
+    }
+
+    r1 = hi >> 32;
+    r0 = hi << 32;
+    add_ssaaaa(r1, r0, r1, r0, 0, lo);
+    NMOD2_RED2(res, r1, r0, mod);
+
+    return res;
+}
+
+#endif
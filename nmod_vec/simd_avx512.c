@@ -0,0 +1,324 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+#define AVX512_TARGET __attribute__((target("avx512f,avx512dq")))
+#define AVX512_INLINE static __inline__ AVX512_TARGET
+
+/*
+   The same algorithms as in simd_avx2.c with eight lanes. Comparisons
+   produce masks, unsigned comparisons and conversions are native, and
+   the tails are handled with masked loads and stores.
+*/
+
+/* mask selecting the first len lanes, 0 <= len < 8 */
+#define TAIL_MASK(len) ((__mmask8) ((1U << (len)) - 1))
+
+/* a*b mod n for doubles a, b with n < 2^50 and a*b/n < 2^50 */
+AVX512_INLINE __m512d
+vec8d_mulmod(__m512d a, __m512d b, __m512d n, __m512d ninv)
+{
+    __m512d h, l, q, r;
+
+    h = _mm512_mul_pd(a, b);
+    l = _mm512_fmsub_pd(a, b, h);
+    q = _mm512_roundscale_pd(_mm512_mul_pd(h, ninv),
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm512_add_pd(_mm512_fnmadd_pd(q, n, h), l);
+
+    return _mm512_mask_add_pd(r,
+             _mm512_cmp_pd_mask(r, _mm512_setzero_pd(), _CMP_LT_OQ), r, n);
+}
+
+AVX512_INLINE __m512d
+vec8d_reduce_2n(__m512d r, __m512d n)
+{
+    return _mm512_mask_sub_pd(r, _mm512_cmp_pd_mask(r, n, _CMP_GE_OQ), r, n);
+}
+
+/* Shoup's algorithm with 32-bit words for a, c, n < 2^32 */
+AVX512_INLINE __m512i
+vec8n_mulmod_shoup32(__m512i a, __m512i c, __m512i cp, __m512i n)
+{
+    __m512i q, r;
+
+    q = _mm512_srli_epi64(_mm512_mul_epu32(a, cp), 32);
+    r = _mm512_sub_epi64(_mm512_mul_epu32(a, c), _mm512_mul_epu32(q, n));
+
+    return _mm512_mask_sub_epi64(r, _mm512_cmpge_epu64_mask(r, n), r, n);
+}
+
+AVX512_INLINE __m512i
+vec8n_add(__m512i a, __m512i b, __m512i n)
+{
+    __m512i t = _mm512_sub_epi64(n, b);
+    return _mm512_mask_sub_epi64(_mm512_add_epi64(a, b),
+                                 _mm512_cmpge_epu64_mask(a, t), a, t);
+}
+
+AVX512_INLINE __m512i
+vec8n_sub(__m512i a, __m512i b, __m512i n)
+{
+    __m512i t = _mm512_sub_epi64(a, b);
+    return _mm512_mask_add_epi64(t, _mm512_cmplt_epu64_mask(a, b), t, n);
+}
+
+AVX512_INLINE __m512i
+vec8n_neg(__m512i a, __m512i n)
+{
+    return _mm512_maskz_sub_epi64(_mm512_test_epi64_mask(a, a), n, a);
+}
+
+AVX512_TARGET void
+_nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    __m512i a, b;
+    __mmask8 m;
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_loadu_si512(vec1 + i);
+        b = _mm512_loadu_si512(vec2 + i);
+        _mm512_storeu_si512(res + i, vec8n_add(a, b, n));
+    }
+
+    if (i < len)
+    {
+        m = TAIL_MASK(len - i);
+        a = _mm512_maskz_loadu_epi64(m, vec1 + i);
+        b = _mm512_maskz_loadu_epi64(m, vec2 + i);
+        _mm512_mask_storeu_epi64(res + i, m, vec8n_add(a, b, n));
+    }
+}
+
+AVX512_TARGET void
+_nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    __m512i a, b;
+    __mmask8 m;
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_loadu_si512(vec1 + i);
+        b = _mm512_loadu_si512(vec2 + i);
+        _mm512_storeu_si512(res + i, vec8n_sub(a, b, n));
+    }
+
+    if (i < len)
+    {
+        m = TAIL_MASK(len - i);
+        a = _mm512_maskz_loadu_epi64(m, vec1 + i);
+        b = _mm512_maskz_loadu_epi64(m, vec2 + i);
+        _mm512_mask_storeu_epi64(res + i, m, vec8n_sub(a, b, n));
+    }
+}
+
+AVX512_TARGET void
+_nmod_vec_neg_avx512(mp_ptr res, mp_srcptr vec, slong len, nmod_t mod)
+{
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    __m512i a;
+    __mmask8 m;
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_loadu_si512(vec + i);
+        _mm512_storeu_si512(res + i, vec8n_neg(a, n));
+    }
+
+    if (i < len)
+    {
+        m = TAIL_MASK(len - i);
+        a = _mm512_maskz_loadu_epi64(m, vec + i);
+        _mm512_mask_storeu_epi64(res + i, m, vec8n_neg(a, n));
+    }
+}
+
+/* requires n < 2^50; the input limbs are arbitrary */
+AVX512_TARGET void
+_nmod_vec_reduce_avx512(mp_ptr res, mp_srcptr vec, slong len, nmod_t mod)
+{
+    const __m512i lo32 = _mm512_set1_epi64(UWORD(0xffffffff));
+    const __m512d n = _mm512_set1_pd((double) mod.n);
+    const __m512d ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+    const __m512d c = _mm512_set1_pd((double) n_mod2_preinv(
+                                     UWORD(1) << 32, mod.n, mod.ninv));
+    __m512i a;
+    __m512d h, l, q;
+    __mmask8 m = 0xff;
+    slong i;
+
+    for (i = 0; i < len; i += 8)
+    {
+        if (i + 8 > len)
+            m = TAIL_MASK(len - i);
+
+        a = _mm512_maskz_loadu_epi64(m, vec + i);
+
+        /* a = h*2^32 + l and h*(2^32 mod n) + l is reduced */
+        h = _mm512_cvtepu64_pd(_mm512_srli_epi64(a, 32));
+        l = _mm512_cvtepu64_pd(_mm512_and_si512(a, lo32));
+        h = vec8d_mulmod(h, c, n, ninv);
+
+        q = _mm512_roundscale_pd(_mm512_mul_pd(l, ninv),
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        l = _mm512_fnmadd_pd(q, n, l);
+        l = _mm512_mask_add_pd(l,
+                _mm512_cmp_pd_mask(l, _mm512_setzero_pd(), _CMP_LT_OQ), l, n);
+
+        h = vec8d_reduce_2n(_mm512_add_pd(h, l), n);
+        _mm512_mask_storeu_epi64(res + i, m, _mm512_cvtpd_epu64(h));
+    }
+}
+
+/* requires n < 2^50 */
+AVX512_TARGET void
+_nmod_vec_scalar_mul_nmod_avx512(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod)
+{
+    __mmask8 m = 0xff;
+    slong i;
+
+    if (mod.norm >= FLINT_BITS / 2)
+    {
+        const __m512i n = _mm512_set1_epi64(mod.n);
+        const __m512i cc = _mm512_set1_epi64(c);
+        const __m512i cp = _mm512_set1_epi64((c << 32) / mod.n);
+        __m512i a;
+
+        for (i = 0; i < len; i += 8)
+        {
+            if (i + 8 > len)
+                m = TAIL_MASK(len - i);
+
+            a = _mm512_maskz_loadu_epi64(m, vec + i);
+            a = vec8n_mulmod_shoup32(a, cc, cp, n);
+            _mm512_mask_storeu_epi64(res + i, m, a);
+        }
+    }
+    else
+    {
+        const __m512d n = _mm512_set1_pd((double) mod.n);
+        const __m512d ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+        const __m512d cc = _mm512_set1_pd((double) c);
+        __m512d a;
+
+        for (i = 0; i < len; i += 8)
+        {
+            if (i + 8 > len)
+                m = TAIL_MASK(len - i);
+
+            a = _mm512_cvtepu64_pd(_mm512_maskz_loadu_epi64(m, vec + i));
+            a = vec8d_mulmod(a, cc, n, ninv);
+            _mm512_mask_storeu_epi64(res + i, m, _mm512_cvtpd_epu64(a));
+        }
+    }
+}
+
+/* requires n < 2^50 */
+AVX512_TARGET void
+_nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod)
+{
+    __mmask8 m = 0xff;
+    slong i;
+
+    if (mod.norm >= FLINT_BITS / 2)
+    {
+        const __m512i n = _mm512_set1_epi64(mod.n);
+        const __m512i cc = _mm512_set1_epi64(c);
+        const __m512i cp = _mm512_set1_epi64((c << 32) / mod.n);
+        __m512i a, r;
+
+        for (i = 0; i < len; i += 8)
+        {
+            if (i + 8 > len)
+                m = TAIL_MASK(len - i);
+
+            a = _mm512_maskz_loadu_epi64(m, vec + i);
+            r = _mm512_maskz_loadu_epi64(m, res + i);
+            a = vec8n_mulmod_shoup32(a, cc, cp, n);
+            a = _mm512_add_epi64(a, r);
+            a = _mm512_mask_sub_epi64(a, _mm512_cmpge_epu64_mask(a, n), a, n);
+            _mm512_mask_storeu_epi64(res + i, m, a);
+        }
+    }
+    else
+    {
+        const __m512d n = _mm512_set1_pd((double) mod.n);
+        const __m512d ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+        const __m512d cc = _mm512_set1_pd((double) c);
+        __m512d a, r;
+
+        for (i = 0; i < len; i += 8)
+        {
+            if (i + 8 > len)
+                m = TAIL_MASK(len - i);
+
+            a = _mm512_cvtepu64_pd(_mm512_maskz_loadu_epi64(m, vec + i));
+            r = _mm512_cvtepu64_pd(_mm512_maskz_loadu_epi64(m, res + i));
+            a = vec8d_mulmod(a, cc, n, ninv);
+            a = vec8d_reduce_2n(_mm512_add_pd(a, r), n);
+            _mm512_mask_storeu_epi64(res + i, m, _mm512_cvtpd_epu64(a));
+        }
+    }
+}
+
+/* requires n <= 2^32 and len < 2^32, see _nmod_vec_dot_avx2 */
+AVX512_TARGET mp_limb_t
+_nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m512i lo32 = _mm512_set1_epi64(UWORD(0xffffffff));
+    __m512i p, s0, s1;
+    __mmask8 m = 0xff;
+    mp_limb_t lo, hi, r1, r0, res;
+    slong i;
+
+    s0 = s1 = _mm512_setzero_si512();
+
+    for (i = 0; i < len; i += 8)
+    {
+        if (i + 8 > len)
+            m = TAIL_MASK(len - i);
+
+        p = _mm512_mul_epu32(_mm512_maskz_loadu_epi64(m, vec1 + i),
+                             _mm512_maskz_loadu_epi64(m, vec2 + i));
+        s0 = _mm512_add_epi64(s0, _mm512_and_si512(p, lo32));
+        s1 = _mm512_add_epi64(s1, _mm512_srli_epi64(p, 32));
+    }
+
+    lo = _mm512_reduce_add_epi64(s0);
+    hi = _mm512_reduce_add_epi64(s1);
+
+    r1 = hi >> 32;
+    r0 = hi << 32;
+    add_ssaaaa(r1, r0, r1, r0, 0, lo);
+    NMOD2_RED2(res, r1, r0, mod);
+
+    return res;
+}
+
+#endif
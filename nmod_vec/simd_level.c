@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+/* written once with the same value by every thread, so no locking needed */
+static volatile int _nmod_vec_simd_detected = -1;
+
+static int
+_nmod_vec_simd_detect(void)
+{
+    const char * env = getenv("FLINT_NMOD_VEC_SIMD");
+    int level = NMOD_VEC_SIMD_NONE;
+
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        level = NMOD_VEC_SIMD_AVX2;
+
+        if (__builtin_cpu_supports("avx512f")
+                && __builtin_cpu_supports("avx512dq"))
+            level = NMOD_VEC_SIMD_AVX512;
+    }
+
+    /* allow the level to be lowered, e.g. for testing or benchmarking */
+    if (env != NULL && env[0] >= '0' && env[0] <= '2' && env[0] - '0' < level)
+        level = env[0] - '0';
+
+    return level;
+}
+
+int
+_nmod_vec_simd_level(void)
+{
+    int level = _nmod_vec_simd_detected;
+
+    if (level < 0)
+    {
+        level = _nmod_vec_simd_detect();
+        _nmod_vec_simd_detected = level;
+    }
+
+    return level;
+}
+
+#else
+
+int
+_nmod_vec_simd_level(void)
+{
+    return NMOD_VEC_SIMD_NONE;
+}
+
+#endif
@@ -19,6 +19,25 @@ void _nmod_vec_sub(mp_ptr res, mp_srcptr vec1,
                    mp_srcptr vec2, slong len, nmod_t mod)
 {
     slong i;
+
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF)
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+        {
+            _nmod_vec_sub_avx512(res, vec1, vec2, len, mod);
+            return;
+        }
+        else if (level == NMOD_VEC_SIMD_AVX2)
+        {
+            _nmod_vec_sub_avx2(res, vec1, vec2, len, mod);
+            return;
+        }
+    }
+#endif
+
     if (mod.norm)
     {
         for (i = 0 ; i < len; i++)
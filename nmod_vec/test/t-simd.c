@@ -0,0 +1,191 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+/* compares the kernels of the given level against elementwise arithmetic */
+static void
+check_level(int level, flint_rand_t state)
+{
+    slong iter;
+
+    for (iter = 0; iter < 2000 * flint_test_multiplier(); iter++)
+    {
+        slong i, len = n_randint(state, 100);
+        flint_bitcnt_t bits;
+        mp_limb_t n, c, d1, d2;
+        mp_ptr a, b, r, s;
+        nmod_t mod;
+
+        switch (n_randint(state, 3))
+        {
+            case 0:  bits = n_randint(state, 32) + 1; break;
+            case 1:  bits = n_randint(state, NMOD_VEC_SIMD_FMA_MAX_BITS) + 1;
+                     break;
+            default: bits = n_randint(state, FLINT_BITS) + 1;
+        }
+
+        n = n_randtest_bits(state, bits);
+        if (n == 0)
+            n = 1;
+        nmod_init(&mod, n);
+        c = n_randint(state, n);
+
+        a = _nmod_vec_init(len);
+        b = _nmod_vec_init(len);
+        r = _nmod_vec_init(len);
+        s = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(a, state, len, mod);
+        _nmod_vec_randtest(b, state, len, mod);
+
+        /* add, sub and neg work for any modulus */
+        if (level == NMOD_VEC_SIMD_AVX512)
+            _nmod_vec_add_avx512(r, a, b, len, mod);
+        else
+            _nmod_vec_add_avx2(r, a, b, len, mod);
+        for (i = 0; i < len; i++)
+            s[i] = nmod_add(a[i], b[i], mod);
+        if (!_nmod_vec_equal(r, s, len))
+        {
+            flint_printf("FAIL (add, level %d):\n", level);
+            flint_printf("len = %wd, n = %wu\n", len, n);
+            abort();
+        }
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+            _nmod_vec_sub_avx512(r, a, b, len, mod);
+        else
+            _nmod_vec_sub_avx2(r, a, b, len, mod);
+        for (i = 0; i < len; i++)
+            s[i] = nmod_sub(a[i], b[i], mod);
+        if (!_nmod_vec_equal(r, s, len))
+        {
+            flint_printf("FAIL (sub, level %d):\n", level);
+            flint_printf("len = %wd, n = %wu\n", len, n);
+            abort();
+        }
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+            _nmod_vec_neg_avx512(r, a, len, mod);
+        else
+            _nmod_vec_neg_avx2(r, a, len, mod);
+        for (i = 0; i < len; i++)
+            s[i] = nmod_neg(a[i], mod);
+        if (!_nmod_vec_equal(r, s, len))
+        {
+            flint_printf("FAIL (neg, level %d):\n", level);
+            flint_printf("len = %wd, n = %wu\n", len, n);
+            abort();
+        }
+
+        if (bits <= NMOD_VEC_SIMD_FMA_MAX_BITS)
+        {
+            if (level == NMOD_VEC_SIMD_AVX512)
+                _nmod_vec_scalar_mul_nmod_avx512(r, a, len, c, mod);
+            else
+                _nmod_vec_scalar_mul_nmod_avx2(r, a, len, c, mod);
+            for (i = 0; i < len; i++)
+                s[i] = nmod_mul(a[i], c, mod);
+            if (!_nmod_vec_equal(r, s, len))
+            {
+                flint_printf("FAIL (scalar_mul_nmod, level %d):\n", level);
+                flint_printf("len = %wd, n = %wu, c = %wu\n", len, n, c);
+                abort();
+            }
+
+            _nmod_vec_set(r, b, len);
+            if (level == NMOD_VEC_SIMD_AVX512)
+                _nmod_vec_scalar_addmul_nmod_avx512(r, a, len, c, mod);
+            else
+                _nmod_vec_scalar_addmul_nmod_avx2(r, a, len, c, mod);
+            for (i = 0; i < len; i++)
+                s[i] = nmod_addmul(b[i], a[i], c, mod);
+            if (!_nmod_vec_equal(r, s, len))
+            {
+                flint_printf("FAIL (scalar_addmul_nmod, level %d):\n", level);
+                flint_printf("len = %wd, n = %wu, c = %wu\n", len, n, c);
+                abort();
+            }
+
+            /* unreduced input */
+            for (i = 0; i < len; i++)
+                b[i] = n_randtest(state);
+            if (level == NMOD_VEC_SIMD_AVX512)
+                _nmod_vec_reduce_avx512(r, b, len, mod);
+            else
+                _nmod_vec_reduce_avx2(r, b, len, mod);
+            for (i = 0; i < len; i++)
+                NMOD_RED(s[i], b[i], mod);
+            if (!_nmod_vec_equal(r, s, len))
+            {
+                flint_printf("FAIL (reduce, level %d):\n", level);
+                flint_printf("len = %wd, n = %wu\n", len, n);
+                abort();
+            }
+        }
+
+        if (n <= (UWORD(1) << 32))
+        {
+            _nmod_vec_randtest(b, state, len, mod);
+
+            if (level == NMOD_VEC_SIMD_AVX512)
+                d1 = _nmod_vec_dot_avx512(a, b, len, mod);
+            else
+                d1 = _nmod_vec_dot_avx2(a, b, len, mod);
+            d2 = 0;
+            for (i = 0; i < len; i++)
+                d2 = nmod_addmul(d2, a[i], b[i], mod);
+            if (d1 != d2)
+            {
+                flint_printf("FAIL (dot, level %d):\n", level);
+                flint_printf("len = %wd, n = %wu\n", len, n);
+                abort();
+            }
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(r);
+        _nmod_vec_clear(s);
+    }
+}
+
+#endif
+
+int
+main(void)
+{
+    FLINT_TEST_INIT(state);
+
+    flint_printf("simd....");
+    fflush(stdout);
+
+#if NMOD_VEC_HAVE_SIMD
+    if (_nmod_vec_simd_level() >= NMOD_VEC_SIMD_AVX2)
+        check_level(NMOD_VEC_SIMD_AVX2, state);
+
+    if (_nmod_vec_simd_level() >= NMOD_VEC_SIMD_AVX512)
+        check_level(NMOD_VEC_SIMD_AVX512, state);
+#endif
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+#define MAX_BLOCKS 40
+
+/* fill blocks with a tag, recurse, and check the tags survived */
+int check_nested(flint_rand_t state, slong depth)
+{
+    flint_arena_mark_t mark;
+    flint_arena_stats_t s1, s2;
+    mp_ptr block[MAX_BLOCKS];
+    slong len[MAX_BLOCKS];
+    slong i, j, num;
+    int result = 1;
+
+    flint_arena_get_stats(s1);
+    flint_arena_mark(mark);
+
+    num = n_randint(state, MAX_BLOCKS);
+
+    for (i = 0; i < num; i++)
+    {
+        if (n_randint(state, 20) == 0)
+            len[i] = n_randint(state, 200000);
+        else
+            len[i] = n_randint(state, 2000);
+
+        block[i] = FLINT_ARENA_ARRAY_ALLOC(len[i], mp_limb_t);
+
+        if ((((size_t) block[i]) % 16) != 0)
+            return 0;
+
+        for (j = 0; j < len[i]; j++)
+            block[i][j] = depth*MAX_BLOCKS + i;
+    }
+
+    if (depth > 0 && n_randint(state, 2))
+        result = check_nested(state, depth - 1);
+
+    for (i = 0; i < num && result; i++)
+        for (j = 0; j < len[i]; j++)
+            if (block[i][j] != depth*MAX_BLOCKS + i)
+                result = 0;
+
+    flint_arena_release(mark);
+    flint_arena_get_stats(s2);
+
+    if (s2->in_use != s1->in_use || s2->peak < s1->peak)
+        result = 0;
+
+    return result;
+}
+
+void tmp_fill(mp_ptr res, slong len)
+{
+    mp_ptr tmp;
+    slong i;
+    TMP_INIT;
+
+    TMP_START;
+
+    tmp = TMP_ALLOC(len*sizeof(mp_limb_t));
+
+    for (i = 0; i < len; i++)
+        tmp[i] = i;
+
+    for (i = 0; i < len; i++)
+        res[i] = tmp[len - i - 1];
+
+    TMP_END;
+}
+
+int
+main(void)
+{
+    slong iter;
+    flint_arena_stats_t s;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("arena....");
+    fflush(stdout);
+
+    /* nested scopes do not overlap and restore the usage */
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        if (!check_nested(state, n_randint(state, 6)))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("nested allocation, iter = %wd\n", iter);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        flint_arena_get_stats(s);
+
+        if (s->in_use != 0 || s->reserved > 2*FLINT_ARENA_MAX_RETAIN)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("in_use = %wu, reserved = %wu\n", (ulong) s->in_use,
+                                                     (ulong) s->reserved);
+            fflush(stdout);
+            flint_abort();
+        }
+    }
+
+    /* large blocks are returned to the system */
+    {
+        flint_arena_mark_t mark;
+        size_t reserved;
+        char * ptr;
+
+        flint_arena_get_stats(s);
+        reserved = s->reserved;
+
+        flint_arena_mark(mark);
+        ptr = flint_arena_alloc(4*FLINT_ARENA_MAX_RETAIN);
+        ptr[0] = ptr[4*FLINT_ARENA_MAX_RETAIN - 1] = 1;
+        flint_arena_release(mark);
+
+        flint_arena_get_stats(s);
+
+        if (s->reserved > reserved + FLINT_ARENA_MAX_RETAIN)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("large block retained, reserved = %wu\n",
+                                                     (ulong) s->reserved);
+            fflush(stdout);
+            flint_abort();
+        }
+    }
+
+    /* temporary allocation of small and large blocks */
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        slong i, len = n_randint(state, 20000);
+        mp_ptr res = flint_malloc((len + 1)*sizeof(mp_limb_t));
+
+        tmp_fill(res, len);
+
+        for (i = 0; i < len; i++)
+        {
+            if (res[i] != len - i - 1)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("TMP_ALLOC, len = %wd, i = %wd\n", len, i);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        flint_free(res);
+    }
+
+    flint_arena_get_stats(s);
+
+    if (s->in_use != 0)
+    {
+        flint_printf("FAIL:\n");
+        flint_printf("TMP_END, in_use = %wu\n", (ulong) s->in_use);
+        fflush(stdout);
+        flint_abort();
+    }
+
+    /* cleanup gives all chunks back */
+    flint_cleanup();
+    flint_arena_get_stats(s);
+
+    if (s->reserved != 0)
+    {
+        flint_printf("FAIL:\n");
+        flint_printf("cleanup, reserved = %wu\n", (ulong) s->reserved);
+        fflush(stdout);
+        flint_abort();
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -93,6 +93,72 @@ FLINT_DLL void thread_pool_give_back(thread_pool_t T, thread_pool_handle i);
 
 FLINT_DLL void thread_pool_clear(thread_pool_t T);
 
+/* work stealing *************************************************************/
+
+/*
+    Fork/join tasks run by a team of threads: the calling thread plus some
+    workers already requested from a pool. Each member of a team owns a
+    Chase-Lev deque of spawned tasks; members pop from the bottom of their
+    own deque and steal from the top of the others' when out of work.
+*/
+
+/* capacity of each deque, a power of two; when full, spawn runs inline */
+#define THREAD_POOL_DEQUE_LENGTH 512
+
+typedef struct
+{
+    volatile slong pending;
+} thread_pool_task_group_struct;
+
+typedef thread_pool_task_group_struct thread_pool_task_group_t[1];
+
+typedef struct
+{
+    void (* fxn)(void *);
+    void * arg;
+    thread_pool_task_group_struct * group;
+} thread_pool_task_struct;
+
+typedef struct
+{
+    volatile slong top;
+    char pad1[64];
+    volatile slong bottom;
+    char pad2[64];
+    thread_pool_task_struct * tasks;
+    struct thread_pool_team_struct * team;
+    ulong seed;
+    slong idx;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_t mutex;  /* only used without atomic builtins */
+#endif
+} thread_pool_deque_struct;
+
+typedef struct thread_pool_team_struct
+{
+    thread_pool_deque_struct * deques;
+    slong length;
+    volatile int done;
+} thread_pool_team_struct;
+
+FLINT_DLL void thread_pool_run(thread_pool_t T, thread_pool_handle * handles,
+                      slong num_handles, void (* f)(void *), void * a);
+
+FLINT_DLL int thread_pool_in_team(void);
+
+FLINT_DLL slong thread_pool_team_size(void);
+
+FLINT_DLL slong thread_pool_team_index(void);
+
+FLINT_DLL void thread_pool_task_group_init(thread_pool_task_group_t G);
+
+FLINT_DLL void thread_pool_task_group_clear(thread_pool_task_group_t G);
+
+FLINT_DLL void thread_pool_spawn(thread_pool_task_group_t G,
+                                               void (* f)(void *), void * a);
+
+FLINT_DLL void thread_pool_sync(thread_pool_task_group_t G);
+
 /* misc internal helpers *****************************************************/
 
 FLINT_DLL void _thread_pool_distribute_work_2(slong start, slong stop,
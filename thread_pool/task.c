@@ -0,0 +1,462 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+#if FLINT_USES_PTHREAD
+#include <sched.h>
+#endif
+
+/* the current deque of a thread has to be thread local */
+#if FLINT_USES_PTHREAD && FLINT_USES_TLS
+#define THREAD_POOL_STEALING 1
+#else
+#define THREAD_POOL_STEALING 0
+#endif
+
+#if THREAD_POOL_STEALING
+
+/* deque of the calling thread, or NULL when not running inside a team */
+static FLINT_TLS_PREFIX thread_pool_deque_struct * _thread_pool_current = NULL;
+
+#define DEQUE_MASK (THREAD_POOL_DEQUE_LENGTH - 1)
+
+#if defined(__GNUC__)
+
+/* lock free Chase-Lev deque as in Le, Pop, Cohen, Zappa Nardelli (2013) */
+
+#define LOAD_RELAXED(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define LOAD_ACQUIRE(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_RELAXED(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+#define STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#define FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define CAS(x, e, d) \
+    __atomic_compare_exchange_n(&(x), &(e), (d), 0, \
+                                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)
+#define GROUP_ADD(G, v) __atomic_fetch_add(&(G)->pending, (v), __ATOMIC_ACQ_REL)
+#define GROUP_PENDING(G) __atomic_load_n(&(G)->pending, __ATOMIC_ACQUIRE)
+
+static void
+_deque_init(thread_pool_deque_struct * d)
+{
+    d->top = d->bottom = 0;
+}
+
+static void
+_deque_clear(thread_pool_deque_struct * d)
+{
+}
+
+/* only called by the owner; fails if the deque is full */
+static int
+_deque_push(thread_pool_deque_struct * d, const thread_pool_task_struct * t)
+{
+    slong b = LOAD_RELAXED(d->bottom);
+    slong top = LOAD_ACQUIRE(d->top);
+
+    if (b - top >= THREAD_POOL_DEQUE_LENGTH)
+        return 0;
+
+    d->tasks[b & DEQUE_MASK] = *t;
+    STORE_RELEASE(d->bottom, b + 1);
+
+    return 1;
+}
+
+/* only called by the owner; takes the most recently pushed task */
+static int
+_deque_pop(thread_pool_deque_struct * d, thread_pool_task_struct * t)
+{
+    slong b = LOAD_RELAXED(d->bottom) - 1;
+    slong top;
+    int ok = 1;
+
+    STORE_RELAXED(d->bottom, b);
+    FENCE();
+    top = LOAD_RELAXED(d->top);
+
+    if (top <= b)
+    {
+        *t = d->tasks[b & DEQUE_MASK];
+
+        if (top == b)
+        {
+            /* last task: race against the thieves for it */
+            ok = CAS(d->top, top, top + 1);
+            STORE_RELAXED(d->bottom, b + 1);
+        }
+    }
+    else
+    {
+        ok = 0;
+        STORE_RELAXED(d->bottom, b + 1);
+    }
+
+    return ok;
+}
+
+/*
+    Called by any other member; takes the oldest task. The copy of the
+    task may be torn by a concurrent push only if another thief advanced
+    top meanwhile, in which case the compare and swap fails.
+*/
+static int
+_deque_steal(thread_pool_deque_struct * d, thread_pool_task_struct * t)
+{
+    slong top = LOAD_ACQUIRE(d->top);
+    slong b;
+
+    FENCE();
+    b = LOAD_ACQUIRE(d->bottom);
+
+    if (top >= b)
+        return 0;
+
+    *t = d->tasks[top & DEQUE_MASK];
+
+    return CAS(d->top, top, top + 1);
+}
+
+#else
+
+/* without atomic builtins the deques and counters are protected by locks */
+
+static pthread_mutex_t _thread_pool_group_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static slong
+_group_add(thread_pool_task_group_struct * G, slong v)
+{
+    slong old;
+    pthread_mutex_lock(&_thread_pool_group_mutex);
+    old = G->pending;
+    G->pending = old + v;
+    pthread_mutex_unlock(&_thread_pool_group_mutex);
+    return old;
+}
+
+#define LOAD_ACQUIRE(x) _load_locked(&(x))
+#define STORE_RELEASE(x, v) \
+    do { \
+        pthread_mutex_lock(&_thread_pool_group_mutex); \
+        (x) = (v); \
+        pthread_mutex_unlock(&_thread_pool_group_mutex); \
+    } while (0)
+#define GROUP_ADD(G, v) _group_add((G), (v))
+#define GROUP_PENDING(G) _group_add((G), 0)
+
+static int
+_load_locked(volatile int * x)
+{
+    int v;
+    pthread_mutex_lock(&_thread_pool_group_mutex);
+    v = *x;
+    pthread_mutex_unlock(&_thread_pool_group_mutex);
+    return v;
+}
+
+static void
+_deque_init(thread_pool_deque_struct * d)
+{
+    d->top = d->bottom = 0;
+    pthread_mutex_init(&d->mutex, NULL);
+}
+
+static void
+_deque_clear(thread_pool_deque_struct * d)
+{
+    pthread_mutex_destroy(&d->mutex);
+}
+
+static int
+_deque_push(thread_pool_deque_struct * d, const thread_pool_task_struct * t)
+{
+    int ok = 0;
+
+    pthread_mutex_lock(&d->mutex);
+    if (d->bottom - d->top < THREAD_POOL_DEQUE_LENGTH)
+    {
+        d->tasks[d->bottom & DEQUE_MASK] = *t;
+        d->bottom++;
+        ok = 1;
+    }
+    pthread_mutex_unlock(&d->mutex);
+
+    return ok;
+}
+
+static int
+_deque_pop(thread_pool_deque_struct * d, thread_pool_task_struct * t)
+{
+    int ok = 0;
+
+    pthread_mutex_lock(&d->mutex);
+    if (d->bottom > d->top)
+    {
+        d->bottom--;
+        *t = d->tasks[d->bottom & DEQUE_MASK];
+        ok = 1;
+    }
+    pthread_mutex_unlock(&d->mutex);
+
+    return ok;
+}
+
+static int
+_deque_steal(thread_pool_deque_struct * d, thread_pool_task_struct * t)
+{
+    int ok = 0;
+
+    pthread_mutex_lock(&d->mutex);
+    if (d->bottom > d->top)
+    {
+        *t = d->tasks[d->top & DEQUE_MASK];
+        d->top++;
+        ok = 1;
+    }
+    pthread_mutex_unlock(&d->mutex);
+
+    return ok;
+}
+
+#endif
+
+static void
+_run_task(thread_pool_task_struct * t)
+{
+    t->fxn(t->arg);
+    GROUP_ADD(t->group, -1);
+}
+
+/* try each other member of the team once, starting at a random one */
+static int
+_steal_any(thread_pool_deque_struct * w, thread_pool_task_struct * t)
+{
+    thread_pool_team_struct * team = w->team;
+    slong k, v, n = team->length;
+
+    w->seed ^= w->seed << 13;
+    w->seed ^= w->seed >> 7;
+    w->seed ^= w->seed << 17;
+
+    v = w->seed % (ulong) n;
+
+    for (k = 0; k < n; k++)
+    {
+        if (v != w->idx && _deque_steal(team->deques + v, t))
+            return 1;
+
+        v = (v + 1 == n) ? 0 : v + 1;
+    }
+
+    return 0;
+}
+
+/* spin for a while before giving up the time slice */
+static void
+_backoff(int * fails)
+{
+    if (++(*fails) > 32)
+    {
+        sched_yield();
+        *fails = 0;
+    }
+}
+
+static void
+_thread_pool_team_worker(void * varg)
+{
+    thread_pool_deque_struct * w = (thread_pool_deque_struct *) varg;
+    thread_pool_task_struct t;
+    int fails = 0;
+
+    _thread_pool_current = w;
+
+    while (!LOAD_ACQUIRE(w->team->done))
+    {
+        if (_steal_any(w, &t))
+        {
+            _run_task(&t);
+            fails = 0;
+        }
+        else
+        {
+            _backoff(&fails);
+        }
+    }
+
+    _thread_pool_current = NULL;
+}
+
+void thread_pool_run(thread_pool_t T, thread_pool_handle * handles,
+                             slong num_handles, void (* f)(void *), void * a)
+{
+    thread_pool_team_struct team;
+    thread_pool_deque_struct * D, * prev;
+    slong i;
+
+    if (num_handles <= 0)
+    {
+        f(a);
+        return;
+    }
+
+    team.length = num_handles + 1;
+    team.done = 0;
+    D = (thread_pool_deque_struct *) flint_malloc(
+                                 team.length*sizeof(thread_pool_deque_struct));
+    team.deques = D;
+
+    for (i = 0; i < team.length; i++)
+    {
+        _deque_init(D + i);
+        D[i].tasks = (thread_pool_task_struct *) flint_malloc(
+                     THREAD_POOL_DEQUE_LENGTH*sizeof(thread_pool_task_struct));
+        D[i].team = &team;
+        D[i].idx = i;
+        D[i].seed = 2*i + UWORD(0x9e3779b97f4a7c15);
+    }
+
+    prev = _thread_pool_current;
+    _thread_pool_current = D + 0;
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wake(T, handles[i], 0, _thread_pool_team_worker, D + i + 1);
+
+    f(a);
+
+    STORE_RELEASE(team.done, 1);
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wait(T, handles[i]);
+
+    _thread_pool_current = prev;
+
+    for (i = 0; i < team.length; i++)
+    {
+        flint_free(D[i].tasks);
+        _deque_clear(D + i);
+    }
+
+    flint_free(D);
+}
+
+int thread_pool_in_team(void)
+{
+    return _thread_pool_current != NULL;
+}
+
+slong thread_pool_team_size(void)
+{
+    thread_pool_deque_struct * w = _thread_pool_current;
+
+    return (w == NULL) ? 1 : w->team->length;
+}
+
+slong thread_pool_team_index(void)
+{
+    thread_pool_deque_struct * w = _thread_pool_current;
+
+    return (w == NULL) ? 0 : w->idx;
+}
+
+void thread_pool_spawn(thread_pool_task_group_t G,
+                                                  void (* f)(void *), void * a)
+{
+    thread_pool_deque_struct * w = _thread_pool_current;
+    thread_pool_task_struct t;
+
+    if (w == NULL)
+    {
+        f(a);
+        return;
+    }
+
+    t.fxn = f;
+    t.arg = a;
+    t.group = G;
+
+    GROUP_ADD(G, 1);
+
+    if (!_deque_push(w, &t))
+        _run_task(&t);
+}
+
+void thread_pool_sync(thread_pool_task_group_t G)
+{
+    thread_pool_deque_struct * w = _thread_pool_current;
+    thread_pool_task_struct t;
+    int fails = 0;
+
+    if (w == NULL)
+        return;
+
+    /* help with the remaining work until the tasks of G are done */
+    while (GROUP_PENDING(G) != 0)
+    {
+        if (_deque_pop(w, &t) || _steal_any(w, &t))
+        {
+            _run_task(&t);
+            fails = 0;
+        }
+        else
+        {
+            _backoff(&fails);
+        }
+    }
+}
+
+#else
+
+/* tasks are run immediately by the calling thread */
+
+void thread_pool_run(thread_pool_t T, thread_pool_handle * handles,
+                             slong num_handles, void (* f)(void *), void * a)
+{
+    f(a);
+}
+
+int thread_pool_in_team(void)
+{
+    return 0;
+}
+
+slong thread_pool_team_size(void)
+{
+    return 1;
+}
+
+slong thread_pool_team_index(void)
+{
+    return 0;
+}
+
+void thread_pool_spawn(thread_pool_task_group_t G,
+                                                  void (* f)(void *), void * a)
+{
+    f(a);
+}
+
+void thread_pool_sync(thread_pool_task_group_t G)
+{
+}
+
+#endif
+
+void thread_pool_task_group_init(thread_pool_task_group_t G)
+{
+    G->pending = 0;
+}
+
+void thread_pool_task_group_clear(thread_pool_task_group_t G)
+{
+    /* all spawned tasks should have been synced */
+    FLINT_ASSERT(G->pending == 0);
+}
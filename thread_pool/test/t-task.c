@@ -0,0 +1,192 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+#include "thread_support.h"
+#include "fmpz.h"
+
+/******************************************************************************
+    test1 - calculate x = n! by recursive fork/join with spawn and sync
+*******************************************************************************/
+
+typedef struct
+{
+    ulong min;
+    ulong max;
+    fmpz_t ans;
+}
+fac_arg_struct;
+
+/* set arg->ans = product of numbers in (min, max] */
+void fac_task(void * varg)
+{
+    fac_arg_struct * arg = (fac_arg_struct *) varg;
+    ulong i, mid;
+
+    if (arg->max - arg->min > UWORD(8))
+    {
+        fac_arg_struct sub[2];
+        thread_pool_task_group_t G;
+
+        mid = arg->min + (arg->max - arg->min)/2;
+
+        sub[0].min = arg->min;
+        sub[0].max = mid;
+        sub[1].min = mid;
+        sub[1].max = arg->max;
+        fmpz_init(sub[0].ans);
+        fmpz_init(sub[1].ans);
+
+        thread_pool_task_group_init(G);
+        thread_pool_spawn(G, fac_task, sub + 0);
+        fac_task(sub + 1);
+        thread_pool_sync(G);
+        thread_pool_task_group_clear(G);
+
+        fmpz_mul(arg->ans, sub[0].ans, sub[1].ans);
+        fmpz_clear(sub[0].ans);
+        fmpz_clear(sub[1].ans);
+    }
+    else
+    {
+        fmpz_one(arg->ans);
+        for (i = arg->max; i > arg->min; i--)
+            fmpz_mul_ui(arg->ans, arg->ans, i);
+    }
+}
+
+void test1(fmpz_t x, ulong n, slong thread_limit)
+{
+    fac_arg_struct arg;
+
+    arg.min = 0;
+    arg.max = n;
+    fmpz_init(arg.ans);
+    flint_parallel_run(fac_task, &arg, thread_limit);
+    fmpz_swap(x, arg.ans);
+    fmpz_clear(arg.ans);
+}
+
+/******************************************************************************
+    test2 - nested parallel loops: a[i] = sum_{j < i} j for 0 <= i < n
+*******************************************************************************/
+
+typedef struct
+{
+    ulong * a;
+    slong grain;
+    slong row;
+}
+loop_arg_struct;
+
+void inner_body(slong start, slong stop, void * varg)
+{
+    ulong * sum = (ulong *) varg;
+    slong j;
+    ulong s = 0;
+
+    for (j = start; j < stop; j++)
+        s += j;
+
+    /* the inner ranges of one row may run concurrently */
+#if defined(__GNUC__)
+    __atomic_fetch_add(sum, s, __ATOMIC_RELAXED);
+#else
+    *sum += s;
+#endif
+}
+
+void outer_body(slong start, slong stop, void * varg)
+{
+    loop_arg_struct * arg = (loop_arg_struct *) varg;
+    slong i;
+
+    for (i = start; i < stop; i++)
+    {
+        arg->a[i] = 0;
+#if defined(__GNUC__)
+        flint_parallel_for(0, i, arg->grain, inner_body, arg->a + i,
+                                                    FLINT_DEFAULT_THREAD_LIMIT);
+#else
+        inner_body(0, i, arg->a + i);
+#endif
+    }
+}
+
+int
+main(void)
+{
+    slong i, j, k;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("task....");
+    fflush(stdout);
+
+    for (i = 0; i < 10*flint_test_multiplier(); i++)
+    {
+        fmpz_t x, y;
+
+        fmpz_init(x);
+        fmpz_init(y);
+        flint_set_num_threads(n_randint(state, 10) + 1);
+
+        for (j = 0; j < 10; j++)
+        {
+            ulong n = n_randint(state, 2000);
+            slong limit = n_randint(state, 12) + 1;
+
+            fmpz_fac_ui(y, n);
+
+            test1(x, n, limit);
+            if (!fmpz_equal(x, y))
+            {
+                flint_printf("n: %wu\n", n);
+                printf("x: "); fmpz_print(x); printf("\n");
+                printf("y: "); fmpz_print(y); printf("\n");
+                printf("test1 failed\n");
+                flint_abort();
+            }
+        }
+
+        for (j = 0; j < 10; j++)
+        {
+            slong n = n_randint(state, 300);
+            slong limit = n_randint(state, 12) + 1;
+            loop_arg_struct arg;
+
+            arg.a = (ulong *) flint_malloc(FLINT_MAX(n, 1)*sizeof(ulong));
+            arg.grain = n_randint(state, 10);
+
+            flint_parallel_for(0, n, n_randint(state, 10), outer_body, &arg,
+                                                                        limit);
+
+            for (k = 0; k < n; k++)
+            {
+                if (arg.a[k] != (ulong) k*(k - 1)/2)
+                {
+                    flint_printf("n: %wd, k: %wd\n", n, k);
+                    printf("test2 failed\n");
+                    flint_abort();
+                }
+            }
+
+            flint_free(arg.a);
+        }
+
+        fmpz_clear(x);
+        fmpz_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
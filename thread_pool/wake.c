@@ -17,9 +17,10 @@ void thread_pool_wake(thread_pool_t T, thread_pool_handle i,
 {
     thread_pool_entry_struct * D;
 
-#if FLINT_USES_PTHREAD
-    pthread_mutex_lock(&T->mutex);
-#endif
+    /*
+        The caller owns the handle, so T->mutex is not needed: the entry
+        cannot be requested, given back or resized away meanwhile.
+    */
 
     FLINT_ASSERT(i < T->length);
 
@@ -40,7 +41,5 @@ void thread_pool_wake(thread_pool_t T, thread_pool_handle i,
     pthread_cond_signal(&D[i].sleep1);
 
     pthread_mutex_unlock(&D[i].mutex);
-
-    pthread_mutex_unlock(&T->mutex);
 #endif
 }
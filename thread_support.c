@@ -123,3 +123,107 @@ void flint_give_back_threads(thread_pool_handle * handles, slong num_handles)
         flint_free(handles);
 }
 
+
+/*
+    Run f(arg) with a team of at most thread_limit threads, so that tasks
+    spawned by f with thread_pool_spawn are shared out by work stealing.
+    Inside a task of an existing team, the existing team is used.
+*/
+void flint_parallel_run(void (* f)(void *), void * arg, slong thread_limit)
+{
+    thread_pool_handle * handles;
+    slong num_handles;
+
+    if (thread_pool_in_team())
+    {
+        f(arg);
+        return;
+    }
+
+    num_handles = flint_request_threads(&handles, thread_limit);
+
+    thread_pool_run(global_thread_pool, handles, num_handles, f, arg);
+
+    flint_give_back_threads(handles, num_handles);
+}
+
+typedef struct
+{
+    void (* f)(slong, slong, void *);
+    void * arg;
+    slong start;
+    slong stop;
+    slong grain;
+}
+_parallel_for_arg_struct;
+
+/* split off the upper halves as tasks until the range is at most grain */
+static void
+_parallel_for_worker(void * varg)
+{
+    _parallel_for_arg_struct * A = (_parallel_for_arg_struct *) varg;
+    _parallel_for_arg_struct sub[FLINT_BITS];
+    thread_pool_task_group_t G;
+    slong a = A->start, b = A->stop, mid, n = 0;
+
+    thread_pool_task_group_init(G);
+
+    while (b - a > A->grain)
+    {
+        mid = a + (b - a)/2;
+        sub[n] = *A;
+        sub[n].start = mid;
+        sub[n].stop = b;
+        thread_pool_spawn(G, _parallel_for_worker, sub + n);
+        n++;
+        b = mid;
+    }
+
+    A->f(a, b, A->arg);
+
+    thread_pool_sync(G);
+    thread_pool_task_group_clear(G);
+}
+
+void flint_parallel_for(slong start, slong stop, slong grain,
+    void (* f)(slong, slong, void *), void * arg, slong thread_limit)
+{
+    _parallel_for_arg_struct A;
+    thread_pool_handle * handles;
+    slong num_handles, num_threads;
+
+    if (stop <= start)
+        return;
+
+    if (thread_pool_in_team())
+    {
+        handles = NULL;
+        num_handles = 0;
+        num_threads = thread_pool_team_size();
+    }
+    else
+    {
+        num_handles = flint_request_threads(&handles, thread_limit);
+        num_threads = num_handles + 1;
+    }
+
+    /* by default, give each thread about eight ranges to balance the load */
+    if (grain <= 0)
+        grain = FLINT_MAX(WORD(1), (stop - start)/(8*num_threads));
+
+    A.f = f;
+    A.arg = arg;
+    A.start = start;
+    A.stop = stop;
+    A.grain = grain;
+
+    if (num_threads == 1)
+        f(start, stop, arg);
+    else if (num_handles == 0)
+        _parallel_for_worker(&A);
+    else
+        thread_pool_run(global_thread_pool, handles, num_handles,
+                                                     _parallel_for_worker, &A);
+
+    flint_give_back_threads(handles, num_handles);
+}
@@ -27,6 +27,13 @@ FLINT_DLL slong flint_request_threads(thread_pool_handle ** handles,
 FLINT_DLL void flint_give_back_threads(thread_pool_handle * handles,
                                                             slong num_handles);
 
+FLINT_DLL void flint_parallel_run(void (* f)(void *), void * arg,
+                                                           slong thread_limit);
+
+FLINT_DLL void flint_parallel_for(slong start, slong stop, slong grain,
+                  void (* f)(slong, slong, void *), void * arg,
+                                                           slong thread_limit);
+
 #ifdef __cplusplus
 }
 #endif